@@ -0,0 +1,232 @@
+#include <benchmark/benchmark.h>
+
+#include <dynspv.hpp>
+#include <span>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+	size_t countInstructions(std::span<const uint32_t> code)
+	{
+		size_t count = 0;
+		for (size_t i = dynspv::HEADER_SIZE; i < code.size(); i += code[i] >> 16)
+		{
+			count++;
+		}
+		return count;
+	}
+
+	void reportThroughput(benchmark::State& state, std::span<const uint32_t> code)
+	{
+		state.SetItemsProcessed(state.iterations() * countInstructions(code));
+		state.SetBytesProcessed(state.iterations() * code.size() * sizeof(uint32_t));
+	}
+
+	template<typename TGenerator>
+	void emitBasicShader(TGenerator& generator)
+	{
+		generator.writeHeader(0x010000);
+		generator.OpCapability(spv::Capability::CapabilityShader);
+		generator.OpExtInstImport(generator.nextId(), "GLSL.std.450");
+		generator.OpMemoryModel(spv::AddressingModel::AddressingModelLogical, spv::MemoryModel::MemoryModelGLSL450);
+		auto mainId = generator.nextId();
+		generator.OpEntryPoint(spv::ExecutionModel::ExecutionModelVertex, mainId, "main");
+		auto voidTypeId = generator.nextId();
+		generator.OpTypeVoid(voidTypeId);
+		auto voidFunctionTypeId = generator.nextId();
+		generator.OpTypeFunction(voidFunctionTypeId, voidTypeId);
+		generator.OpFunction(voidTypeId, mainId, spv::FunctionControlMask::FunctionControlMaskNone, voidFunctionTypeId);
+		generator.OpLabel(generator.nextId());
+		generator.OpReturn();
+		generator.OpFunctionEnd();
+		generator.updateBound(generator.getBound());
+	}
+} // namespace
+
+// Thousands of small shaders built back to back with one generator
+static void BM_SmallShaders(benchmark::State& state)
+{
+	dynspv::ModuleGenerator generator{};
+	for (auto _ : state)
+	{
+		generator.reset();
+		emitBasicShader(generator);
+		benchmark::DoNotOptimize(generator.view().data());
+	}
+	reportThroughput(state, generator.view());
+}
+BENCHMARK(BM_SmallShaders);
+
+// A new generator per shader, as in per-draw variant paths
+template<typename TSink>
+static void BM_ShortLivedGenerators(benchmark::State& state)
+{
+	size_t size = 0;
+	for (auto _ : state)
+	{
+		dynspv::BasicModuleGenerator<TSink> generator{};
+		emitBasicShader(generator);
+		benchmark::DoNotOptimize(generator.view().data());
+		size = generator.view().size();
+	}
+	state.SetBytesProcessed(state.iterations() * size * sizeof(uint32_t));
+}
+BENCHMARK(BM_ShortLivedGenerators<dynspv::VectorSink>);
+BENCHMARK(BM_ShortLivedGenerators<dynspv::PooledSink>);
+
+// One compute shader with a long straight-line function body
+static void BM_LargeComputeShader(benchmark::State& state)
+{
+	const auto instructionCount = static_cast<uint32_t>(state.range(0));
+	dynspv::ModuleGenerator generator{};
+	for (auto _ : state)
+	{
+		generator.reset();
+		generator.writeHeader(0x010000);
+		generator.OpCapability(spv::Capability::CapabilityShader);
+		generator.OpMemoryModel(spv::AddressingModel::AddressingModelLogical, spv::MemoryModel::MemoryModelGLSL450);
+		auto mainId = generator.nextId();
+		generator.OpEntryPoint(spv::ExecutionModel::ExecutionModelGLCompute, mainId, "main");
+		// Enumerant parameters are not part of the generated signatures
+		generator.writeInstruction(spv::Op::OpExecutionMode, 6, mainId, spv::ExecutionMode::ExecutionModeLocalSize, 64u, 1u, 1u);
+		auto voidTypeId = generator.nextId();
+		generator.OpTypeVoid(voidTypeId);
+		auto voidFunctionTypeId = generator.nextId();
+		generator.OpTypeFunction(voidFunctionTypeId, voidTypeId);
+		auto intTypeId = generator.nextId();
+		generator.OpTypeInt(intTypeId, 32, 1);
+		auto pointerTypeId = generator.nextId();
+		generator.OpTypePointer(pointerTypeId, spv::StorageClass::StorageClassFunction, intTypeId);
+		generator.OpFunction(voidTypeId, mainId, spv::FunctionControlMask::FunctionControlMaskNone, voidFunctionTypeId);
+		generator.OpLabel(generator.nextId());
+		auto variableId = generator.nextId();
+		generator.OpVariable(pointerTypeId, variableId, spv::StorageClass::StorageClassFunction);
+		for (uint32_t i = 0; i < instructionCount; i += 3)
+		{
+			auto valueId = generator.nextId();
+			generator.OpLoad(intTypeId, valueId, variableId);
+			auto sumId = generator.nextId();
+			generator.OpIAdd(intTypeId, sumId, valueId, valueId);
+			generator.OpStore(variableId, sumId);
+		}
+		generator.OpReturn();
+		generator.OpFunctionEnd();
+		generator.updateBound(generator.getBound());
+		benchmark::DoNotOptimize(generator.view().data());
+	}
+	reportThroughput(state, generator.view());
+}
+BENCHMARK(BM_LargeComputeShader)->Arg(1 << 12)->Arg(1 << 16);
+
+// Debug info, dominated by literal strings
+static void BM_DebugStrings(benchmark::State& state)
+{
+	const std::string source(4000, 'x');
+	std::vector<std::string> names;
+	for (size_t i = 0; i < 256; i++)
+	{
+		names.push_back("some_reasonably_long_variable_name_" + std::to_string(i));
+	}
+
+	dynspv::ModuleGenerator generator{};
+	for (auto _ : state)
+	{
+		generator.reset();
+		generator.writeHeader(0x010000);
+		auto fileId = generator.nextId();
+		generator.OpString(fileId, "shaders/some/directory/lighting.comp");
+		generator.OpSource(spv::SourceLanguage::SourceLanguageGLSL, 450, fileId, source);
+		for (auto&& name : names)
+		{
+			auto id = generator.nextId();
+			generator.OpName(id, name);
+			generator.OpMemberName(id, 0, name);
+		}
+		benchmark::DoNotOptimize(generator.view().data());
+	}
+	reportThroughput(state, generator.view());
+}
+BENCHMARK(BM_DebugStrings);
+
+// Large OpConstantComposite and OpSwitch tables
+static void BM_ConstantTables(benchmark::State& state)
+{
+	const auto tableSize = static_cast<uint32_t>(state.range(0));
+	std::vector<dynspv::IdRef> constituents;
+	std::vector<std::tuple<uint32_t, dynspv::IdRef>> targets;
+	for (uint32_t i = 0; i < tableSize; i++)
+	{
+		constituents.push_back(100 + i);
+		targets.emplace_back(i, 100 + tableSize + i);
+	}
+
+	dynspv::ModuleGenerator generator{};
+	for (auto _ : state)
+	{
+		generator.reset();
+		generator.writeHeader(0x010000);
+		auto floatTypeId = generator.nextId();
+		generator.OpTypeFloat(floatTypeId, 32);
+		for (uint32_t i = 0; i < tableSize; i++)
+		{
+			generator.OpConstant(floatTypeId, generator.nextId(), static_cast<float>(i));
+		}
+		generator.OpConstantComposite(floatTypeId, generator.nextId(), constituents);
+		generator.OpSwitch(1, 2, targets);
+		benchmark::DoNotOptimize(generator.view().data());
+	}
+	reportThroughput(state, generator.view());
+}
+BENCHMARK(BM_ConstantTables)->Arg(1 << 10)->Arg(1 << 14);
+
+// A float lookup table and its composite emitted in bulk
+static void BM_BulkConstantTables(benchmark::State& state)
+{
+	std::vector<float> table(static_cast<size_t>(state.range(0)));
+	for (size_t i = 0; i < table.size(); i++)
+	{
+		table[i] = static_cast<float>(i);
+	}
+
+	dynspv::ModuleGenerator generator{};
+	for (auto _ : state)
+	{
+		generator.reset();
+		generator.writeHeader(0x010000);
+		auto floatTypeId = generator.nextId();
+		generator.OpTypeFloat(floatTypeId, 32);
+		auto uintTypeId = generator.nextId();
+		generator.OpTypeInt(uintTypeId, 32, 0);
+		auto lengthId = generator.nextId();
+		generator.OpConstant(uintTypeId, lengthId, static_cast<uint32_t>(table.size()));
+		auto arrayTypeId = generator.nextId();
+		generator.OpTypeArray(arrayTypeId, floatTypeId, lengthId);
+		dynspv::writeConstantComposite(generator, arrayTypeId, floatTypeId, table);
+		benchmark::DoNotOptimize(generator.view().data());
+	}
+	reportThroughput(state, generator.view());
+}
+BENCHMARK(BM_BulkConstantTables)->Arg(1 << 10)->Arg(1 << 14);
+
+// The same OpSwitch table appended case by case, without building the target list first
+static void BM_SwitchBuilder(benchmark::State& state)
+{
+	const auto tableSize = static_cast<uint32_t>(state.range(0));
+	dynspv::ModuleGenerator generator{};
+	for (auto _ : state)
+	{
+		generator.reset();
+		generator.writeHeader(0x010000);
+		auto targets = generator.beginOpSwitch(1, 2);
+		for (uint32_t i = 0; i < tableSize; i++)
+		{
+			targets.add(i, 100 + tableSize + i);
+		}
+		targets.end();
+		benchmark::DoNotOptimize(generator.view().data());
+	}
+	reportThroughput(state, generator.view());
+}
+BENCHMARK(BM_SwitchBuilder)->Arg(1 << 10)->Arg(1 << 14);
@@ -33,7 +33,7 @@ def capitalize(s: str) -> str:
 
 literal_dict = {
     'LiteralInteger': 'uint32_t',
-    'LiteralString': 'std::string',
+    'LiteralString': 'std::string_view',
     'LiteralFloat': 'float',
     'LiteralContextDependentNumber': 'spvConstant auto',
     'LiteralExtInstInteger': 'uint32_t',
@@ -73,7 +73,7 @@ def get_cpp_type(operand: dict) -> str:
 
     match quantifier:
         case "?": cpp_type = f"std::optional<{cpp_type}>"
-        case "*": cpp_type = f"std::vector<{cpp_type}>"
+        case "*": cpp_type = f"OperandList<{cpp_type}>"
         case None: pass
         case _: raise NotImplementedError(f"Unexpected operand quantifier", quantifier)
 
@@ -122,20 +122,21 @@ def get_cpp_param(operand: dict) -> dict:
     }
 
 
+def is_simple_type(cpp_type: str) -> bool:
+    if cpp_type == "std::string_view" or cpp_type == "spvConstant auto":
+        return False
+    if cpp_type.startswith("std::optional"):
+        return False
+    if cpp_type.startswith("OperandList"):
+        return False
+    if cpp_type.startswith("std::tuple"):
+        return False
+    return True
+
+
 def get_word_count_code(cpp_params: list[dict]) -> str:
     word_count = 1
 
-    def is_simple_type(cpp_type: str) -> bool:
-        if cpp_type == "std::string" or cpp_type == "spvConstant auto":
-            return False
-        if cpp_type.startswith("std::optional"):
-            return False
-        if cpp_type.startswith("std::vector"):
-            return False
-        if cpp_type.startswith("std::tuple"):
-            return False
-        return True
-
     simple_types = map(lambda x: x["type"], cpp_params)
     simple_types = filter(is_simple_type, simple_types)
     word_count = word_count+len(list(simple_types))
@@ -147,18 +148,65 @@ def get_word_count_code(cpp_params: list[dict]) -> str:
     if len(non_simple_types_code) > 0:
         non_simple_types_code = f"countOperandsWord(wordCount,{non_simple_types_code});"
 
-    return f"""uint16_t wordCount = {word_count};
+    return f"""size_t wordCount = {word_count};
     {non_simple_types_code}"""
 
 
-def get_instruction_write_code(cpp_params: list[dict]) -> str:
+def get_instruction_write_code(opname: str, cpp_params: list[dict], receiver: str) -> str:
     write_code = map(lambda x: x["name"], cpp_params)
+    write_code = [f"spv::Op::{opname}", "wordCount", *write_code]
     write_code = ", ".join(write_code)
-    write_code = f"writeWords({write_code});"
+    write_code = f"{receiver}writeInstruction({write_code});"
     return write_code
 
 
-def get_instruction_code(instruction: dict) -> str:
+def get_fixed_instruction_write_code(opname: str, cpp_params: list[dict], receiver: str) -> str:
+    def get_word(cpp_param: dict) -> str:
+        cpp_type = cpp_param["type"]
+        name = cpp_param["name"]
+        if cpp_type.startswith("spv::"):
+            return f"static_cast<uint32_t>({name})"
+        if cpp_type == "float":
+            return f"std::bit_cast<uint32_t>({name})"
+        return name
+
+    word_count = len(cpp_params) + 1
+    words = map(get_word, cpp_params)
+    words = ", ".join(["header", *words])
+
+    return f"""constexpr uint32_t header = makeInstructionHeader(spv::Op::{opname}, {word_count});
+    {receiver}writeFixedInstruction({words});"""
+
+
+def get_instruction_body_code(opname: str, cpp_params: list[dict], receiver: str) -> str:
+    is_fixed_shape = all(map(lambda x: is_simple_type(x["type"]), cpp_params))
+    if is_fixed_shape:
+        return get_fixed_instruction_write_code(opname, cpp_params, receiver)
+
+    return f"""{get_word_count_code(cpp_params)}
+
+    {get_instruction_write_code(opname, cpp_params, receiver)}"""
+
+
+# Early return for instructions skipped while debug info is stripped
+def get_strip_debug_info_code(instruction: dict, receiver: str) -> str:
+    condition = None
+    match instruction["opname"]:
+        case "OpExtInstImport": condition = f"{receiver}stripExtInstImport(idResult, name)"
+        case "OpExtInst" | "OpExtInstWithForwardRefsKHR": condition = f"{receiver}getStripDebugInfo() && {receiver}isStrippedExtInstSet(set)"
+        case _ if instruction["class"] == "Debug": condition = f"{receiver}getStripDebugInfo()"
+        case _: return ""
+
+    return f"""if ({condition})
+    {{
+    return;
+    }}
+
+    """
+
+
+# Instructions of the core class are members of the generator, the others are written by a generator.
+def get_instruction_code(instruction: dict, in_mixin: bool = False) -> str:
     cpp_params = []
 
     if "operands" in instruction:
@@ -181,18 +229,13 @@ def get_instruction_code(instruction: dict) -> str:
 
     for instruction_operand in reversed(cpp_params):
         instruction_type = instruction_operand["type"]
-        if not (instruction_type.startswith("std::optional") or instruction_type.startswith("std::vector")):
+        if not (instruction_type.startswith("std::optional") or instruction_type.startswith("OperandList")):
             break
         instruction_operand["default_value"] = " = {}"
 
     def get_param_def(function_param: dict) -> str:
         x = function_param
         cpp_type = function_param['type']
-        if cpp_type == "std::string":
-            cpp_type = "const std::string&"
-        if cpp_type.startswith("std::vector"):
-            cpp_type = re.sub(r"std::vector<(.*)>",
-                              r"const std::vector<\1>&", cpp_type)
         if cpp_type.startswith("std::tuple"):
             cpp_type = re.sub(r"std::tuple<(.*)>",
                               r"const std::tuple<\1>&", cpp_type)
@@ -205,15 +248,146 @@ def get_instruction_code(instruction: dict) -> str:
     if len(cpp_params) > 1:
         function_params = "\n"+function_params
 
-    return f"""
-    void {opname}({function_params})
+    receiver = ""
+    generator_code = ""
+    instrumented_generator = "*this"
+    if in_mixin:
+        receiver = "generator."
+        generator_code = "TGenerator& generator = static_cast<TGenerator&>(*this);\n\n"
+        instrumented_generator = "generator"
+
+    instruction_code = f"""
+    constexpr void {opname}({function_params})
     {{
-    {get_word_count_code(cpp_params)}
+    {generator_code}{get_strip_debug_info_code(instruction, receiver)}DYNSPV_INSTRUMENT({instrumented_generator}, spv::Op::{opname});
 
-    writeWord(spv::Op::{opname}, wordCount);
-    {get_instruction_write_code(cpp_params)}
+    {get_instruction_body_code(opname, cpp_params, receiver)}
     }}"""
 
+    # Instructions ending with a variable operand list also get a builder appending it operand by operand
+    instruction_operands = instruction.get("operands", [])
+    if len(instruction_operands) == 0 or instruction_operands[-1].get("quantifier") != "*":
+        return instruction_code
+    if get_strip_debug_info_code(instruction, receiver) != "":
+        return instruction_code
+
+    begin_params = cpp_params[:-1]
+    begin_function_params = map(get_param_def, begin_params)
+    begin_function_params = ",\n".join(begin_function_params)
+    if len(begin_params) > 1:
+        begin_function_params = "\n"+begin_function_params
+    begin_args = map(lambda x: x["name"], begin_params)
+    begin_args = ", ".join(begin_args)
+
+    builder_generator = "TGenerator" if in_mixin else "BasicModuleGenerator"
+    builder_operand = get_base_cpp_type(instruction_operands[-1]["kind"])
+    builder_type = f"InstructionBuilder<{builder_generator}, {builder_operand}>"
+    builder_receiver = "generator" if in_mixin else "*this"
+
+    return f"""{instruction_code}
+
+    constexpr {builder_type} begin{opname}({begin_function_params})
+    {{
+    {generator_code}{receiver}beginInstruction({begin_args});
+    return {{{builder_receiver}, spv::Op::{opname}}};
+    }}"""
+
+
+# Vendor instruction sets split into their own headers, keyed by the opname suffixes they cover
+vendor_instruction_sets = {
+    "AMD": ["AMDX", "AMD"],
+    "EXT": ["EXT"],
+    "INTEL": ["INTEL"],
+    "KHR": ["KHR"],
+    "NV": ["NVX", "NV"],
+    "QCOM": ["QCOM"],
+}
+
+
+def get_instruction_set(instruction: dict) -> str | None:
+    for instruction_set, suffixes in vendor_instruction_sets.items():
+        if any(map(instruction["opname"].endswith, suffixes)):
+            return instruction_set
+    return None
+
+
+def get_instruction_set_class(instruction_set: str) -> str:
+    return f"{capitalize(instruction_set.lower())}Instructions"
+
+
+def get_instruction_set_header(instruction_set: str) -> str:
+    return f"dynspv_{instruction_set.lower()}.hpp"
+
+
+def get_instruction_set_header_code(instruction_set: str, instructions: list[dict]) -> str:
+    instructions = map(lambda x: get_instruction_code(x, True), instructions)
+    instructions = "\n".join(instructions).lstrip()
+    return f"""// SPDX-License-Identifier: MPL-2.0
+
+    #pragma once
+
+    #include <dynspv_base.hpp>
+
+    namespace dynspv
+    {{
+    // Instructions with the {instruction_set} suffix, mixed into generators listing it in their InstructionSets
+    template<typename TGenerator>
+    class {get_instruction_set_class(instruction_set)}
+    {{
+    public:
+    {instructions}
+    }};
+    }} // namespace dynspv
+    """
+
+
+def get_instruction_set_macro(instruction_set: str) -> str:
+    return f"DYNSPV_ENABLE_{instruction_set}_INSTRUCTIONS"
+
+
+def get_umbrella_header_code() -> str:
+    none_enabled = map(lambda x: f"!defined({get_instruction_set_macro(x)})", vendor_instruction_sets)
+    none_enabled = " && ".join(none_enabled)
+    enable_all = map(lambda x: f"#define {get_instruction_set_macro(x)}", vendor_instruction_sets)
+    enable_all = "\n".join(enable_all)
+
+    def get_selection_code(instruction_set: str) -> str:
+        return f"""#if defined({get_instruction_set_macro(instruction_set)})
+        #include <{get_instruction_set_header(instruction_set)}>
+        #define DYNSPV_{instruction_set}_INSTRUCTION_SET , dynspv::{get_instruction_set_class(instruction_set)}
+        #else
+        #define DYNSPV_{instruction_set}_INSTRUCTION_SET
+        #endif"""
+
+    selections = "\n\n".join(map(get_selection_code, vendor_instruction_sets))
+    selected_sets = " ".join(map(lambda x: f"DYNSPV_{x}_INSTRUCTION_SET", vendor_instruction_sets))
+    return f"""// SPDX-License-Identifier: MPL-2.0
+
+    #pragma once
+
+    // Generators get every instruction set by default. To compile only some of them, define the matching
+    // DYNSPV_ENABLE_<SET>_INSTRUCTIONS macros, e.g. DYNSPV_ENABLE_KHR_INSTRUCTIONS, before including this header.
+    // Only the headers of those sets are included.
+    #if {none_enabled}
+    {enable_all}
+    #endif
+
+    {selections}
+
+    // The selected sets start with a comma, the first argument only swallows it. The extra expansion lets the
+    // traditional MSVC preprocessor split __VA_ARGS__ into arguments.
+    #define DYNSPV_EXPAND(x) x
+    #define DYNSPV_SELECTED_INSTRUCTION_SETS(none, ...) __VA_ARGS__
+    #define DYNSPV_SELECT_INSTRUCTION_SETS(...) DYNSPV_EXPAND(DYNSPV_SELECTED_INSTRUCTION_SETS(__VA_ARGS__))
+
+    #ifndef DYNSPV_INSTRUCTION_SETS
+    #define DYNSPV_INSTRUCTION_SETS DYNSPV_SELECT_INSTRUCTION_SETS(void {selected_sets})
+    #endif
+
+    #include <dynspv_core.hpp>
+    #include <dynspv_reader.hpp>
+    """
+
 
 def get_spv_ids_types():
     id_operands = spirv_grammar["operand_kinds"]
@@ -224,21 +398,218 @@ def get_spv_ids_types():
     return id_operands
 
 
-lib_path = "include/dynspv.hpp"
+def get_instruction_opcodes_code() -> str:
+    instructions = sorted(spirv_grammar["instructions"], key=lambda x: x["opcode"])
+    opcodes = map(lambda x: f"spv::Op::{x['opname']},", instructions)
+    opcodes = "\n".join(opcodes)
+    return f"""// Opcodes of the grammar in ascending order
+    inline constexpr spv::Op INSTRUCTION_OPCODES[] = {{
+    {opcodes}
+    }};"""
 
-with open("dynspv.hpp_template", "r") as file:
-    lib_core_content = file.read()
 
-with open(lib_path, "w") as file:
-    instructions = spirv_grammar["instructions"]
-    instructions = sorted(instructions, key=lambda x: x["opname"])
-    instructions = map(get_instruction_code, instructions)
-    instructions = "\n".join(instructions)
+def get_operand_kinds_code() -> str:
+    operand_kinds = map(lambda x: f"{x['kind']},", spirv_grammar["operand_kinds"])
+    operand_kinds = "\n".join(operand_kinds)
+    return f"""enum class OperandKind : uint8_t
+    {{
+    {operand_kinds}
+    }};"""
+
+
+def get_operand_description(operand: dict) -> str:
+    quantifier = None
+    if "quantifier" in operand:
+        quantifier = operand["quantifier"]
+
+    match quantifier:
+        case "?": quantifier = "Optional"
+        case "*": quantifier = "Variadic"
+        case None: quantifier = "One"
+        case _: raise NotImplementedError(f"Unexpected operand quantifier", quantifier)
+
+    return f"{{OperandKind::{operand['kind']}, OperandQuantifier::{quantifier}}},"
+
+
+def get_operand_tables_code() -> str:
+    descriptions = []
+    description_count = 0
+
+    # Returns the subspan of OPERAND_DESCRIPTIONS holding the given operands
+    def add_descriptions(comment: str, operand_list: list[dict]) -> str:
+        nonlocal description_count
+        offset = description_count
+        description_count += len(operand_list)
+        descriptions.append(f"// {comment}")
+        descriptions.extend(map(get_operand_description, operand_list))
+        return f"return std::span{{OPERAND_DESCRIPTIONS}}.subspan({offset}, {len(operand_list)});"
+
+    categories = []
+    for operand_kind in spirv_grammar["operand_kinds"]:
+        categories.append(f"""case OperandKind::{operand_kind['kind']}:
+        return OperandCategory::{operand_kind['category']};""")
+    categories = "\n".join(categories)
+
+    composite_cases = []
+    enumerant_cases = []
+    for operand_kind in spirv_grammar["operand_kinds"]:
+        kind = operand_kind["kind"]
+        if operand_kind["category"] == "Composite":
+            bases = map(lambda x: {"kind": x}, operand_kind["bases"])
+            composite_cases.append(f"""case OperandKind::{kind}:
+            {add_descriptions(kind, list(bases))}""")
+
+        value_cases = []
+        seen_values = set()
+        for enumerant in operand_kind.get("enumerants", []):
+            value = enumerant["value"]
+            if isinstance(value, str):
+                value = int(value, 16)
+            if "parameters" not in enumerant or value in seen_values:
+                continue
+            seen_values.add(value)
+            value_cases.append(f"""case {value}:
+            {add_descriptions(f"{kind} {enumerant['enumerant']}", enumerant["parameters"])}""")
+        if len(value_cases) > 0:
+            value_cases = "\n".join(value_cases)
+            enumerant_cases.append(f"""case OperandKind::{kind}:
+            switch (value)
+            {{
+            {value_cases}
+            }}
+            break;""")
+    composite_cases = "\n".join(composite_cases)
+    enumerant_cases = "\n".join(enumerant_cases)
+
+    instruction_cases = []
+    instructions = sorted(spirv_grammar["instructions"], key=lambda x: x["opcode"])
+    for instruction in instructions:
+        if "operands" not in instruction:
+            continue
+        opname = instruction["opname"]
+        instruction_cases.append(f"""case spv::Op::{opname}:
+        {add_descriptions(opname, instruction["operands"])}""")
+    instruction_cases = "\n".join(instruction_cases)
+
+    descriptions = "\n".join(descriptions)
+
+    return f"""constexpr OperandCategory getOperandCategory(OperandKind kind)
+    {{
+    switch (kind)
+    {{
+    {categories}
+    }}
+    return OperandCategory::Literal;
+    }}
 
-    lib_core_content = lib_core_content.replace(
-        "#generated_code", instructions)
-    lib_core_content = lib_core_content.replace(
-        "#generated_spv_id_types", get_spv_ids_types())
-    file.write(lib_core_content.replace("#generated_code", instructions))
+    inline constexpr OperandDescription OPERAND_DESCRIPTIONS[] = {{
+    {descriptions}
+    }};
+
+    // Members of a composite operand kind
+    constexpr std::span<const OperandDescription> getCompositeBases(OperandKind kind)
+    {{
+    switch (kind)
+    {{
+    {composite_cases}
+    default:
+    return {{}};
+    }}
+    }}
+
+    // Operands following an enumerant, for BitEnum kinds value must be a single bit
+    constexpr std::span<const OperandDescription> getEnumerantParameters(OperandKind kind, uint32_t value)
+    {{
+    switch (kind)
+    {{
+    {enumerant_cases}
+    default:
+    break;
+    }}
+    return {{}};
+    }}
+
+    // Logical operands of an instruction, the header word is not included
+    constexpr std::span<const OperandDescription> getInstructionOperands(spv::Op opcode)
+    {{
+    switch (opcode)
+    {{
+    {instruction_cases}
+    default:
+    return {{}};
+    }}
+    }}"""
+
+
+# Everything the instruction set headers need, the generator class and its users follow them in the core header.
+# The operand tables of every instruction set and the code reading modules back go to the reader header.
+def split_core_header(content: str) -> tuple[str, str, str]:
+    base_content, core_content = content.split("#generated_core_header")
+    core_content, reader_content = core_content.split("#generated_reader_header")
+    base_content += "} // namespace dynspv\n"
+    core_content = f"""// SPDX-License-Identifier: MPL-2.0
+
+    #pragma once
+
+    #include <dynspv_base.hpp>
+
+    namespace dynspv
+    {{{core_content}}} // namespace dynspv
+    """
+    reader_content = f"""// SPDX-License-Identifier: MPL-2.0
+
+    #pragma once
+
+    #include <dynspv_core.hpp>
+
+    namespace dynspv
+    {{{reader_content}"""
+    return base_content, core_content, reader_content
+
+
+base_path = "include/dynspv_base.hpp"
+core_path = "include/dynspv_core.hpp"
+reader_path = "include/dynspv_reader.hpp"
+umbrella_path = "include/dynspv.hpp"
+
+with open("dynspv.hpp_template", "r") as file:
+    lib_core_content = file.read()
 
-run_clang_format(lib_path)
+instruction_sets = {x: [] for x in vendor_instruction_sets}
+core_instructions = []
+for instruction in sorted(spirv_grammar["instructions"], key=lambda x: x["opname"]):
+    instruction_set = get_instruction_set(instruction)
+    if instruction_set is None:
+        core_instructions.append(instruction)
+    else:
+        instruction_sets[instruction_set].append(instruction)
+
+instructions = map(get_instruction_code, core_instructions)
+instructions = "\n".join(instructions)
+
+lib_core_content = lib_core_content.replace(
+    "#generated_spv_id_types", get_spv_ids_types())
+lib_core_content = lib_core_content.replace(
+    "#generated_instruction_opcodes", get_instruction_opcodes_code())
+lib_core_content = lib_core_content.replace(
+    "#generated_operand_kinds", get_operand_kinds_code())
+lib_core_content = lib_core_content.replace(
+    "#generated_operand_tables", get_operand_tables_code())
+lib_core_content = lib_core_content.replace("#generated_code", instructions)
+lib_base_content, lib_core_content, lib_reader_content = split_core_header(lib_core_content)
+
+for path, content in [(base_path, lib_base_content), (core_path, lib_core_content), (reader_path, lib_reader_content)]:
+    with open(path, "w") as file:
+        file.write(content)
+    run_clang_format(path)
+
+for instruction_set, instructions in instruction_sets.items():
+    header_path = f"include/{get_instruction_set_header(instruction_set)}"
+    with open(header_path, "w") as file:
+        file.write(get_instruction_set_header_code(instruction_set, instructions))
+    run_clang_format(header_path)
+
+with open(umbrella_path, "w") as file:
+    file.write(get_umbrella_header_code())
+
+run_clang_format(umbrella_path)
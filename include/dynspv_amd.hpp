@@ -0,0 +1,268 @@
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include <dynspv_base.hpp>
+
+namespace dynspv
+{
+	// Instructions with the AMD suffix, mixed into generators listing it in their InstructionSets
+	template<typename TGenerator>
+	class AmdInstructions
+	{
+	  public:
+		constexpr void OpAllocateNodePayloadsAMDX(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope visibility,
+			IdRef payloadCount,
+			IdRef nodeIndex)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpAllocateNodePayloadsAMDX);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAllocateNodePayloadsAMDX, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, visibility, payloadCount, nodeIndex);
+		}
+
+		constexpr void OpConstantStringAMDX(
+			IdResult idResult,
+			std::string_view literalString)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpConstantStringAMDX);
+
+			size_t wordCount = 2;
+			countOperandsWord(wordCount, literalString);
+
+			generator.writeInstruction(spv::Op::OpConstantStringAMDX, wordCount, idResult, literalString);
+		}
+
+		constexpr void OpEnqueueNodePayloadsAMDX(IdRef payloadArray)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpEnqueueNodePayloadsAMDX);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpEnqueueNodePayloadsAMDX, 2);
+			generator.writeFixedInstruction(header, payloadArray);
+		}
+
+		constexpr void OpFinishWritingNodePayloadAMDX(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpFinishWritingNodePayloadAMDX);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFinishWritingNodePayloadAMDX, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpFragmentFetchAMD(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef image,
+			IdRef coordinate,
+			IdRef fragmentIndex)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpFragmentFetchAMD);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFragmentFetchAMD, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, image, coordinate, fragmentIndex);
+		}
+
+		constexpr void OpFragmentMaskFetchAMD(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef image,
+			IdRef coordinate)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpFragmentMaskFetchAMD);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFragmentMaskFetchAMD, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, image, coordinate);
+		}
+
+		constexpr void OpGroupFAddNonUniformAMD(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef X)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpGroupFAddNonUniformAMD);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupFAddNonUniformAMD, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, execution, static_cast<uint32_t>(operation), X);
+		}
+
+		constexpr void OpGroupFMaxNonUniformAMD(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef X)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpGroupFMaxNonUniformAMD);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupFMaxNonUniformAMD, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, execution, static_cast<uint32_t>(operation), X);
+		}
+
+		constexpr void OpGroupFMinNonUniformAMD(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef X)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpGroupFMinNonUniformAMD);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupFMinNonUniformAMD, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, execution, static_cast<uint32_t>(operation), X);
+		}
+
+		constexpr void OpGroupIAddNonUniformAMD(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef X)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpGroupIAddNonUniformAMD);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupIAddNonUniformAMD, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, execution, static_cast<uint32_t>(operation), X);
+		}
+
+		constexpr void OpGroupSMaxNonUniformAMD(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef X)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpGroupSMaxNonUniformAMD);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupSMaxNonUniformAMD, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, execution, static_cast<uint32_t>(operation), X);
+		}
+
+		constexpr void OpGroupSMinNonUniformAMD(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef X)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpGroupSMinNonUniformAMD);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupSMinNonUniformAMD, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, execution, static_cast<uint32_t>(operation), X);
+		}
+
+		constexpr void OpGroupUMaxNonUniformAMD(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef X)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpGroupUMaxNonUniformAMD);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupUMaxNonUniformAMD, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, execution, static_cast<uint32_t>(operation), X);
+		}
+
+		constexpr void OpGroupUMinNonUniformAMD(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef X)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpGroupUMinNonUniformAMD);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupUMinNonUniformAMD, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, execution, static_cast<uint32_t>(operation), X);
+		}
+
+		constexpr void OpIsNodePayloadValidAMDX(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payloadType,
+			IdRef nodeIndex)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpIsNodePayloadValidAMDX);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpIsNodePayloadValidAMDX, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, payloadType, nodeIndex);
+		}
+
+		constexpr void OpNodePayloadArrayLengthAMDX(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payloadArray)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpNodePayloadArrayLengthAMDX);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpNodePayloadArrayLengthAMDX, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payloadArray);
+		}
+
+		constexpr void OpSpecConstantStringAMDX(
+			IdResult idResult,
+			std::string_view literalString)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSpecConstantStringAMDX);
+
+			size_t wordCount = 2;
+			countOperandsWord(wordCount, literalString);
+
+			generator.writeInstruction(spv::Op::OpSpecConstantStringAMDX, wordCount, idResult, literalString);
+		}
+
+		constexpr void OpTypeNodePayloadArrayAMDX(
+			IdResult idResult,
+			IdRef payloadType)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeNodePayloadArrayAMDX);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeNodePayloadArrayAMDX, 3);
+			generator.writeFixedInstruction(header, idResult, payloadType);
+		}
+	};
+} // namespace dynspv
\ No newline at end of file
@@ -0,0 +1,332 @@
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <dynspv.hpp>
+#include <dynspv_batch.hpp>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#define DYNSPV_UNDEF_NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#define DYNSPV_UNDEF_WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#ifdef DYNSPV_UNDEF_NOMINMAX
+#undef NOMINMAX
+#undef DYNSPV_UNDEF_NOMINMAX
+#endif
+#ifdef DYNSPV_UNDEF_WIN32_LEAN_AND_MEAN
+#undef WIN32_LEAN_AND_MEAN
+#undef DYNSPV_UNDEF_WIN32_LEAN_AND_MEAN
+#endif
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace dynspv
+{
+	// Archive layout, in host byte order: ArchiveHeader, entryCount ArchiveEntry sorted by key hash,
+	// then the modules back to back. Every part is a whole number of words, so mapped modules are 4-byte aligned.
+	constexpr uint32_t ARCHIVE_MAGIC_NUMBER = 0x41505344; // "DSPA"
+	constexpr uint32_t ARCHIVE_VERSION = 1;
+
+	struct ArchiveHeader
+	{
+		uint32_t magicNumber = ARCHIVE_MAGIC_NUMBER;
+		uint32_t version = ARCHIVE_VERSION;
+		uint32_t entryCount = 0;
+		uint32_t reserved = 0;
+	};
+
+	struct ArchiveEntry
+	{
+		uint64_t keyHash = 0;
+		// In words from the start of the archive
+		uint64_t offset = 0;
+		uint32_t wordCount = 0;
+		uint32_t bound = 0;
+	};
+
+	constexpr size_t ARCHIVE_HEADER_WORDS = sizeof(ArchiveHeader) / sizeof(uint32_t);
+	constexpr size_t ARCHIVE_ENTRY_WORDS = sizeof(ArchiveEntry) / sizeof(uint32_t);
+	static_assert(sizeof(ArchiveHeader) == 16 && sizeof(ArchiveEntry) == 24);
+
+	// Collects modules and writes them as one archive, the modules are not copied and must outlive write()
+	class ArchiveWriter
+	{
+	  protected:
+		struct PendingModule
+		{
+			uint64_t keyHash;
+			std::span<const uint32_t> code;
+		};
+
+		std::vector<PendingModule> m_modules;
+
+	  public:
+		void add(uint64_t keyHash, std::span<const uint32_t> code)
+		{
+			if (code.size() < HEADER_SIZE)
+			{
+				throw std::invalid_argument("dynspv: archived module has no header");
+			}
+
+			m_modules.push_back({keyHash, code});
+		}
+
+		// Adds module i of batch with the key keyHashes[i]
+		void addBatch(const ModuleBatch& batch, std::span<const uint64_t> keyHashes)
+		{
+			if (keyHashes.size() != batch.size())
+			{
+				throw std::invalid_argument("dynspv: one key is needed per batched module");
+			}
+
+			for (size_t i = 0; i < batch.size(); i++)
+			{
+				add(keyHashes[i], batch.getModule(i));
+			}
+		}
+
+		void write(std::FILE* file)
+		{
+			std::stable_sort(m_modules.begin(), m_modules.end(), [](auto&& a, auto&& b) { return a.keyHash < b.keyHash; });
+
+			const ArchiveHeader header{.entryCount = static_cast<uint32_t>(m_modules.size())};
+			std::vector<ArchiveEntry> entries;
+			entries.reserve(m_modules.size());
+			uint64_t offset = ARCHIVE_HEADER_WORDS + m_modules.size() * ARCHIVE_ENTRY_WORDS;
+			for (auto&& module : m_modules)
+			{
+				entries.push_back({module.keyHash, offset, static_cast<uint32_t>(module.code.size()), module.code[BOUND_INDEX]});
+				offset += module.code.size();
+			}
+
+			bool written = std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+				std::fwrite(entries.data(), sizeof(ArchiveEntry), entries.size(), file) == entries.size();
+			for (auto&& module : m_modules)
+			{
+				written = written && std::fwrite(module.code.data(), sizeof(uint32_t), module.code.size(), file) == module.code.size();
+			}
+			if (!written || std::fflush(file) != 0)
+			{
+				throw std::runtime_error("dynspv: failed to write archive");
+			}
+		}
+	};
+
+	// Read-only view over archive words, checks the header and the index once and hands out module spans without copying
+	class ArchiveView
+	{
+	  protected:
+		std::span<const uint32_t> m_words;
+		size_t m_entryCount = 0;
+
+	  public:
+		ArchiveView() = default;
+
+		explicit ArchiveView(std::span<const uint32_t> words)
+			: m_words(words)
+		{
+			ArchiveHeader header{};
+			if (words.size() >= ARCHIVE_HEADER_WORDS)
+			{
+				std::memcpy(static_cast<void*>(&header), words.data(), sizeof(header));
+			}
+			if (words.size() < ARCHIVE_HEADER_WORDS || header.magicNumber != ARCHIVE_MAGIC_NUMBER || header.version != ARCHIVE_VERSION ||
+				header.entryCount > (words.size() - ARCHIVE_HEADER_WORDS) / ARCHIVE_ENTRY_WORDS)
+			{
+				throw std::invalid_argument("dynspv: not a module archive");
+			}
+
+			m_entryCount = header.entryCount;
+			for (size_t i = 0; i < m_entryCount; i++)
+			{
+				const ArchiveEntry entry = getEntry(i);
+				if (entry.offset > words.size() || entry.wordCount > words.size() - entry.offset)
+				{
+					throw std::invalid_argument("dynspv: archive entry is out of bounds");
+				}
+			}
+		}
+
+		size_t size() const
+		{
+			return m_entryCount;
+		}
+
+		// Entries are copied out, the index is only guaranteed to be 4-byte aligned
+		ArchiveEntry getEntry(size_t index) const
+		{
+			ArchiveEntry entry{};
+			std::memcpy(static_cast<void*>(&entry), m_words.data() + ARCHIVE_HEADER_WORDS + index * ARCHIVE_ENTRY_WORDS, sizeof(entry));
+			return entry;
+		}
+
+		std::span<const uint32_t> getModule(size_t index) const
+		{
+			const ArchiveEntry entry = getEntry(index);
+			return m_words.subspan(entry.offset, entry.wordCount);
+		}
+
+		// Binary search over the sorted index, returns the first module stored with keyHash
+		std::optional<std::span<const uint32_t>> find(uint64_t keyHash) const
+		{
+			size_t begin = 0;
+			size_t end = m_entryCount;
+			while (begin < end)
+			{
+				const size_t middle = begin + (end - begin) / 2;
+				if (getEntry(middle).keyHash < keyHash)
+				{
+					begin = middle + 1;
+				}
+				else
+				{
+					end = middle;
+				}
+			}
+
+			if (begin == m_entryCount || getEntry(begin).keyHash != keyHash)
+			{
+				return std::nullopt;
+			}
+			return getModule(begin);
+		}
+	};
+
+	// Maps an archive file read-only, module spans stay valid for the lifetime of the mapping
+	class MappedArchive
+	{
+	  protected:
+		const void* m_data = nullptr;
+		size_t m_size = 0;
+#if defined(_WIN32)
+		HANDLE m_mapping = nullptr;
+#endif
+		ArchiveView m_view;
+
+		void unmap()
+		{
+			if (m_data == nullptr)
+			{
+				return;
+			}
+#if defined(_WIN32)
+			UnmapViewOfFile(m_data);
+			CloseHandle(m_mapping);
+			m_mapping = nullptr;
+#else
+			munmap(const_cast<void*>(m_data), m_size);
+#endif
+			m_data = nullptr;
+			m_size = 0;
+		}
+
+	  public:
+		explicit MappedArchive(const std::filesystem::path& path)
+		{
+#if defined(_WIN32)
+			HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			LARGE_INTEGER size{};
+			if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &size))
+			{
+				if (file != INVALID_HANDLE_VALUE)
+				{
+					CloseHandle(file);
+				}
+				throw std::runtime_error("dynspv: failed to open archive");
+			}
+
+			m_mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			CloseHandle(file);
+			m_data = m_mapping != nullptr ? MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+			if (m_data == nullptr)
+			{
+				if (m_mapping != nullptr)
+				{
+					CloseHandle(m_mapping);
+				}
+				throw std::runtime_error("dynspv: failed to map archive");
+			}
+			m_size = static_cast<size_t>(size.QuadPart);
+#else
+			const int file = open(path.c_str(), O_RDONLY);
+			struct stat status{};
+			if (file < 0 || fstat(file, &status) != 0)
+			{
+				if (file >= 0)
+				{
+					close(file);
+				}
+				throw std::runtime_error("dynspv: failed to open archive");
+			}
+
+			m_size = static_cast<size_t>(status.st_size);
+			void* data = m_size != 0 ? mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, file, 0) : MAP_FAILED;
+			close(file);
+			if (data == MAP_FAILED)
+			{
+				throw std::runtime_error("dynspv: failed to map archive");
+			}
+			m_data = data;
+#endif
+
+			try
+			{
+				m_view = ArchiveView{{static_cast<const uint32_t*>(m_data), m_size / sizeof(uint32_t)}};
+			}
+			catch (...)
+			{
+				unmap();
+				throw;
+			}
+		}
+
+		MappedArchive(MappedArchive&& other) noexcept
+			: m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0)),
+#if defined(_WIN32)
+			  m_mapping(std::exchange(other.m_mapping, nullptr)),
+#endif
+			  m_view(std::exchange(other.m_view, {}))
+		{
+		}
+
+		MappedArchive(const MappedArchive&) = delete;
+		MappedArchive& operator=(const MappedArchive&) = delete;
+		MappedArchive& operator=(MappedArchive&&) = delete;
+
+		~MappedArchive()
+		{
+			unmap();
+		}
+
+		const ArchiveView& getView() const
+		{
+			return m_view;
+		}
+
+		std::optional<std::span<const uint32_t>> find(uint64_t keyHash) const
+		{
+			return m_view.find(keyHash);
+		}
+	};
+} // namespace dynspv
@@ -0,0 +1,1826 @@
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <spirv/unified1/spirv.hpp>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace dynspv
+{
+	template<typename T>
+	concept spvConstant = (std::integral<T> || std::floating_point<T>);
+
+	using IdMemorySemantics = spv::Id;
+	using IdRef = spv::Id;
+	using IdResult = spv::Id;
+	using IdResultType = spv::Id;
+	using IdScope = spv::Id;
+
+	// Non-owning view over variadic operands, accepts vectors, arrays, spans and braced lists
+	template<typename T>
+	class OperandList : public std::span<const T>
+	{
+	  public:
+		using std::span<const T>::span;
+
+		constexpr OperandList() = default;
+
+		constexpr OperandList(std::initializer_list<T> list)
+			: std::span<const T>(list.begin(), list.size())
+		{
+		}
+	};
+
+	constexpr void countOperandWord(size_t& wordCount, spvConstant auto operand)
+	{
+		wordCount += ((sizeof(decltype(operand)) + 3) & ~0x3) / sizeof(uint32_t);
+	}
+
+	constexpr void countOperandWord(size_t& wordCount, std::string_view operand)
+	{
+		wordCount += operand.size() / sizeof(uint32_t) + 1;
+	}
+
+	constexpr void countOperandWord(size_t& wordCount, uint32_t)
+	{
+		wordCount++;
+	}
+
+	template<typename... TArgs>
+	constexpr void countOperandWord(size_t& wordCount, const std::tuple<TArgs...>& operand)
+	{
+		std::apply([&wordCount](auto&... args) { (countOperandWord(wordCount, args), ...); }, operand);
+	}
+
+	template<typename T>
+	constexpr void countOperandWord(size_t& wordCount, const std::optional<T>& operand)
+	{
+		if (operand.has_value())
+		{
+			countOperandWord(wordCount, operand.value());
+		}
+	}
+
+	template<typename T>
+	constexpr void countOperandWord(size_t& wordCount, const std::vector<T>& operand)
+	{
+		for (auto&& el : operand)
+		{
+			countOperandWord(wordCount, el);
+		}
+	}
+
+	template<typename T>
+	constexpr void countOperandWord(size_t& wordCount, const OperandList<T>& operand)
+	{
+		for (auto&& el : operand)
+		{
+			countOperandWord(wordCount, el);
+		}
+	}
+
+	template<typename... TArgs>
+	constexpr void countOperandsWord(size_t& wordCount, const TArgs&... args)
+	{
+		(countOperandWord(wordCount, args), ...);
+	}
+
+	constexpr void encodeWord(uint32_t*& words, uint32_t val)
+	{
+		*words++ = val;
+	}
+
+	constexpr void encodeWord(uint32_t*& words, spvConstant auto val)
+	{
+		using T = decltype(val);
+
+		if constexpr (sizeof(T) < sizeof(uint32_t))
+		{
+			// Narrow literals are sign or zero extended to a full word
+			using TWord = std::conditional_t<std::is_signed_v<T>, int32_t, uint32_t>;
+			*words++ = static_cast<uint32_t>(static_cast<TWord>(val));
+		}
+		else
+		{
+			constexpr size_t words_count = sizeof(T) / sizeof(uint32_t);
+			auto vals = std::bit_cast<std::array<uint32_t, words_count>>(val);
+
+			for (size_t i = 0; i < words_count; i++)
+			{
+				*words++ = vals[i];
+			}
+		}
+	}
+
+	// Packs up to four bytes of string starting at offset, the first byte goes into the lowest bits
+	constexpr uint32_t packStringWord(std::string_view string, size_t offset)
+	{
+		uint32_t word = 0;
+		for (size_t i = offset; i < std::min(string.size(), offset + sizeof(uint32_t)); i++)
+		{
+			word |= static_cast<uint32_t>(static_cast<uint8_t>(string[i])) << ((i - offset) * 8);
+		}
+		return word;
+	}
+
+	constexpr void encodeWord(uint32_t*& words, std::string_view string)
+	{
+		const size_t size = string.size() / sizeof(uint32_t);
+
+		if (std::is_constant_evaluated() || std::endian::native != std::endian::little || string.empty())
+		{
+			for (size_t i = 0; i < size; i++)
+			{
+				*words++ = packStringWord(string, i * sizeof(uint32_t));
+			}
+		}
+		else
+		{
+			// Whole words are copied in one go, only the tail is assembled separately
+			std::memcpy(words, string.data(), size * sizeof(uint32_t));
+			words += size;
+
+			*words++ = packStringWord(string, size * sizeof(uint32_t));
+			return;
+		}
+
+		// Also terminates strings whose size is a multiple of four with a zero word
+		*words++ = packStringWord(string, size * sizeof(uint32_t));
+	}
+
+	template<typename... TArgs>
+	constexpr void encodeWord(uint32_t*& words, const std::tuple<TArgs...>& val)
+	{
+		std::apply([&words](auto&... args) { (encodeWord(words, args), ...); }, val);
+	}
+
+	template<typename T>
+		requires std::is_enum_v<T>
+	constexpr void encodeWord(uint32_t*& words, T val)
+	{
+		*words++ = static_cast<uint32_t>(val);
+	}
+
+	template<typename T>
+	constexpr void encodeWord(uint32_t*& words, const std::vector<T>& values)
+	{
+		for (auto&& val : values)
+		{
+			encodeWord(words, val);
+		}
+	}
+
+	template<typename T>
+	constexpr void encodeWord(uint32_t*& words, const OperandList<T>& values)
+	{
+		for (auto&& val : values)
+		{
+			encodeWord(words, val);
+		}
+	}
+
+	template<typename T>
+	constexpr void encodeWord(uint32_t*& words, const std::optional<T>& word)
+	{
+		if (word.has_value())
+		{
+			encodeWord(words, word.value());
+		}
+	}
+
+	template<typename... TArgs>
+	constexpr void encodeWords(uint32_t*& words, const TArgs&... args)
+	{
+		(encodeWord(words, args), ...);
+	}
+
+	constexpr uint32_t makeInstructionHeader(spv::Op opcode, uint16_t wordCount)
+	{
+		return (static_cast<uint32_t>(wordCount) << 16) | static_cast<uint32_t>(opcode);
+	}
+
+	// The header stores the word count in 16 bits, longer instructions cannot be encoded
+	constexpr size_t MAX_INSTRUCTION_WORD_COUNT = std::numeric_limits<uint16_t>::max();
+
+	constexpr void checkInstructionWordCount(size_t wordCount)
+	{
+		if (wordCount > MAX_INSTRUCTION_WORD_COUNT)
+		{
+			throw std::length_error("dynspv: instruction exceeds 65535 words");
+		}
+	}
+
+	// One instruction per value: the same header and type, the next id, then the value words
+	template<spvConstant T>
+	constexpr void encodeConstants(uint32_t*& words, uint32_t header, uint32_t type, uint32_t firstId, std::span<const T> values)
+	{
+		size_t i = 0;
+#if defined(__AVX2__)
+		if constexpr (sizeof(T) == sizeof(uint32_t))
+		{
+			if (!std::is_constant_evaluated())
+			{
+				// Four instructions of four words per iteration, the values are spread to every fourth word
+				__m256i instructions = _mm256_setr_epi32(header, type, firstId, 0, header, type, firstId + 1, 0);
+				const __m256i idStep = _mm256_setr_epi32(0, 0, 2, 0, 0, 0, 2, 0);
+				const __m256i lowValues = _mm256_setr_epi32(0, 0, 0, 0, 0, 0, 0, 1);
+				const __m256i highValues = _mm256_setr_epi32(0, 0, 0, 2, 0, 0, 0, 3);
+				for (; i + 4 <= values.size(); i += 4)
+				{
+					const __m256i block = _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values.data() + i)));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(words), _mm256_blend_epi32(instructions, _mm256_permutevar8x32_epi32(block, lowValues), 0x88));
+					instructions = _mm256_add_epi32(instructions, idStep);
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(words + 8), _mm256_blend_epi32(instructions, _mm256_permutevar8x32_epi32(block, highValues), 0x88));
+					instructions = _mm256_add_epi32(instructions, idStep);
+					words += 16;
+				}
+			}
+		}
+#endif
+		for (; i < values.size(); i++)
+		{
+			*words++ = header;
+			*words++ = type;
+			*words++ = firstId + static_cast<uint32_t>(i);
+			encodeWord(words, values[i]);
+		}
+	}
+
+	constexpr size_t DEFAULT_MAX_CODE_SIZE = 1024;
+	constexpr size_t BOUND_INDEX = 3;
+	constexpr size_t HEADER_SIZE = 5;
+
+	template<typename T>
+	concept spvSink = requires(T& sink, const T& constSink, size_t count, size_t index, uint32_t word) {
+		{ sink.reserve(count) } -> std::same_as<uint32_t*>;
+		{ constSink.size() } -> std::convertible_to<size_t>;
+		sink.patch(index, word);
+	};
+
+	// Default sink, owns a growable buffer allocated with TAllocator
+	template<typename TAllocator = std::allocator<uint32_t>>
+	class BasicVectorSink
+	{
+	  public:
+		using Code = std::vector<uint32_t, TAllocator>;
+
+	  protected:
+		Code m_code;
+		size_t m_size{0};
+
+		constexpr void growMemory(size_t minSize)
+		{
+			// getCode() shrinks the buffer but keeps its capacity, reuse it before doubling
+			size_t newSize = m_code.size() < m_code.capacity() ? m_code.capacity() : m_code.size() * 2;
+			m_code.resize(std::max({DEFAULT_MAX_CODE_SIZE, newSize, minSize}));
+		}
+
+	  public:
+		constexpr BasicVectorSink()
+			: m_code(DEFAULT_MAX_CODE_SIZE)
+		{
+		}
+
+		explicit constexpr BasicVectorSink(size_t capacity, const TAllocator& allocator = TAllocator{})
+			: m_code(capacity, allocator)
+		{
+		}
+
+		// Writes into code, its whole capacity is used and its contents are overwritten
+		explicit constexpr BasicVectorSink(Code code)
+			: m_code(std::move(code))
+		{
+			m_code.resize(m_code.capacity());
+		}
+
+		constexpr uint32_t* reserve(size_t count)
+		{
+			if (m_size + count > m_code.size())
+			{
+				growMemory(m_size + count);
+			}
+
+			uint32_t* words = m_code.data() + m_size;
+			m_size += count;
+			return words;
+		}
+
+		constexpr void patch(size_t index, uint32_t word)
+		{
+			m_code[index] = word;
+		}
+
+		constexpr size_t size() const
+		{
+			return m_size;
+		}
+
+		constexpr const uint32_t* data() const
+		{
+			return m_code.data();
+		}
+
+		constexpr void clear()
+		{
+			m_size = 0;
+		}
+
+		// Drops the words from size on
+		constexpr void truncate(size_t size)
+		{
+			m_size = std::min(m_size, size);
+		}
+
+		constexpr const Code& getCode()
+		{
+			if (m_code.size() != m_size)
+			{
+				m_code.resize(m_size);
+			}
+
+			return m_code;
+		}
+
+		// Moves the emitted words out of the sink, leaving it empty
+		constexpr Code releaseCode()
+		{
+			m_code.resize(m_size);
+			m_size = 0;
+			return std::move(m_code);
+		}
+	};
+
+	using VectorSink = BasicVectorSink<>;
+	using PmrVectorSink = BasicVectorSink<std::pmr::polymorphic_allocator<uint32_t>>;
+
+	constexpr size_t BUFFER_POOL_SIZE_CLASSES = 16;
+	constexpr size_t BUFFER_POOL_MAX_FREE_BUFFERS = 8;
+
+	// Recycles buffers whose capacities are DEFAULT_MAX_CODE_SIZE words times a power of two.
+	// Not thread safe, getThreadBufferPool() returns one pool per thread.
+	class BufferPool
+	{
+	  protected:
+		std::array<std::vector<std::vector<uint32_t>>, BUFFER_POOL_SIZE_CLASSES> m_freeBuffers;
+
+	  public:
+		// Returns a buffer with a capacity of at least minCapacity words, the words of a recycled buffer are left as they were
+		std::vector<uint32_t> acquire(size_t minCapacity = DEFAULT_MAX_CODE_SIZE)
+		{
+			const size_t sizeClass = minCapacity <= DEFAULT_MAX_CODE_SIZE ? 0 : std::bit_width((minCapacity - 1) / DEFAULT_MAX_CODE_SIZE);
+			std::vector<uint32_t> buffer;
+			if (sizeClass >= BUFFER_POOL_SIZE_CLASSES)
+			{
+				buffer.reserve(minCapacity);
+				return buffer;
+			}
+
+			auto& freeBuffers = m_freeBuffers[sizeClass];
+			if (freeBuffers.empty())
+			{
+				buffer.reserve(DEFAULT_MAX_CODE_SIZE << sizeClass);
+				return buffer;
+			}
+
+			buffer = std::move(freeBuffers.back());
+			freeBuffers.pop_back();
+			return buffer;
+		}
+
+		// Keeps buffer for a later acquire(), it is freed when it is too small or its size class is full
+		void release(std::vector<uint32_t>&& buffer)
+		{
+			if (buffer.capacity() < DEFAULT_MAX_CODE_SIZE)
+			{
+				return;
+			}
+
+			const size_t sizeClass = std::min<size_t>(std::bit_width(buffer.capacity() / DEFAULT_MAX_CODE_SIZE) - 1, BUFFER_POOL_SIZE_CLASSES - 1);
+			auto& freeBuffers = m_freeBuffers[sizeClass];
+			if (freeBuffers.size() < BUFFER_POOL_MAX_FREE_BUFFERS)
+			{
+				freeBuffers.push_back(std::move(buffer));
+			}
+		}
+	};
+
+	inline BufferPool& getThreadBufferPool()
+	{
+		thread_local BufferPool pool{};
+		return pool;
+	}
+
+	// VectorSink whose buffer comes from the BufferPool of the calling thread and goes back to the pool of the destroying thread
+	class PooledSink : public VectorSink
+	{
+	  public:
+		explicit PooledSink(size_t capacity = DEFAULT_MAX_CODE_SIZE)
+			: VectorSink(getThreadBufferPool().acquire(capacity))
+		{
+		}
+
+		PooledSink(PooledSink&&) = default;
+
+		PooledSink& operator=(PooledSink&& other)
+		{
+			// The buffer of this sink is recycled when other is destroyed
+			std::swap(m_code, other.m_code);
+			std::swap(m_size, other.m_size);
+			return *this;
+		}
+
+		~PooledSink()
+		{
+			if (m_code.capacity() != 0)
+			{
+				getThreadBufferPool().release(std::move(m_code));
+			}
+		}
+	};
+
+	// Writes into caller-owned storage, throws std::length_error when it runs out of space
+	class SpanSink
+	{
+	  protected:
+		std::span<uint32_t> m_code;
+		size_t m_size{0};
+
+	  public:
+		constexpr SpanSink(std::span<uint32_t> code)
+			: m_code(code)
+		{
+		}
+
+		constexpr uint32_t* reserve(size_t count)
+		{
+			if (count > m_code.size() - m_size)
+			{
+				throw std::length_error("dynspv: SpanSink capacity exceeded");
+			}
+
+			uint32_t* words = m_code.data() + m_size;
+			m_size += count;
+			return words;
+		}
+
+		constexpr void patch(size_t index, uint32_t word)
+		{
+			m_code[index] = word;
+		}
+
+		constexpr size_t size() const
+		{
+			return m_size;
+		}
+
+		constexpr const uint32_t* data() const
+		{
+			return m_code.data();
+		}
+
+		constexpr void clear()
+		{
+			m_size = 0;
+		}
+
+		// Drops the words from size on
+		constexpr void truncate(size_t size)
+		{
+			m_size = std::min(m_size, size);
+		}
+
+		constexpr std::span<uint32_t> getCode() const
+		{
+			return m_code.first(m_size);
+		}
+	};
+
+	// Fixed capacity storage usable in constant expressions
+	template<size_t N>
+	class ArraySink
+	{
+	  protected:
+		std::array<uint32_t, N> m_code{};
+		size_t m_size{0};
+
+	  public:
+		constexpr uint32_t* reserve(size_t count)
+		{
+			if (count > N - m_size)
+			{
+				throw std::length_error("dynspv: ArraySink capacity exceeded");
+			}
+
+			uint32_t* words = m_code.data() + m_size;
+			m_size += count;
+			return words;
+		}
+
+		constexpr void patch(size_t index, uint32_t word)
+		{
+			m_code[index] = word;
+		}
+
+		constexpr size_t size() const
+		{
+			return m_size;
+		}
+
+		constexpr const uint32_t* data() const
+		{
+			return m_code.data();
+		}
+
+		constexpr void clear()
+		{
+			m_size = 0;
+		}
+
+		// Drops the words from size on
+		constexpr void truncate(size_t size)
+		{
+			m_size = std::min(m_size, size);
+		}
+
+		constexpr const std::array<uint32_t, N>& getCode() const
+		{
+			return m_code;
+		}
+	};
+
+	constexpr size_t DEFAULT_STREAM_CHUNK_SIZE = 16 * 1024;
+
+	// Keeps one chunk resident and hands full chunks to a callback, so memory stays bounded for any module size.
+	// The callback receives the word offset of the data, patches of flushed words (e.g. updateBound) are
+	// forwarded to it as writes at their offset. Call flush() once the module is complete.
+	class StreamSink
+	{
+	  public:
+		using WriteCallback = std::function<void(size_t offset, std::span<const uint32_t> words)>;
+
+	  protected:
+		WriteCallback m_write;
+		std::vector<uint32_t> m_chunk;
+		size_t m_flushed{0};
+		size_t m_size{0};
+
+	  public:
+		explicit StreamSink(WriteCallback write, size_t chunkSize = DEFAULT_STREAM_CHUNK_SIZE)
+			: m_write(std::move(write)), m_chunk(chunkSize)
+		{
+		}
+
+		uint32_t* reserve(size_t count)
+		{
+			if (m_size + count > m_chunk.size())
+			{
+				flush();
+
+				// Single instruction bigger than a chunk
+				if (count > m_chunk.size())
+				{
+					m_chunk.resize(count);
+				}
+			}
+
+			uint32_t* words = m_chunk.data() + m_size;
+			m_size += count;
+			return words;
+		}
+
+		void patch(size_t index, uint32_t word)
+		{
+			if (index >= m_flushed)
+			{
+				m_chunk[index - m_flushed] = word;
+				return;
+			}
+
+			m_write(index, {&word, 1});
+		}
+
+		size_t size() const
+		{
+			return m_flushed + m_size;
+		}
+
+		void flush()
+		{
+			if (m_size == 0)
+			{
+				return;
+			}
+
+			m_write(m_flushed, {m_chunk.data(), m_size});
+			m_flushed += m_size;
+			m_size = 0;
+		}
+
+		void clear()
+		{
+			m_flushed = 0;
+			m_size = 0;
+		}
+
+		// Drops the words from size on, words already flushed past it are overwritten by the next writes
+		void truncate(size_t size)
+		{
+			if (size >= m_flushed)
+			{
+				m_size = std::min(m_size, size - m_flushed);
+				return;
+			}
+
+			m_flushed = size;
+			m_size = 0;
+		}
+	};
+
+	// Returns a StreamSink callback writing to a seekable file, offsets are relative to the current file position
+	inline StreamSink::WriteCallback makeFileWriter(std::FILE* file)
+	{
+		const long base = std::ftell(file);
+		return [file, base](size_t offset, std::span<const uint32_t> words) {
+			if (std::fseek(file, base + static_cast<long>(offset * sizeof(uint32_t)), SEEK_SET) != 0 ||
+				std::fwrite(words.data(), sizeof(uint32_t), words.size(), file) != words.size())
+			{
+				throw std::runtime_error("dynspv: failed to write module to file");
+			}
+		};
+	}
+
+	// Only counts the emitted words, used to measure a module before emitting it
+	class CountingSink
+	{
+	  protected:
+		std::vector<uint32_t> m_scratch;
+		size_t m_size{0};
+
+	  public:
+		constexpr uint32_t* reserve(size_t count)
+		{
+			if (count > m_scratch.size())
+			{
+				m_scratch.resize(count);
+			}
+
+			m_size += count;
+			return m_scratch.data();
+		}
+
+		constexpr void patch(size_t, uint32_t)
+		{
+		}
+
+		constexpr size_t size() const
+		{
+			return m_size;
+		}
+
+		constexpr void clear()
+		{
+			m_size = 0;
+		}
+
+		// Drops the words from size on
+		constexpr void truncate(size_t size)
+		{
+			m_size = std::min(m_size, size);
+		}
+	};
+
+	// Literal words of an emitted instruction that can be rewritten without re-emitting the module
+	struct Relocation
+	{
+		size_t wordIndex = 0;
+		uint16_t wordCount = 1;
+	};
+
+	template<typename T>
+	constexpr std::array<uint32_t, 2> encodeRelocatedValue(const Relocation& relocation, const T& value)
+	{
+		std::array<uint32_t, 2> words{};
+		uint32_t* end = words.data();
+		encodeWord(end, value);
+
+		if (end - words.data() != relocation.wordCount)
+		{
+			throw std::invalid_argument("dynspv: patched value does not match the relocation size");
+		}
+
+		return words;
+	}
+
+	// Patches a relocation in a module that was already taken out of its generator
+	template<typename T>
+	constexpr void patchRelocation(std::span<uint32_t> code, const Relocation& relocation, const T& value)
+	{
+		std::array<uint32_t, 2> words = encodeRelocatedValue(relocation, value);
+		std::copy_n(words.begin(), relocation.wordCount, code.begin() + relocation.wordIndex);
+	}
+
+	constexpr uint64_t FINGERPRINT_SEED = 0xcbf29ce484222325;
+
+	// Order dependent hash of words, seed chains several calls. Words are mixed in pairs to halve the multiply chain.
+	constexpr uint64_t hashWords(std::span<const uint32_t> words, uint64_t seed = FINGERPRINT_SEED)
+	{
+		uint64_t hash = seed;
+		size_t i = 0;
+		for (; i + 2 <= words.size(); i += 2)
+		{
+			hash = (hash ^ (static_cast<uint64_t>(words[i + 1]) << 32 | words[i])) * 0x9e3779b97f4a7c15;
+			hash ^= hash >> 29;
+		}
+		if (i < words.size())
+		{
+			hash = (hash ^ words[i]) * 0x9e3779b97f4a7c15;
+			hash ^= hash >> 29;
+		}
+		return hash;
+	}
+
+	// Instructions of the debug sections, including OpLine and OpNoLine
+	constexpr bool isDebugInstruction(spv::Op opcode)
+	{
+		switch (opcode)
+		{
+		case spv::Op::OpSourceContinued:
+		case spv::Op::OpSource:
+		case spv::Op::OpSourceExtension:
+		case spv::Op::OpName:
+		case spv::Op::OpMemberName:
+		case spv::Op::OpString:
+		case spv::Op::OpLine:
+		case spv::Op::OpNoLine:
+		case spv::Op::OpModuleProcessed:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	// Extended instruction sets skipped while stripping debug info, the debug info ones refer to the stripped OpString
+	constexpr bool isStrippedExtInstSetName(std::string_view name)
+	{
+		return name.starts_with("NonSemantic.") || name == "OpenCL.DebugInfo.100" || name == "DebugInfo";
+	}
+
+	enum class FingerprintMode : uint8_t
+	{
+		Disabled,
+		AllInstructions,
+		// Debug instructions do not change the fingerprint
+		ExcludeDebugInfo,
+	};
+
+	// Emitted words and id state of a generator, used to start many modules from a shared prefix
+	struct ModuleSnapshot
+	{
+		std::vector<uint32_t> code;
+		uint32_t nextId = 1;
+		uint64_t fingerprint = FINGERPRINT_SEED;
+		// Ids of the extended instruction set imports skipped while stripping debug info
+		std::vector<uint32_t> strippedExtInstSets;
+	};
+
+	// Opcodes of the grammar in ascending order
+	inline constexpr spv::Op INSTRUCTION_OPCODES[] = {
+		spv::Op::OpNop,
+		spv::Op::OpUndef,
+		spv::Op::OpSourceContinued,
+		spv::Op::OpSource,
+		spv::Op::OpSourceExtension,
+		spv::Op::OpName,
+		spv::Op::OpMemberName,
+		spv::Op::OpString,
+		spv::Op::OpLine,
+		spv::Op::OpExtension,
+		spv::Op::OpExtInstImport,
+		spv::Op::OpExtInst,
+		spv::Op::OpMemoryModel,
+		spv::Op::OpEntryPoint,
+		spv::Op::OpExecutionMode,
+		spv::Op::OpCapability,
+		spv::Op::OpTypeVoid,
+		spv::Op::OpTypeBool,
+		spv::Op::OpTypeInt,
+		spv::Op::OpTypeFloat,
+		spv::Op::OpTypeVector,
+		spv::Op::OpTypeMatrix,
+		spv::Op::OpTypeImage,
+		spv::Op::OpTypeSampler,
+		spv::Op::OpTypeSampledImage,
+		spv::Op::OpTypeArray,
+		spv::Op::OpTypeRuntimeArray,
+		spv::Op::OpTypeStruct,
+		spv::Op::OpTypeOpaque,
+		spv::Op::OpTypePointer,
+		spv::Op::OpTypeFunction,
+		spv::Op::OpTypeEvent,
+		spv::Op::OpTypeDeviceEvent,
+		spv::Op::OpTypeReserveId,
+		spv::Op::OpTypeQueue,
+		spv::Op::OpTypePipe,
+		spv::Op::OpTypeForwardPointer,
+		spv::Op::OpConstantTrue,
+		spv::Op::OpConstantFalse,
+		spv::Op::OpConstant,
+		spv::Op::OpConstantComposite,
+		spv::Op::OpConstantSampler,
+		spv::Op::OpConstantNull,
+		spv::Op::OpSpecConstantTrue,
+		spv::Op::OpSpecConstantFalse,
+		spv::Op::OpSpecConstant,
+		spv::Op::OpSpecConstantComposite,
+		spv::Op::OpSpecConstantOp,
+		spv::Op::OpFunction,
+		spv::Op::OpFunctionParameter,
+		spv::Op::OpFunctionEnd,
+		spv::Op::OpFunctionCall,
+		spv::Op::OpVariable,
+		spv::Op::OpImageTexelPointer,
+		spv::Op::OpLoad,
+		spv::Op::OpStore,
+		spv::Op::OpCopyMemory,
+		spv::Op::OpCopyMemorySized,
+		spv::Op::OpAccessChain,
+		spv::Op::OpInBoundsAccessChain,
+		spv::Op::OpPtrAccessChain,
+		spv::Op::OpArrayLength,
+		spv::Op::OpGenericPtrMemSemantics,
+		spv::Op::OpInBoundsPtrAccessChain,
+		spv::Op::OpDecorate,
+		spv::Op::OpMemberDecorate,
+		spv::Op::OpDecorationGroup,
+		spv::Op::OpGroupDecorate,
+		spv::Op::OpGroupMemberDecorate,
+		spv::Op::OpVectorExtractDynamic,
+		spv::Op::OpVectorInsertDynamic,
+		spv::Op::OpVectorShuffle,
+		spv::Op::OpCompositeConstruct,
+		spv::Op::OpCompositeExtract,
+		spv::Op::OpCompositeInsert,
+		spv::Op::OpCopyObject,
+		spv::Op::OpTranspose,
+		spv::Op::OpSampledImage,
+		spv::Op::OpImageSampleImplicitLod,
+		spv::Op::OpImageSampleExplicitLod,
+		spv::Op::OpImageSampleDrefImplicitLod,
+		spv::Op::OpImageSampleDrefExplicitLod,
+		spv::Op::OpImageSampleProjImplicitLod,
+		spv::Op::OpImageSampleProjExplicitLod,
+		spv::Op::OpImageSampleProjDrefImplicitLod,
+		spv::Op::OpImageSampleProjDrefExplicitLod,
+		spv::Op::OpImageFetch,
+		spv::Op::OpImageGather,
+		spv::Op::OpImageDrefGather,
+		spv::Op::OpImageRead,
+		spv::Op::OpImageWrite,
+		spv::Op::OpImage,
+		spv::Op::OpImageQueryFormat,
+		spv::Op::OpImageQueryOrder,
+		spv::Op::OpImageQuerySizeLod,
+		spv::Op::OpImageQuerySize,
+		spv::Op::OpImageQueryLod,
+		spv::Op::OpImageQueryLevels,
+		spv::Op::OpImageQuerySamples,
+		spv::Op::OpConvertFToU,
+		spv::Op::OpConvertFToS,
+		spv::Op::OpConvertSToF,
+		spv::Op::OpConvertUToF,
+		spv::Op::OpUConvert,
+		spv::Op::OpSConvert,
+		spv::Op::OpFConvert,
+		spv::Op::OpQuantizeToF16,
+		spv::Op::OpConvertPtrToU,
+		spv::Op::OpSatConvertSToU,
+		spv::Op::OpSatConvertUToS,
+		spv::Op::OpConvertUToPtr,
+		spv::Op::OpPtrCastToGeneric,
+		spv::Op::OpGenericCastToPtr,
+		spv::Op::OpGenericCastToPtrExplicit,
+		spv::Op::OpBitcast,
+		spv::Op::OpSNegate,
+		spv::Op::OpFNegate,
+		spv::Op::OpIAdd,
+		spv::Op::OpFAdd,
+		spv::Op::OpISub,
+		spv::Op::OpFSub,
+		spv::Op::OpIMul,
+		spv::Op::OpFMul,
+		spv::Op::OpUDiv,
+		spv::Op::OpSDiv,
+		spv::Op::OpFDiv,
+		spv::Op::OpUMod,
+		spv::Op::OpSRem,
+		spv::Op::OpSMod,
+		spv::Op::OpFRem,
+		spv::Op::OpFMod,
+		spv::Op::OpVectorTimesScalar,
+		spv::Op::OpMatrixTimesScalar,
+		spv::Op::OpVectorTimesMatrix,
+		spv::Op::OpMatrixTimesVector,
+		spv::Op::OpMatrixTimesMatrix,
+		spv::Op::OpOuterProduct,
+		spv::Op::OpDot,
+		spv::Op::OpIAddCarry,
+		spv::Op::OpISubBorrow,
+		spv::Op::OpUMulExtended,
+		spv::Op::OpSMulExtended,
+		spv::Op::OpAny,
+		spv::Op::OpAll,
+		spv::Op::OpIsNan,
+		spv::Op::OpIsInf,
+		spv::Op::OpIsFinite,
+		spv::Op::OpIsNormal,
+		spv::Op::OpSignBitSet,
+		spv::Op::OpLessOrGreater,
+		spv::Op::OpOrdered,
+		spv::Op::OpUnordered,
+		spv::Op::OpLogicalEqual,
+		spv::Op::OpLogicalNotEqual,
+		spv::Op::OpLogicalOr,
+		spv::Op::OpLogicalAnd,
+		spv::Op::OpLogicalNot,
+		spv::Op::OpSelect,
+		spv::Op::OpIEqual,
+		spv::Op::OpINotEqual,
+		spv::Op::OpUGreaterThan,
+		spv::Op::OpSGreaterThan,
+		spv::Op::OpUGreaterThanEqual,
+		spv::Op::OpSGreaterThanEqual,
+		spv::Op::OpULessThan,
+		spv::Op::OpSLessThan,
+		spv::Op::OpULessThanEqual,
+		spv::Op::OpSLessThanEqual,
+		spv::Op::OpFOrdEqual,
+		spv::Op::OpFUnordEqual,
+		spv::Op::OpFOrdNotEqual,
+		spv::Op::OpFUnordNotEqual,
+		spv::Op::OpFOrdLessThan,
+		spv::Op::OpFUnordLessThan,
+		spv::Op::OpFOrdGreaterThan,
+		spv::Op::OpFUnordGreaterThan,
+		spv::Op::OpFOrdLessThanEqual,
+		spv::Op::OpFUnordLessThanEqual,
+		spv::Op::OpFOrdGreaterThanEqual,
+		spv::Op::OpFUnordGreaterThanEqual,
+		spv::Op::OpShiftRightLogical,
+		spv::Op::OpShiftRightArithmetic,
+		spv::Op::OpShiftLeftLogical,
+		spv::Op::OpBitwiseOr,
+		spv::Op::OpBitwiseXor,
+		spv::Op::OpBitwiseAnd,
+		spv::Op::OpNot,
+		spv::Op::OpBitFieldInsert,
+		spv::Op::OpBitFieldSExtract,
+		spv::Op::OpBitFieldUExtract,
+		spv::Op::OpBitReverse,
+		spv::Op::OpBitCount,
+		spv::Op::OpDPdx,
+		spv::Op::OpDPdy,
+		spv::Op::OpFwidth,
+		spv::Op::OpDPdxFine,
+		spv::Op::OpDPdyFine,
+		spv::Op::OpFwidthFine,
+		spv::Op::OpDPdxCoarse,
+		spv::Op::OpDPdyCoarse,
+		spv::Op::OpFwidthCoarse,
+		spv::Op::OpEmitVertex,
+		spv::Op::OpEndPrimitive,
+		spv::Op::OpEmitStreamVertex,
+		spv::Op::OpEndStreamPrimitive,
+		spv::Op::OpControlBarrier,
+		spv::Op::OpMemoryBarrier,
+		spv::Op::OpAtomicLoad,
+		spv::Op::OpAtomicStore,
+		spv::Op::OpAtomicExchange,
+		spv::Op::OpAtomicCompareExchange,
+		spv::Op::OpAtomicCompareExchangeWeak,
+		spv::Op::OpAtomicIIncrement,
+		spv::Op::OpAtomicIDecrement,
+		spv::Op::OpAtomicIAdd,
+		spv::Op::OpAtomicISub,
+		spv::Op::OpAtomicSMin,
+		spv::Op::OpAtomicUMin,
+		spv::Op::OpAtomicSMax,
+		spv::Op::OpAtomicUMax,
+		spv::Op::OpAtomicAnd,
+		spv::Op::OpAtomicOr,
+		spv::Op::OpAtomicXor,
+		spv::Op::OpPhi,
+		spv::Op::OpLoopMerge,
+		spv::Op::OpSelectionMerge,
+		spv::Op::OpLabel,
+		spv::Op::OpBranch,
+		spv::Op::OpBranchConditional,
+		spv::Op::OpSwitch,
+		spv::Op::OpKill,
+		spv::Op::OpReturn,
+		spv::Op::OpReturnValue,
+		spv::Op::OpUnreachable,
+		spv::Op::OpLifetimeStart,
+		spv::Op::OpLifetimeStop,
+		spv::Op::OpGroupAsyncCopy,
+		spv::Op::OpGroupWaitEvents,
+		spv::Op::OpGroupAll,
+		spv::Op::OpGroupAny,
+		spv::Op::OpGroupBroadcast,
+		spv::Op::OpGroupIAdd,
+		spv::Op::OpGroupFAdd,
+		spv::Op::OpGroupFMin,
+		spv::Op::OpGroupUMin,
+		spv::Op::OpGroupSMin,
+		spv::Op::OpGroupFMax,
+		spv::Op::OpGroupUMax,
+		spv::Op::OpGroupSMax,
+		spv::Op::OpReadPipe,
+		spv::Op::OpWritePipe,
+		spv::Op::OpReservedReadPipe,
+		spv::Op::OpReservedWritePipe,
+		spv::Op::OpReserveReadPipePackets,
+		spv::Op::OpReserveWritePipePackets,
+		spv::Op::OpCommitReadPipe,
+		spv::Op::OpCommitWritePipe,
+		spv::Op::OpIsValidReserveId,
+		spv::Op::OpGetNumPipePackets,
+		spv::Op::OpGetMaxPipePackets,
+		spv::Op::OpGroupReserveReadPipePackets,
+		spv::Op::OpGroupReserveWritePipePackets,
+		spv::Op::OpGroupCommitReadPipe,
+		spv::Op::OpGroupCommitWritePipe,
+		spv::Op::OpEnqueueMarker,
+		spv::Op::OpEnqueueKernel,
+		spv::Op::OpGetKernelNDrangeSubGroupCount,
+		spv::Op::OpGetKernelNDrangeMaxSubGroupSize,
+		spv::Op::OpGetKernelWorkGroupSize,
+		spv::Op::OpGetKernelPreferredWorkGroupSizeMultiple,
+		spv::Op::OpRetainEvent,
+		spv::Op::OpReleaseEvent,
+		spv::Op::OpCreateUserEvent,
+		spv::Op::OpIsValidEvent,
+		spv::Op::OpSetUserEventStatus,
+		spv::Op::OpCaptureEventProfilingInfo,
+		spv::Op::OpGetDefaultQueue,
+		spv::Op::OpBuildNDRange,
+		spv::Op::OpImageSparseSampleImplicitLod,
+		spv::Op::OpImageSparseSampleExplicitLod,
+		spv::Op::OpImageSparseSampleDrefImplicitLod,
+		spv::Op::OpImageSparseSampleDrefExplicitLod,
+		spv::Op::OpImageSparseSampleProjImplicitLod,
+		spv::Op::OpImageSparseSampleProjExplicitLod,
+		spv::Op::OpImageSparseSampleProjDrefImplicitLod,
+		spv::Op::OpImageSparseSampleProjDrefExplicitLod,
+		spv::Op::OpImageSparseFetch,
+		spv::Op::OpImageSparseGather,
+		spv::Op::OpImageSparseDrefGather,
+		spv::Op::OpImageSparseTexelsResident,
+		spv::Op::OpNoLine,
+		spv::Op::OpAtomicFlagTestAndSet,
+		spv::Op::OpAtomicFlagClear,
+		spv::Op::OpImageSparseRead,
+		spv::Op::OpSizeOf,
+		spv::Op::OpTypePipeStorage,
+		spv::Op::OpConstantPipeStorage,
+		spv::Op::OpCreatePipeFromPipeStorage,
+		spv::Op::OpGetKernelLocalSizeForSubgroupCount,
+		spv::Op::OpGetKernelMaxNumSubgroups,
+		spv::Op::OpTypeNamedBarrier,
+		spv::Op::OpNamedBarrierInitialize,
+		spv::Op::OpMemoryNamedBarrier,
+		spv::Op::OpModuleProcessed,
+		spv::Op::OpExecutionModeId,
+		spv::Op::OpDecorateId,
+		spv::Op::OpGroupNonUniformElect,
+		spv::Op::OpGroupNonUniformAll,
+		spv::Op::OpGroupNonUniformAny,
+		spv::Op::OpGroupNonUniformAllEqual,
+		spv::Op::OpGroupNonUniformBroadcast,
+		spv::Op::OpGroupNonUniformBroadcastFirst,
+		spv::Op::OpGroupNonUniformBallot,
+		spv::Op::OpGroupNonUniformInverseBallot,
+		spv::Op::OpGroupNonUniformBallotBitExtract,
+		spv::Op::OpGroupNonUniformBallotBitCount,
+		spv::Op::OpGroupNonUniformBallotFindLSB,
+		spv::Op::OpGroupNonUniformBallotFindMSB,
+		spv::Op::OpGroupNonUniformShuffle,
+		spv::Op::OpGroupNonUniformShuffleXor,
+		spv::Op::OpGroupNonUniformShuffleUp,
+		spv::Op::OpGroupNonUniformShuffleDown,
+		spv::Op::OpGroupNonUniformIAdd,
+		spv::Op::OpGroupNonUniformFAdd,
+		spv::Op::OpGroupNonUniformIMul,
+		spv::Op::OpGroupNonUniformFMul,
+		spv::Op::OpGroupNonUniformSMin,
+		spv::Op::OpGroupNonUniformUMin,
+		spv::Op::OpGroupNonUniformFMin,
+		spv::Op::OpGroupNonUniformSMax,
+		spv::Op::OpGroupNonUniformUMax,
+		spv::Op::OpGroupNonUniformFMax,
+		spv::Op::OpGroupNonUniformBitwiseAnd,
+		spv::Op::OpGroupNonUniformBitwiseOr,
+		spv::Op::OpGroupNonUniformBitwiseXor,
+		spv::Op::OpGroupNonUniformLogicalAnd,
+		spv::Op::OpGroupNonUniformLogicalOr,
+		spv::Op::OpGroupNonUniformLogicalXor,
+		spv::Op::OpGroupNonUniformQuadBroadcast,
+		spv::Op::OpGroupNonUniformQuadSwap,
+		spv::Op::OpCopyLogical,
+		spv::Op::OpPtrEqual,
+		spv::Op::OpPtrNotEqual,
+		spv::Op::OpPtrDiff,
+		spv::Op::OpColorAttachmentReadEXT,
+		spv::Op::OpDepthAttachmentReadEXT,
+		spv::Op::OpStencilAttachmentReadEXT,
+		spv::Op::OpTerminateInvocation,
+		spv::Op::OpTypeUntypedPointerKHR,
+		spv::Op::OpUntypedVariableKHR,
+		spv::Op::OpUntypedAccessChainKHR,
+		spv::Op::OpUntypedInBoundsAccessChainKHR,
+		spv::Op::OpSubgroupBallotKHR,
+		spv::Op::OpSubgroupFirstInvocationKHR,
+		spv::Op::OpUntypedPtrAccessChainKHR,
+		spv::Op::OpUntypedInBoundsPtrAccessChainKHR,
+		spv::Op::OpUntypedArrayLengthKHR,
+		spv::Op::OpUntypedPrefetchKHR,
+		spv::Op::OpSubgroupAllKHR,
+		spv::Op::OpSubgroupAnyKHR,
+		spv::Op::OpSubgroupAllEqualKHR,
+		spv::Op::OpGroupNonUniformRotateKHR,
+		spv::Op::OpSubgroupReadInvocationKHR,
+		spv::Op::OpExtInstWithForwardRefsKHR,
+		spv::Op::OpTraceRayKHR,
+		spv::Op::OpExecuteCallableKHR,
+		spv::Op::OpConvertUToAccelerationStructureKHR,
+		spv::Op::OpIgnoreIntersectionKHR,
+		spv::Op::OpTerminateRayKHR,
+		spv::Op::OpSDot,
+		spv::Op::OpUDot,
+		spv::Op::OpSUDot,
+		spv::Op::OpSDotAccSat,
+		spv::Op::OpUDotAccSat,
+		spv::Op::OpSUDotAccSat,
+		spv::Op::OpTypeCooperativeMatrixKHR,
+		spv::Op::OpCooperativeMatrixLoadKHR,
+		spv::Op::OpCooperativeMatrixStoreKHR,
+		spv::Op::OpCooperativeMatrixMulAddKHR,
+		spv::Op::OpCooperativeMatrixLengthKHR,
+		spv::Op::OpConstantCompositeReplicateEXT,
+		spv::Op::OpSpecConstantCompositeReplicateEXT,
+		spv::Op::OpCompositeConstructReplicateEXT,
+		spv::Op::OpTypeRayQueryKHR,
+		spv::Op::OpRayQueryInitializeKHR,
+		spv::Op::OpRayQueryTerminateKHR,
+		spv::Op::OpRayQueryGenerateIntersectionKHR,
+		spv::Op::OpRayQueryConfirmIntersectionKHR,
+		spv::Op::OpRayQueryProceedKHR,
+		spv::Op::OpRayQueryGetIntersectionTypeKHR,
+		spv::Op::OpImageSampleWeightedQCOM,
+		spv::Op::OpImageBoxFilterQCOM,
+		spv::Op::OpImageBlockMatchSSDQCOM,
+		spv::Op::OpImageBlockMatchSADQCOM,
+		spv::Op::OpImageBlockMatchWindowSSDQCOM,
+		spv::Op::OpImageBlockMatchWindowSADQCOM,
+		spv::Op::OpImageBlockMatchGatherSSDQCOM,
+		spv::Op::OpImageBlockMatchGatherSADQCOM,
+		spv::Op::OpGroupIAddNonUniformAMD,
+		spv::Op::OpGroupFAddNonUniformAMD,
+		spv::Op::OpGroupFMinNonUniformAMD,
+		spv::Op::OpGroupUMinNonUniformAMD,
+		spv::Op::OpGroupSMinNonUniformAMD,
+		spv::Op::OpGroupFMaxNonUniformAMD,
+		spv::Op::OpGroupUMaxNonUniformAMD,
+		spv::Op::OpGroupSMaxNonUniformAMD,
+		spv::Op::OpFragmentMaskFetchAMD,
+		spv::Op::OpFragmentFetchAMD,
+		spv::Op::OpReadClockKHR,
+		spv::Op::OpAllocateNodePayloadsAMDX,
+		spv::Op::OpEnqueueNodePayloadsAMDX,
+		spv::Op::OpTypeNodePayloadArrayAMDX,
+		spv::Op::OpFinishWritingNodePayloadAMDX,
+		spv::Op::OpNodePayloadArrayLengthAMDX,
+		spv::Op::OpIsNodePayloadValidAMDX,
+		spv::Op::OpConstantStringAMDX,
+		spv::Op::OpSpecConstantStringAMDX,
+		spv::Op::OpGroupNonUniformQuadAllKHR,
+		spv::Op::OpGroupNonUniformQuadAnyKHR,
+		spv::Op::OpHitObjectRecordHitMotionNV,
+		spv::Op::OpHitObjectRecordHitWithIndexMotionNV,
+		spv::Op::OpHitObjectRecordMissMotionNV,
+		spv::Op::OpHitObjectGetWorldToObjectNV,
+		spv::Op::OpHitObjectGetObjectToWorldNV,
+		spv::Op::OpHitObjectGetObjectRayDirectionNV,
+		spv::Op::OpHitObjectGetObjectRayOriginNV,
+		spv::Op::OpHitObjectTraceRayMotionNV,
+		spv::Op::OpHitObjectGetShaderRecordBufferHandleNV,
+		spv::Op::OpHitObjectGetShaderBindingTableRecordIndexNV,
+		spv::Op::OpHitObjectRecordEmptyNV,
+		spv::Op::OpHitObjectTraceRayNV,
+		spv::Op::OpHitObjectRecordHitNV,
+		spv::Op::OpHitObjectRecordHitWithIndexNV,
+		spv::Op::OpHitObjectRecordMissNV,
+		spv::Op::OpHitObjectExecuteShaderNV,
+		spv::Op::OpHitObjectGetCurrentTimeNV,
+		spv::Op::OpHitObjectGetAttributesNV,
+		spv::Op::OpHitObjectGetHitKindNV,
+		spv::Op::OpHitObjectGetPrimitiveIndexNV,
+		spv::Op::OpHitObjectGetGeometryIndexNV,
+		spv::Op::OpHitObjectGetInstanceIdNV,
+		spv::Op::OpHitObjectGetInstanceCustomIndexNV,
+		spv::Op::OpHitObjectGetWorldRayDirectionNV,
+		spv::Op::OpHitObjectGetWorldRayOriginNV,
+		spv::Op::OpHitObjectGetRayTMaxNV,
+		spv::Op::OpHitObjectGetRayTMinNV,
+		spv::Op::OpHitObjectIsEmptyNV,
+		spv::Op::OpHitObjectIsHitNV,
+		spv::Op::OpHitObjectIsMissNV,
+		spv::Op::OpReorderThreadWithHitObjectNV,
+		spv::Op::OpReorderThreadWithHintNV,
+		spv::Op::OpTypeHitObjectNV,
+		spv::Op::OpImageSampleFootprintNV,
+		spv::Op::OpTypeCooperativeVectorNV,
+		spv::Op::OpCooperativeVectorMatrixMulNV,
+		spv::Op::OpCooperativeVectorOuterProductAccumulateNV,
+		spv::Op::OpCooperativeVectorReduceSumAccumulateNV,
+		spv::Op::OpCooperativeVectorMatrixMulAddNV,
+		spv::Op::OpCooperativeMatrixConvertNV,
+		spv::Op::OpEmitMeshTasksEXT,
+		spv::Op::OpSetMeshOutputsEXT,
+		spv::Op::OpGroupNonUniformPartitionNV,
+		spv::Op::OpWritePackedPrimitiveIndices4x8NV,
+		spv::Op::OpFetchMicroTriangleVertexPositionNV,
+		spv::Op::OpFetchMicroTriangleVertexBarycentricNV,
+		spv::Op::OpCooperativeVectorLoadNV,
+		spv::Op::OpCooperativeVectorStoreNV,
+		spv::Op::OpReportIntersectionKHR,
+		spv::Op::OpIgnoreIntersectionNV,
+		spv::Op::OpTerminateRayNV,
+		spv::Op::OpTraceNV,
+		spv::Op::OpTraceMotionNV,
+		spv::Op::OpTraceRayMotionNV,
+		spv::Op::OpRayQueryGetIntersectionTriangleVertexPositionsKHR,
+		spv::Op::OpTypeAccelerationStructureKHR,
+		spv::Op::OpExecuteCallableNV,
+		spv::Op::OpRayQueryGetClusterIdNV,
+		spv::Op::OpHitObjectGetClusterIdNV,
+		spv::Op::OpTypeCooperativeMatrixNV,
+		spv::Op::OpCooperativeMatrixLoadNV,
+		spv::Op::OpCooperativeMatrixStoreNV,
+		spv::Op::OpCooperativeMatrixMulAddNV,
+		spv::Op::OpCooperativeMatrixLengthNV,
+		spv::Op::OpBeginInvocationInterlockEXT,
+		spv::Op::OpEndInvocationInterlockEXT,
+		spv::Op::OpCooperativeMatrixReduceNV,
+		spv::Op::OpCooperativeMatrixLoadTensorNV,
+		spv::Op::OpCooperativeMatrixStoreTensorNV,
+		spv::Op::OpCooperativeMatrixPerElementOpNV,
+		spv::Op::OpTypeTensorLayoutNV,
+		spv::Op::OpTypeTensorViewNV,
+		spv::Op::OpCreateTensorLayoutNV,
+		spv::Op::OpTensorLayoutSetDimensionNV,
+		spv::Op::OpTensorLayoutSetStrideNV,
+		spv::Op::OpTensorLayoutSliceNV,
+		spv::Op::OpTensorLayoutSetClampValueNV,
+		spv::Op::OpCreateTensorViewNV,
+		spv::Op::OpTensorViewSetDimensionNV,
+		spv::Op::OpTensorViewSetStrideNV,
+		spv::Op::OpDemoteToHelperInvocation,
+		spv::Op::OpIsHelperInvocationEXT,
+		spv::Op::OpTensorViewSetClipNV,
+		spv::Op::OpTensorLayoutSetBlockSizeNV,
+		spv::Op::OpCooperativeMatrixTransposeNV,
+		spv::Op::OpConvertUToImageNV,
+		spv::Op::OpConvertUToSamplerNV,
+		spv::Op::OpConvertImageToUNV,
+		spv::Op::OpConvertSamplerToUNV,
+		spv::Op::OpConvertUToSampledImageNV,
+		spv::Op::OpConvertSampledImageToUNV,
+		spv::Op::OpSamplerImageAddressingModeNV,
+		spv::Op::OpRawAccessChainNV,
+		spv::Op::OpRayQueryGetIntersectionSpherePositionNV,
+		spv::Op::OpRayQueryGetIntersectionSphereRadiusNV,
+		spv::Op::OpRayQueryGetIntersectionLSSPositionsNV,
+		spv::Op::OpRayQueryGetIntersectionLSSRadiiNV,
+		spv::Op::OpRayQueryGetIntersectionLSSHitValueNV,
+		spv::Op::OpHitObjectGetSpherePositionNV,
+		spv::Op::OpHitObjectGetSphereRadiusNV,
+		spv::Op::OpHitObjectGetLSSPositionsNV,
+		spv::Op::OpHitObjectGetLSSRadiiNV,
+		spv::Op::OpHitObjectIsSphereHitNV,
+		spv::Op::OpHitObjectIsLSSHitNV,
+		spv::Op::OpRayQueryIsSphereHitNV,
+		spv::Op::OpRayQueryIsLSSHitNV,
+		spv::Op::OpSubgroupShuffleINTEL,
+		spv::Op::OpSubgroupShuffleDownINTEL,
+		spv::Op::OpSubgroupShuffleUpINTEL,
+		spv::Op::OpSubgroupShuffleXorINTEL,
+		spv::Op::OpSubgroupBlockReadINTEL,
+		spv::Op::OpSubgroupBlockWriteINTEL,
+		spv::Op::OpSubgroupImageBlockReadINTEL,
+		spv::Op::OpSubgroupImageBlockWriteINTEL,
+		spv::Op::OpSubgroupImageMediaBlockReadINTEL,
+		spv::Op::OpSubgroupImageMediaBlockWriteINTEL,
+		spv::Op::OpUCountLeadingZerosINTEL,
+		spv::Op::OpUCountTrailingZerosINTEL,
+		spv::Op::OpAbsISubINTEL,
+		spv::Op::OpAbsUSubINTEL,
+		spv::Op::OpIAddSatINTEL,
+		spv::Op::OpUAddSatINTEL,
+		spv::Op::OpIAverageINTEL,
+		spv::Op::OpUAverageINTEL,
+		spv::Op::OpIAverageRoundedINTEL,
+		spv::Op::OpUAverageRoundedINTEL,
+		spv::Op::OpISubSatINTEL,
+		spv::Op::OpUSubSatINTEL,
+		spv::Op::OpIMul32x16INTEL,
+		spv::Op::OpUMul32x16INTEL,
+		spv::Op::OpConstantFunctionPointerINTEL,
+		spv::Op::OpFunctionPointerCallINTEL,
+		spv::Op::OpAsmTargetINTEL,
+		spv::Op::OpAsmINTEL,
+		spv::Op::OpAsmCallINTEL,
+		spv::Op::OpAtomicFMinEXT,
+		spv::Op::OpAtomicFMaxEXT,
+		spv::Op::OpAssumeTrueKHR,
+		spv::Op::OpExpectKHR,
+		spv::Op::OpDecorateString,
+		spv::Op::OpMemberDecorateString,
+		spv::Op::OpVmeImageINTEL,
+		spv::Op::OpTypeVmeImageINTEL,
+		spv::Op::OpTypeAvcImePayloadINTEL,
+		spv::Op::OpTypeAvcRefPayloadINTEL,
+		spv::Op::OpTypeAvcSicPayloadINTEL,
+		spv::Op::OpTypeAvcMcePayloadINTEL,
+		spv::Op::OpTypeAvcMceResultINTEL,
+		spv::Op::OpTypeAvcImeResultINTEL,
+		spv::Op::OpTypeAvcImeResultSingleReferenceStreamoutINTEL,
+		spv::Op::OpTypeAvcImeResultDualReferenceStreamoutINTEL,
+		spv::Op::OpTypeAvcImeSingleReferenceStreaminINTEL,
+		spv::Op::OpTypeAvcImeDualReferenceStreaminINTEL,
+		spv::Op::OpTypeAvcRefResultINTEL,
+		spv::Op::OpTypeAvcSicResultINTEL,
+		spv::Op::OpSubgroupAvcMceGetDefaultInterBaseMultiReferencePenaltyINTEL,
+		spv::Op::OpSubgroupAvcMceSetInterBaseMultiReferencePenaltyINTEL,
+		spv::Op::OpSubgroupAvcMceGetDefaultInterShapePenaltyINTEL,
+		spv::Op::OpSubgroupAvcMceSetInterShapePenaltyINTEL,
+		spv::Op::OpSubgroupAvcMceGetDefaultInterDirectionPenaltyINTEL,
+		spv::Op::OpSubgroupAvcMceSetInterDirectionPenaltyINTEL,
+		spv::Op::OpSubgroupAvcMceGetDefaultIntraLumaShapePenaltyINTEL,
+		spv::Op::OpSubgroupAvcMceGetDefaultInterMotionVectorCostTableINTEL,
+		spv::Op::OpSubgroupAvcMceGetDefaultHighPenaltyCostTableINTEL,
+		spv::Op::OpSubgroupAvcMceGetDefaultMediumPenaltyCostTableINTEL,
+		spv::Op::OpSubgroupAvcMceGetDefaultLowPenaltyCostTableINTEL,
+		spv::Op::OpSubgroupAvcMceSetMotionVectorCostFunctionINTEL,
+		spv::Op::OpSubgroupAvcMceGetDefaultIntraLumaModePenaltyINTEL,
+		spv::Op::OpSubgroupAvcMceGetDefaultNonDcLumaIntraPenaltyINTEL,
+		spv::Op::OpSubgroupAvcMceGetDefaultIntraChromaModeBasePenaltyINTEL,
+		spv::Op::OpSubgroupAvcMceSetAcOnlyHaarINTEL,
+		spv::Op::OpSubgroupAvcMceSetSourceInterlacedFieldPolarityINTEL,
+		spv::Op::OpSubgroupAvcMceSetSingleReferenceInterlacedFieldPolarityINTEL,
+		spv::Op::OpSubgroupAvcMceSetDualReferenceInterlacedFieldPolaritiesINTEL,
+		spv::Op::OpSubgroupAvcMceConvertToImePayloadINTEL,
+		spv::Op::OpSubgroupAvcMceConvertToImeResultINTEL,
+		spv::Op::OpSubgroupAvcMceConvertToRefPayloadINTEL,
+		spv::Op::OpSubgroupAvcMceConvertToRefResultINTEL,
+		spv::Op::OpSubgroupAvcMceConvertToSicPayloadINTEL,
+		spv::Op::OpSubgroupAvcMceConvertToSicResultINTEL,
+		spv::Op::OpSubgroupAvcMceGetMotionVectorsINTEL,
+		spv::Op::OpSubgroupAvcMceGetInterDistortionsINTEL,
+		spv::Op::OpSubgroupAvcMceGetBestInterDistortionsINTEL,
+		spv::Op::OpSubgroupAvcMceGetInterMajorShapeINTEL,
+		spv::Op::OpSubgroupAvcMceGetInterMinorShapeINTEL,
+		spv::Op::OpSubgroupAvcMceGetInterDirectionsINTEL,
+		spv::Op::OpSubgroupAvcMceGetInterMotionVectorCountINTEL,
+		spv::Op::OpSubgroupAvcMceGetInterReferenceIdsINTEL,
+		spv::Op::OpSubgroupAvcMceGetInterReferenceInterlacedFieldPolaritiesINTEL,
+		spv::Op::OpSubgroupAvcImeInitializeINTEL,
+		spv::Op::OpSubgroupAvcImeSetSingleReferenceINTEL,
+		spv::Op::OpSubgroupAvcImeSetDualReferenceINTEL,
+		spv::Op::OpSubgroupAvcImeRefWindowSizeINTEL,
+		spv::Op::OpSubgroupAvcImeAdjustRefOffsetINTEL,
+		spv::Op::OpSubgroupAvcImeConvertToMcePayloadINTEL,
+		spv::Op::OpSubgroupAvcImeSetMaxMotionVectorCountINTEL,
+		spv::Op::OpSubgroupAvcImeSetUnidirectionalMixDisableINTEL,
+		spv::Op::OpSubgroupAvcImeSetEarlySearchTerminationThresholdINTEL,
+		spv::Op::OpSubgroupAvcImeSetWeightedSadINTEL,
+		spv::Op::OpSubgroupAvcImeEvaluateWithSingleReferenceINTEL,
+		spv::Op::OpSubgroupAvcImeEvaluateWithDualReferenceINTEL,
+		spv::Op::OpSubgroupAvcImeEvaluateWithSingleReferenceStreaminINTEL,
+		spv::Op::OpSubgroupAvcImeEvaluateWithDualReferenceStreaminINTEL,
+		spv::Op::OpSubgroupAvcImeEvaluateWithSingleReferenceStreamoutINTEL,
+		spv::Op::OpSubgroupAvcImeEvaluateWithDualReferenceStreamoutINTEL,
+		spv::Op::OpSubgroupAvcImeEvaluateWithSingleReferenceStreaminoutINTEL,
+		spv::Op::OpSubgroupAvcImeEvaluateWithDualReferenceStreaminoutINTEL,
+		spv::Op::OpSubgroupAvcImeConvertToMceResultINTEL,
+		spv::Op::OpSubgroupAvcImeGetSingleReferenceStreaminINTEL,
+		spv::Op::OpSubgroupAvcImeGetDualReferenceStreaminINTEL,
+		spv::Op::OpSubgroupAvcImeStripSingleReferenceStreamoutINTEL,
+		spv::Op::OpSubgroupAvcImeStripDualReferenceStreamoutINTEL,
+		spv::Op::OpSubgroupAvcImeGetStreamoutSingleReferenceMajorShapeMotionVectorsINTEL,
+		spv::Op::OpSubgroupAvcImeGetStreamoutSingleReferenceMajorShapeDistortionsINTEL,
+		spv::Op::OpSubgroupAvcImeGetStreamoutSingleReferenceMajorShapeReferenceIdsINTEL,
+		spv::Op::OpSubgroupAvcImeGetStreamoutDualReferenceMajorShapeMotionVectorsINTEL,
+		spv::Op::OpSubgroupAvcImeGetStreamoutDualReferenceMajorShapeDistortionsINTEL,
+		spv::Op::OpSubgroupAvcImeGetStreamoutDualReferenceMajorShapeReferenceIdsINTEL,
+		spv::Op::OpSubgroupAvcImeGetBorderReachedINTEL,
+		spv::Op::OpSubgroupAvcImeGetTruncatedSearchIndicationINTEL,
+		spv::Op::OpSubgroupAvcImeGetUnidirectionalEarlySearchTerminationINTEL,
+		spv::Op::OpSubgroupAvcImeGetWeightingPatternMinimumMotionVectorINTEL,
+		spv::Op::OpSubgroupAvcImeGetWeightingPatternMinimumDistortionINTEL,
+		spv::Op::OpSubgroupAvcFmeInitializeINTEL,
+		spv::Op::OpSubgroupAvcBmeInitializeINTEL,
+		spv::Op::OpSubgroupAvcRefConvertToMcePayloadINTEL,
+		spv::Op::OpSubgroupAvcRefSetBidirectionalMixDisableINTEL,
+		spv::Op::OpSubgroupAvcRefSetBilinearFilterEnableINTEL,
+		spv::Op::OpSubgroupAvcRefEvaluateWithSingleReferenceINTEL,
+		spv::Op::OpSubgroupAvcRefEvaluateWithDualReferenceINTEL,
+		spv::Op::OpSubgroupAvcRefEvaluateWithMultiReferenceINTEL,
+		spv::Op::OpSubgroupAvcRefEvaluateWithMultiReferenceInterlacedINTEL,
+		spv::Op::OpSubgroupAvcRefConvertToMceResultINTEL,
+		spv::Op::OpSubgroupAvcSicInitializeINTEL,
+		spv::Op::OpSubgroupAvcSicConfigureSkcINTEL,
+		spv::Op::OpSubgroupAvcSicConfigureIpeLumaINTEL,
+		spv::Op::OpSubgroupAvcSicConfigureIpeLumaChromaINTEL,
+		spv::Op::OpSubgroupAvcSicGetMotionVectorMaskINTEL,
+		spv::Op::OpSubgroupAvcSicConvertToMcePayloadINTEL,
+		spv::Op::OpSubgroupAvcSicSetIntraLumaShapePenaltyINTEL,
+		spv::Op::OpSubgroupAvcSicSetIntraLumaModeCostFunctionINTEL,
+		spv::Op::OpSubgroupAvcSicSetIntraChromaModeCostFunctionINTEL,
+		spv::Op::OpSubgroupAvcSicSetBilinearFilterEnableINTEL,
+		spv::Op::OpSubgroupAvcSicSetSkcForwardTransformEnableINTEL,
+		spv::Op::OpSubgroupAvcSicSetBlockBasedRawSkipSadINTEL,
+		spv::Op::OpSubgroupAvcSicEvaluateIpeINTEL,
+		spv::Op::OpSubgroupAvcSicEvaluateWithSingleReferenceINTEL,
+		spv::Op::OpSubgroupAvcSicEvaluateWithDualReferenceINTEL,
+		spv::Op::OpSubgroupAvcSicEvaluateWithMultiReferenceINTEL,
+		spv::Op::OpSubgroupAvcSicEvaluateWithMultiReferenceInterlacedINTEL,
+		spv::Op::OpSubgroupAvcSicConvertToMceResultINTEL,
+		spv::Op::OpSubgroupAvcSicGetIpeLumaShapeINTEL,
+		spv::Op::OpSubgroupAvcSicGetBestIpeLumaDistortionINTEL,
+		spv::Op::OpSubgroupAvcSicGetBestIpeChromaDistortionINTEL,
+		spv::Op::OpSubgroupAvcSicGetPackedIpeLumaModesINTEL,
+		spv::Op::OpSubgroupAvcSicGetIpeChromaModeINTEL,
+		spv::Op::OpSubgroupAvcSicGetPackedSkcLumaCountThresholdINTEL,
+		spv::Op::OpSubgroupAvcSicGetPackedSkcLumaSumThresholdINTEL,
+		spv::Op::OpSubgroupAvcSicGetInterRawSadsINTEL,
+		spv::Op::OpVariableLengthArrayINTEL,
+		spv::Op::OpSaveMemoryINTEL,
+		spv::Op::OpRestoreMemoryINTEL,
+		spv::Op::OpArbitraryFloatSinCosPiINTEL,
+		spv::Op::OpArbitraryFloatCastINTEL,
+		spv::Op::OpArbitraryFloatCastFromIntINTEL,
+		spv::Op::OpArbitraryFloatCastToIntINTEL,
+		spv::Op::OpArbitraryFloatAddINTEL,
+		spv::Op::OpArbitraryFloatSubINTEL,
+		spv::Op::OpArbitraryFloatMulINTEL,
+		spv::Op::OpArbitraryFloatDivINTEL,
+		spv::Op::OpArbitraryFloatGTINTEL,
+		spv::Op::OpArbitraryFloatGEINTEL,
+		spv::Op::OpArbitraryFloatLTINTEL,
+		spv::Op::OpArbitraryFloatLEINTEL,
+		spv::Op::OpArbitraryFloatEQINTEL,
+		spv::Op::OpArbitraryFloatRecipINTEL,
+		spv::Op::OpArbitraryFloatRSqrtINTEL,
+		spv::Op::OpArbitraryFloatCbrtINTEL,
+		spv::Op::OpArbitraryFloatHypotINTEL,
+		spv::Op::OpArbitraryFloatSqrtINTEL,
+		spv::Op::OpArbitraryFloatLogINTEL,
+		spv::Op::OpArbitraryFloatLog2INTEL,
+		spv::Op::OpArbitraryFloatLog10INTEL,
+		spv::Op::OpArbitraryFloatLog1pINTEL,
+		spv::Op::OpArbitraryFloatExpINTEL,
+		spv::Op::OpArbitraryFloatExp2INTEL,
+		spv::Op::OpArbitraryFloatExp10INTEL,
+		spv::Op::OpArbitraryFloatExpm1INTEL,
+		spv::Op::OpArbitraryFloatSinINTEL,
+		spv::Op::OpArbitraryFloatCosINTEL,
+		spv::Op::OpArbitraryFloatSinCosINTEL,
+		spv::Op::OpArbitraryFloatSinPiINTEL,
+		spv::Op::OpArbitraryFloatCosPiINTEL,
+		spv::Op::OpArbitraryFloatASinINTEL,
+		spv::Op::OpArbitraryFloatASinPiINTEL,
+		spv::Op::OpArbitraryFloatACosINTEL,
+		spv::Op::OpArbitraryFloatACosPiINTEL,
+		spv::Op::OpArbitraryFloatATanINTEL,
+		spv::Op::OpArbitraryFloatATanPiINTEL,
+		spv::Op::OpArbitraryFloatATan2INTEL,
+		spv::Op::OpArbitraryFloatPowINTEL,
+		spv::Op::OpArbitraryFloatPowRINTEL,
+		spv::Op::OpArbitraryFloatPowNINTEL,
+		spv::Op::OpLoopControlINTEL,
+		spv::Op::OpAliasDomainDeclINTEL,
+		spv::Op::OpAliasScopeDeclINTEL,
+		spv::Op::OpAliasScopeListDeclINTEL,
+		spv::Op::OpFixedSqrtINTEL,
+		spv::Op::OpFixedRecipINTEL,
+		spv::Op::OpFixedRsqrtINTEL,
+		spv::Op::OpFixedSinINTEL,
+		spv::Op::OpFixedCosINTEL,
+		spv::Op::OpFixedSinCosINTEL,
+		spv::Op::OpFixedSinPiINTEL,
+		spv::Op::OpFixedCosPiINTEL,
+		spv::Op::OpFixedSinCosPiINTEL,
+		spv::Op::OpFixedLogINTEL,
+		spv::Op::OpFixedExpINTEL,
+		spv::Op::OpPtrCastToCrossWorkgroupINTEL,
+		spv::Op::OpCrossWorkgroupCastToPtrINTEL,
+		spv::Op::OpReadPipeBlockingINTEL,
+		spv::Op::OpWritePipeBlockingINTEL,
+		spv::Op::OpFPGARegINTEL,
+		spv::Op::OpRayQueryGetRayTMinKHR,
+		spv::Op::OpRayQueryGetRayFlagsKHR,
+		spv::Op::OpRayQueryGetIntersectionTKHR,
+		spv::Op::OpRayQueryGetIntersectionInstanceCustomIndexKHR,
+		spv::Op::OpRayQueryGetIntersectionInstanceIdKHR,
+		spv::Op::OpRayQueryGetIntersectionInstanceShaderBindingTableRecordOffsetKHR,
+		spv::Op::OpRayQueryGetIntersectionGeometryIndexKHR,
+		spv::Op::OpRayQueryGetIntersectionPrimitiveIndexKHR,
+		spv::Op::OpRayQueryGetIntersectionBarycentricsKHR,
+		spv::Op::OpRayQueryGetIntersectionFrontFaceKHR,
+		spv::Op::OpRayQueryGetIntersectionCandidateAABBOpaqueKHR,
+		spv::Op::OpRayQueryGetIntersectionObjectRayDirectionKHR,
+		spv::Op::OpRayQueryGetIntersectionObjectRayOriginKHR,
+		spv::Op::OpRayQueryGetWorldRayDirectionKHR,
+		spv::Op::OpRayQueryGetWorldRayOriginKHR,
+		spv::Op::OpRayQueryGetIntersectionObjectToWorldKHR,
+		spv::Op::OpRayQueryGetIntersectionWorldToObjectKHR,
+		spv::Op::OpAtomicFAddEXT,
+		spv::Op::OpTypeBufferSurfaceINTEL,
+		spv::Op::OpTypeStructContinuedINTEL,
+		spv::Op::OpConstantCompositeContinuedINTEL,
+		spv::Op::OpSpecConstantCompositeContinuedINTEL,
+		spv::Op::OpCompositeConstructContinuedINTEL,
+		spv::Op::OpConvertFToBF16INTEL,
+		spv::Op::OpConvertBF16ToFINTEL,
+		spv::Op::OpControlBarrierArriveINTEL,
+		spv::Op::OpControlBarrierWaitINTEL,
+		spv::Op::OpArithmeticFenceEXT,
+		spv::Op::OpTaskSequenceCreateINTEL,
+		spv::Op::OpTaskSequenceAsyncINTEL,
+		spv::Op::OpTaskSequenceGetINTEL,
+		spv::Op::OpTaskSequenceReleaseINTEL,
+		spv::Op::OpTypeTaskSequenceINTEL,
+		spv::Op::OpSubgroupBlockPrefetchINTEL,
+		spv::Op::OpSubgroup2DBlockLoadINTEL,
+		spv::Op::OpSubgroup2DBlockLoadTransformINTEL,
+		spv::Op::OpSubgroup2DBlockLoadTransposeINTEL,
+		spv::Op::OpSubgroup2DBlockPrefetchINTEL,
+		spv::Op::OpSubgroup2DBlockStoreINTEL,
+		spv::Op::OpSubgroupMatrixMultiplyAccumulateINTEL,
+		spv::Op::OpBitwiseFunctionINTEL,
+		spv::Op::OpGroupIMulKHR,
+		spv::Op::OpGroupFMulKHR,
+		spv::Op::OpGroupBitwiseAndKHR,
+		spv::Op::OpGroupBitwiseOrKHR,
+		spv::Op::OpGroupBitwiseXorKHR,
+		spv::Op::OpGroupLogicalAndKHR,
+		spv::Op::OpGroupLogicalOrKHR,
+		spv::Op::OpGroupLogicalXorKHR,
+		spv::Op::OpRoundFToTF32INTEL,
+		spv::Op::OpMaskedGatherINTEL,
+		spv::Op::OpMaskedScatterINTEL,
+	};
+
+	constexpr size_t INSTRUCTION_COUNT = std::size(INSTRUCTION_OPCODES);
+	constexpr size_t CYCLE_HISTOGRAM_SIZE = 64;
+
+	// Position of opcode in INSTRUCTION_OPCODES, INSTRUCTION_COUNT for opcodes missing from the grammar
+	constexpr size_t getInstructionIndex(spv::Op opcode)
+	{
+		auto it = std::lower_bound(std::begin(INSTRUCTION_OPCODES), std::end(INSTRUCTION_OPCODES), opcode);
+		return it != std::end(INSTRUCTION_OPCODES) && *it == opcode ? it - std::begin(INSTRUCTION_OPCODES) : INSTRUCTION_COUNT;
+	}
+
+	// Timestamp counter on x86, nanoseconds elsewhere
+	inline uint64_t readCycleCounter()
+	{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+		return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+		return __builtin_ia32_rdtsc();
+#else
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+	}
+
+	struct InstructionStats
+	{
+		spv::Op opcode{};
+		uint64_t count = 0;
+		uint64_t words = 0;
+		uint64_t cycles = 0;
+	};
+
+	// Per opcode totals of the emitted instructions, filled by the generated functions when DYNSPV_ENABLE_INSTRUMENTATION is defined.
+	// Cycles are only measured when DYNSPV_INSTRUMENT_CYCLES is defined as well.
+	class Instrumentation
+	{
+	  protected:
+		std::vector<InstructionStats> m_stats = std::vector<InstructionStats>(INSTRUCTION_COUNT);
+		// Bucket i counts the instructions that took [2^i, 2^(i+1)) cycles
+		std::array<uint64_t, CYCLE_HISTOGRAM_SIZE> m_cycleHistogram{};
+
+	  public:
+		void record(size_t index, uint64_t words, uint64_t cycles)
+		{
+			InstructionStats& stats = m_stats[index];
+			stats.count++;
+			stats.words += words;
+			stats.cycles += cycles;
+			m_cycleHistogram[std::bit_width(cycles) - (cycles != 0)]++;
+		}
+
+		// Stats of the opcodes emitted at least once, in opcode order
+		std::vector<InstructionStats> snapshot() const
+		{
+			std::vector<InstructionStats> stats;
+			for (size_t i = 0; i < INSTRUCTION_COUNT; i++)
+			{
+				if (m_stats[i].count != 0)
+				{
+					stats.push_back(m_stats[i]);
+					stats.back().opcode = INSTRUCTION_OPCODES[i];
+				}
+			}
+			return stats;
+		}
+
+		const std::array<uint64_t, CYCLE_HISTOGRAM_SIZE>& getCycleHistogram() const
+		{
+			return m_cycleHistogram;
+		}
+
+		// Writes one line per emitted opcode, largest word total first
+		void report(std::FILE* file) const
+		{
+			std::vector<InstructionStats> stats = snapshot();
+			std::sort(stats.begin(), stats.end(), [](auto&& a, auto&& b) { return a.words > b.words; });
+			std::fprintf(file, "%-8s %12s %12s %16s\n", "opcode", "count", "words", "cycles");
+			for (auto&& instructionStats : stats)
+			{
+				std::fprintf(
+					file,
+					"%-8u %12llu %12llu %16llu\n",
+					static_cast<unsigned>(instructionStats.opcode),
+					static_cast<unsigned long long>(instructionStats.count),
+					static_cast<unsigned long long>(instructionStats.words),
+					static_cast<unsigned long long>(instructionStats.cycles));
+			}
+		}
+
+		void clear()
+		{
+			std::fill(m_stats.begin(), m_stats.end(), InstructionStats{});
+			m_cycleHistogram.fill(0);
+		}
+	};
+
+	// Records the words and cycles spent between its construction and destruction, skipped during constant evaluation
+	template<typename TSink>
+	class InstrumentationScope
+	{
+	  protected:
+		Instrumentation& m_instrumentation;
+		const TSink& m_sink;
+		size_t m_index;
+		size_t m_size;
+		uint64_t m_start = 0;
+
+	  public:
+		constexpr InstrumentationScope(Instrumentation& instrumentation, const TSink& sink, size_t index)
+			: m_instrumentation(instrumentation), m_sink(sink), m_index(index), m_size(sink.size())
+		{
+#if defined(DYNSPV_INSTRUMENT_CYCLES)
+			if (!std::is_constant_evaluated())
+			{
+				m_start = readCycleCounter();
+			}
+#endif
+		}
+
+		InstrumentationScope(const InstrumentationScope&) = delete;
+		InstrumentationScope& operator=(const InstrumentationScope&) = delete;
+
+		constexpr ~InstrumentationScope()
+		{
+			if (!std::is_constant_evaluated())
+			{
+				uint64_t cycles = 0;
+#if defined(DYNSPV_INSTRUMENT_CYCLES)
+				cycles = readCycleCounter() - m_start;
+#endif
+				m_instrumentation.record(m_index, m_sink.size() - m_size, cycles);
+			}
+		}
+	};
+
+#if defined(DYNSPV_ENABLE_INSTRUMENTATION)
+#define DYNSPV_INSTRUMENT(generator, opcode) \
+	constexpr size_t instrumentationIndex = getInstructionIndex(opcode); \
+	const InstrumentationScope instrumentationScope{(generator).getInstrumentation(), (generator).getSink(), instrumentationIndex}
+#else
+#define DYNSPV_INSTRUMENT(generator, opcode)
+#endif
+
+	// Vendor instructions live in CRTP mixins, one per dynspv_<vendor>.hpp header, a generator derives from every listed one
+	template<template<typename> class... TMixins>
+	struct InstructionSets
+	{
+	};
+
+	template<typename TGenerator, typename TInstructionSets>
+	struct InstructionSetMixins;
+
+	template<typename TGenerator, template<typename> class... TMixins>
+	struct InstructionSetMixins<TGenerator, InstructionSets<TMixins...>> : public TMixins<TGenerator>...
+	{
+	};
+
+	// Appends the trailing operands of an instruction opened by a beginOp* function one at a time, straight into the sink.
+	// end() patches the header word count, no other instruction may be written before it.
+	template<typename TGenerator, typename TOperand>
+	class InstructionBuilder
+	{
+	  protected:
+		TGenerator* m_generator;
+		spv::Op m_opcode;
+
+	  public:
+		constexpr InstructionBuilder(TGenerator& generator, spv::Op opcode)
+			: m_generator(&generator), m_opcode(opcode)
+		{
+		}
+
+		constexpr InstructionBuilder& add(const TOperand& operand)
+		{
+			m_generator->writeOperands(operand);
+			return *this;
+		}
+
+		constexpr void end()
+		{
+			m_generator->endInstruction(m_opcode);
+		}
+	};
+
+	// Pair operands, e.g. the literal and label of an OpSwitch target, are added without building a tuple
+	template<typename TGenerator, typename... TElements>
+	class InstructionBuilder<TGenerator, std::tuple<TElements...>>
+	{
+	  protected:
+		TGenerator* m_generator;
+		spv::Op m_opcode;
+
+	  public:
+		constexpr InstructionBuilder(TGenerator& generator, spv::Op opcode)
+			: m_generator(&generator), m_opcode(opcode)
+		{
+		}
+
+		constexpr InstructionBuilder& add(const TElements&... elements)
+		{
+			m_generator->writeOperands(elements...);
+			return *this;
+		}
+
+		constexpr void end()
+		{
+			m_generator->endInstruction(m_opcode);
+		}
+	};
+} // namespace dynspv
\ No newline at end of file
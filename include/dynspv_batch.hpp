@@ -0,0 +1,189 @@
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include <dynspv.hpp>
+
+namespace dynspv
+{
+	// Modules stored back to back, module i is code[offsets[i], offsets[i + 1])
+	struct ModuleBatch
+	{
+		std::vector<uint32_t> code;
+		std::vector<uint64_t> offsets{0};
+
+		size_t size() const
+		{
+			return offsets.size() - 1;
+		}
+
+		std::span<const uint32_t> getModule(size_t index) const
+		{
+			return std::span{code}.subspan(offsets[index], offsets[index + 1] - offsets[index]);
+		}
+	};
+
+	// Splits [0, count) between workers, a worker that runs out of indices steals half of the range of another one
+	class WorkStealingQueue
+	{
+	  protected:
+		struct alignas(64) Range
+		{
+			std::mutex mutex;
+			size_t begin = 0;
+			size_t end = 0;
+		};
+
+		std::vector<Range> m_ranges;
+
+	  public:
+		WorkStealingQueue(size_t count, size_t workerCount)
+			: m_ranges(std::max<size_t>(workerCount, 1))
+		{
+			const size_t rangeSize = count / m_ranges.size();
+			const size_t remainder = count % m_ranges.size();
+			size_t begin = 0;
+			for (size_t i = 0; i < m_ranges.size(); i++)
+			{
+				m_ranges[i].begin = begin;
+				begin += rangeSize + (i < remainder);
+				m_ranges[i].end = begin;
+			}
+		}
+
+		// Returns the next index for worker, std::nullopt once every range is empty
+		std::optional<size_t> pop(size_t worker)
+		{
+			Range& own = m_ranges[worker];
+			{
+				std::lock_guard lock{own.mutex};
+				if (own.begin < own.end)
+				{
+					return own.begin++;
+				}
+			}
+
+			for (size_t i = 1; i < m_ranges.size(); i++)
+			{
+				Range& victim = m_ranges[(worker + i) % m_ranges.size()];
+				size_t begin = 0;
+				size_t end = 0;
+				{
+					std::lock_guard lock{victim.mutex};
+					if (victim.begin >= victim.end)
+					{
+						continue;
+					}
+
+					end = victim.end;
+					begin = end - (end - victim.begin + 1) / 2;
+					victim.end = begin;
+				}
+
+				// Nobody steals from an empty range, so the own range can be replaced without racing a thief
+				std::lock_guard lock{own.mutex};
+				own.begin = begin + 1;
+				own.end = end;
+				return begin;
+			}
+
+			return std::nullopt;
+		}
+	};
+
+	// Calls builder(generator, index) for every index in [0, moduleCount) on workerCount threads, the calling thread included.
+	// Each worker reuses one generator, builder must be safe to call concurrently and should finish its module, e.g. by
+	// calling updateBound(). The first exception thrown by builder stops the batch and is rethrown.
+	template<typename TGenerator = ModuleGenerator, typename TBuilder>
+	ModuleBatch buildBatch(size_t moduleCount, TBuilder&& builder, size_t workerCount = std::thread::hardware_concurrency())
+	{
+		workerCount = std::clamp<size_t>(workerCount, 1, std::max<size_t>(moduleCount, 1));
+		WorkStealingQueue queue{moduleCount, workerCount};
+
+		// Workers append their modules to their own buffer, the blob is assembled once every size is known
+		std::vector<std::vector<uint32_t>> workerCode(workerCount);
+		std::vector<uint32_t> moduleWorkers(moduleCount);
+		std::vector<uint64_t> moduleOffsets(moduleCount);
+		std::vector<uint64_t> moduleSizes(moduleCount);
+
+		std::atomic<bool> failed = false;
+		std::exception_ptr exception;
+		std::mutex exceptionMutex;
+
+		auto runWorker = [&](size_t worker) {
+			TGenerator generator{};
+			std::vector<uint32_t>& code = workerCode[worker];
+			try
+			{
+				while (!failed)
+				{
+					std::optional<size_t> index = queue.pop(worker);
+					if (!index.has_value())
+					{
+						break;
+					}
+
+					generator.reset();
+					builder(generator, *index);
+
+					const std::span<const uint32_t> module = generator.view();
+					moduleWorkers[*index] = static_cast<uint32_t>(worker);
+					moduleOffsets[*index] = code.size();
+					moduleSizes[*index] = module.size();
+					code.insert(code.end(), module.begin(), module.end());
+				}
+			}
+			catch (...)
+			{
+				std::lock_guard lock{exceptionMutex};
+				if (!exception)
+				{
+					exception = std::current_exception();
+				}
+				failed = true;
+			}
+		};
+
+		std::vector<std::thread> threads;
+		for (size_t worker = 1; worker < workerCount; worker++)
+		{
+			threads.emplace_back(runWorker, worker);
+		}
+		runWorker(0);
+		for (auto&& thread : threads)
+		{
+			thread.join();
+		}
+
+		if (exception)
+		{
+			std::rethrow_exception(exception);
+		}
+
+		ModuleBatch batch{};
+		batch.offsets.resize(moduleCount + 1);
+		for (size_t i = 0; i < moduleCount; i++)
+		{
+			batch.offsets[i + 1] = batch.offsets[i] + moduleSizes[i];
+		}
+
+		batch.code.resize(batch.offsets.back());
+		for (size_t i = 0; i < moduleCount; i++)
+		{
+			const uint32_t* module = workerCode[moduleWorkers[i]].data() + moduleOffsets[i];
+			std::copy(module, module + moduleSizes[i], batch.code.begin() + batch.offsets[i]);
+		}
+
+		return batch;
+	}
+} // namespace dynspv
@@ -0,0 +1,5711 @@
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include <dynspv_base.hpp>
+
+namespace dynspv
+{
+	// Core instructions only unless DYNSPV_INSTRUCTION_SETS is defined. Everything built on the default generator is a template
+	// on it, so translation units may select different sets, ModuleGenerator then names a different type in each of them.
+#ifndef DYNSPV_INSTRUCTION_SETS
+#define DYNSPV_INSTRUCTION_SETS
+#endif
+
+	using DefaultInstructionSets = InstructionSets<DYNSPV_INSTRUCTION_SETS>;
+
+	constexpr uint32_t DEFAULT_ID_BLOCK_SIZE = 256;
+
+	// Lock-free id source that can be shared between threads
+	class IdAllocator
+	{
+	  protected:
+		std::atomic<uint32_t> m_next = 1;
+
+	  public:
+		// Returns the first of count consecutive ids
+		uint32_t allocate(uint32_t count = 1)
+		{
+			return m_next.fetch_add(count, std::memory_order_relaxed);
+		}
+
+		// Gives [begin, end) back, only succeeds while it is still the most recently allocated range
+		bool release(uint32_t begin, uint32_t end)
+		{
+			uint32_t expected = end;
+			return m_next.compare_exchange_strong(expected, begin, std::memory_order_relaxed);
+		}
+
+		uint32_t getBound() const
+		{
+			return m_next.load(std::memory_order_relaxed);
+		}
+	};
+
+	// Hands out ids from blocks taken from an IdAllocator, owned by a single thread
+	class IdBlock
+	{
+	  protected:
+		IdAllocator* m_allocator;
+		uint32_t m_blockSize;
+		uint32_t m_next = 0;
+		uint32_t m_end = 0;
+
+	  public:
+		explicit IdBlock(IdAllocator& allocator, uint32_t blockSize = DEFAULT_ID_BLOCK_SIZE)
+			: m_allocator(&allocator), m_blockSize(blockSize)
+		{
+		}
+
+		IdBlock(const IdBlock&) = delete;
+		IdBlock& operator=(const IdBlock&) = delete;
+
+		~IdBlock()
+		{
+			release();
+		}
+
+		uint32_t nextId()
+		{
+			if (m_next == m_end)
+			{
+				m_next = m_allocator->allocate(m_blockSize);
+				m_end = m_next + m_blockSize;
+			}
+
+			return m_next++;
+		}
+
+		// Returns the first of count consecutive ids, taken from the current block when it has enough left
+		uint32_t allocateIds(uint32_t count)
+		{
+			if (m_end - m_next >= count)
+			{
+				const uint32_t firstId = m_next;
+				m_next += count;
+				return firstId;
+			}
+
+			return m_allocator->allocate(count);
+		}
+
+		// Returns the unused part of the current block, the ids are lost if another block was allocated after it
+		void release()
+		{
+			if (m_next != m_end)
+			{
+				m_allocator->release(m_next, m_end);
+			}
+
+			m_next = m_end = 0;
+		}
+
+		uint32_t getBlockEnd() const
+		{
+			return m_end;
+		}
+
+		uint32_t getBound() const
+		{
+			return m_allocator->getBound();
+		}
+	};
+
+	template<spvSink TSink = VectorSink, typename TInstructionSets = DefaultInstructionSets>
+	class BasicModuleGenerator : public InstructionSetMixins<BasicModuleGenerator<TSink, TInstructionSets>, TInstructionSets>
+	{
+	  protected:
+		TSink m_sink;
+
+		uint32_t m_id = 1;
+		// Replaces m_id as the id source when set, so every layer on top of the generator draws from it
+		IdBlock* m_idBlock = nullptr;
+		size_t m_lastInstruction{0};
+		// Start of the instruction opened by beginInstruction(), it becomes the last instruction at endInstruction()
+		size_t m_openInstructionBegin{0};
+
+		bool m_stripDebugInfo = false;
+		// Ids of the imports skipped while stripping, see isStrippedExtInstSetName(), their OpExtInst are skipped too
+		std::vector<uint32_t> m_strippedExtInstSets;
+
+#if defined(DYNSPV_ENABLE_INSTRUMENTATION)
+		Instrumentation m_instrumentation;
+#endif
+
+		FingerprintMode m_fingerprintMode = FingerprintMode::Disabled;
+		uint64_t m_fingerprint = FINGERPRINT_SEED;
+		// Copy of the open instruction for sinks that cannot read back their code, e.g. StreamSink
+		std::vector<uint32_t> m_openInstruction;
+
+		// Chains the words of one instruction into the fingerprint
+		constexpr void updateFingerprint(const uint32_t* words, size_t wordCount)
+		{
+			if (m_fingerprintMode == FingerprintMode::Disabled)
+			{
+				return;
+			}
+			if (m_fingerprintMode == FingerprintMode::ExcludeDebugInfo && isDebugInstruction(static_cast<spv::Op>(words[0] & 0xffff)))
+			{
+				return;
+			}
+
+			m_fingerprint = hashWords({words, wordCount}, m_fingerprint);
+		}
+
+		// Keeps the words of the open instruction when the sink cannot hand them back at endInstruction()
+		constexpr void copyOpenInstruction(const uint32_t* words, size_t wordCount)
+		{
+			if constexpr (!requires { m_sink.data(); })
+			{
+				if (m_fingerprintMode != FingerprintMode::Disabled)
+				{
+					m_openInstruction.insert(m_openInstruction.end(), words, words + wordCount);
+				}
+			}
+		}
+
+		constexpr bool stripExtInstImport(IdResult id, std::string_view name)
+		{
+			if (!m_stripDebugInfo || !isStrippedExtInstSetName(name))
+			{
+				return false;
+			}
+
+			m_strippedExtInstSets.push_back(id);
+			return true;
+		}
+
+	  public:
+		constexpr BasicModuleGenerator() = default;
+
+		explicit constexpr BasicModuleGenerator(TSink sink)
+			: m_sink(std::move(sink))
+		{
+		}
+
+		constexpr TSink& getSink()
+		{
+			return m_sink;
+		}
+
+		constexpr const TSink& getSink() const
+		{
+			return m_sink;
+		}
+
+		// Ids come from block until it is reset to nullptr, block must outlive the generator and its copies
+		constexpr void setIdBlock(IdBlock* block)
+		{
+			m_idBlock = block;
+		}
+
+		constexpr uint32_t nextId()
+		{
+			if (m_idBlock != nullptr)
+			{
+				return m_idBlock->nextId();
+			}
+			return m_id++;
+		}
+
+		// Returns the first of count consecutive ids
+		constexpr uint32_t allocateIds(uint32_t count)
+		{
+			if (m_idBlock != nullptr)
+			{
+				return m_idBlock->allocateIds(count);
+			}
+			const uint32_t firstId = m_id;
+			m_id += count;
+			return firstId;
+		}
+
+		// Debug instructions and the extended instructions of NonSemantic.* and the debug info sets become no-ops,
+		// their strings are never encoded
+		constexpr void setStripDebugInfo(bool strip)
+		{
+			m_stripDebugInfo = strip;
+		}
+
+		constexpr bool getStripDebugInfo() const
+		{
+			return m_stripDebugInfo;
+		}
+
+		constexpr bool isStrippedExtInstSet(IdRef set) const
+		{
+			return std::find(m_strippedExtInstSets.begin(), m_strippedExtInstSets.end(), set) != m_strippedExtInstSets.end();
+		}
+
+#if defined(DYNSPV_ENABLE_INSTRUMENTATION)
+		constexpr Instrumentation& getInstrumentation()
+		{
+			return m_instrumentation;
+		}
+#endif
+
+		// Instructions emitted after this call are hashed as they are written, the header is never part of the fingerprint
+		constexpr void setFingerprintMode(FingerprintMode mode)
+		{
+			m_fingerprintMode = mode;
+		}
+
+		// The bound hashed with includeBound is getBound(), not the value passed to updateBound()
+		constexpr uint64_t getFingerprint(bool includeBound = false) const
+		{
+			const uint32_t bound = getBound();
+			return includeBound ? hashWords({&bound, 1}, m_fingerprint) : m_fingerprint;
+		}
+
+		constexpr uint32_t getBound() const
+		{
+			if (m_idBlock != nullptr)
+			{
+				return m_idBlock->getBound();
+			}
+			return m_id;
+		}
+
+		constexpr decltype(auto) getCode()
+			requires requires(TSink& sink) { sink.getCode(); }
+		{
+			return m_sink.getCode();
+		}
+
+		// Emitted words, unlike getCode() it never resizes the underlying buffer
+		constexpr std::span<const uint32_t> view() const
+			requires requires(const TSink& sink) { sink.data(); }
+		{
+			return {m_sink.data(), m_sink.size()};
+		}
+
+		ModuleSnapshot snapshot() const
+			requires requires(const TSink& sink) { sink.data(); }
+		{
+			const std::span<const uint32_t> code = view();
+			return {{code.begin(), code.end()}, m_id, m_fingerprint, m_strippedExtInstSets};
+		}
+
+		// Discards the current module and continues from snapshot, the prefix is copied in one go
+		void restore(const ModuleSnapshot& snapshot)
+			requires requires(TSink& sink) { sink.clear(); }
+		{
+			m_sink.clear();
+			std::copy(snapshot.code.begin(), snapshot.code.end(), m_sink.reserve(snapshot.code.size()));
+			m_id = snapshot.nextId;
+			m_lastInstruction = 0;
+			m_strippedExtInstSets = snapshot.strippedExtInstSets;
+			m_fingerprint = snapshot.fingerprint;
+			m_openInstruction.clear();
+		}
+
+		// Rewinds the generator so the next module reuses the current allocation
+		constexpr void reset()
+			requires requires(TSink& sink) { sink.clear(); }
+		{
+			m_sink.clear();
+			m_id = 1;
+			m_lastInstruction = 0;
+			m_strippedExtInstSets.clear();
+			m_fingerprint = FINGERPRINT_SEED;
+			m_openInstruction.clear();
+		}
+
+		constexpr void writeWord(uint32_t val)
+		{
+			*m_sink.reserve(1) = val;
+		}
+
+		constexpr void writeWord(uint16_t low, uint16_t high)
+		{
+			uint32_t word = (static_cast<uint32_t>(high) << 16) | static_cast<uint32_t>(low);
+			writeWord(word);
+		}
+
+		template<typename T>
+		constexpr void writeWord(const T& val)
+		{
+			size_t wordCount = 0;
+			countOperandWord(wordCount, val);
+
+			uint32_t* words = m_sink.reserve(wordCount);
+			encodeWord(words, val);
+		}
+
+		template<typename... TArgs>
+		constexpr void writeWords(const TArgs&... args)
+		{
+			(writeWord(args), ...);
+		}
+
+		// Reserves the whole instruction once, then stores its words without further capacity checks.
+		// Throws std::length_error before writing anything when wordCount does not fit the header.
+		template<typename... TArgs>
+		constexpr void writeInstruction(spv::Op opcode, size_t wordCount, const TArgs&... args)
+		{
+			checkInstructionWordCount(wordCount);
+			m_lastInstruction = m_sink.size();
+			uint32_t* words = m_sink.reserve(wordCount);
+			words[0] = makeInstructionHeader(opcode, static_cast<uint16_t>(wordCount));
+			uint32_t* operands = words + 1;
+			encodeWords(operands, args...);
+			updateFingerprint(words, wordCount);
+		}
+
+		// Instructions without variable sized operands, the header is a compile-time constant and
+		// the words are stored straight from registers after a single reservation
+		template<std::convertible_to<uint32_t>... TWords>
+		constexpr void writeFixedInstruction(uint32_t header, TWords... operands)
+		{
+			m_lastInstruction = m_sink.size();
+			uint32_t* words = m_sink.reserve(sizeof...(TWords) + 1);
+			words[0] = header;
+
+			size_t i = 1;
+			((words[i++] = operands), ...);
+			updateFingerprint(words, sizeof...(TWords) + 1);
+		}
+
+		// Opens an instruction whose word count is only known once its trailing operands are written,
+		// the header is a placeholder until endInstruction()
+		template<typename... TArgs>
+		constexpr void beginInstruction(const TArgs&... args)
+		{
+			size_t wordCount = 1;
+			countOperandsWord(wordCount, args...);
+			checkInstructionWordCount(wordCount);
+			m_openInstructionBegin = m_sink.size();
+			uint32_t* words = m_sink.reserve(wordCount);
+			words[0] = 0;
+			uint32_t* operands = words + 1;
+			encodeWords(operands, args...);
+			m_openInstruction.clear();
+			copyOpenInstruction(words, wordCount);
+		}
+
+		// Appends operands to the open instruction with a single reservation.
+		// Throws std::length_error when the instruction would exceed 65535 words, the open instruction is dropped
+		// first for sinks with truncate() so the sink is left as before beginInstruction().
+		template<typename... TArgs>
+		constexpr void writeOperands(const TArgs&... args)
+		{
+			size_t wordCount = 0;
+			countOperandsWord(wordCount, args...);
+			const size_t instructionWordCount = m_sink.size() - m_openInstructionBegin + wordCount;
+			if (instructionWordCount > MAX_INSTRUCTION_WORD_COUNT)
+			{
+				if constexpr (requires { m_sink.truncate(m_openInstructionBegin); })
+				{
+					m_sink.truncate(m_openInstructionBegin);
+				}
+				m_openInstruction.clear();
+				checkInstructionWordCount(instructionWordCount);
+			}
+			uint32_t* words = m_sink.reserve(wordCount);
+			uint32_t* operands = words;
+			encodeWords(operands, args...);
+			copyOpenInstruction(words, wordCount);
+		}
+
+		// The word count was checked as the operands were written
+		constexpr void endInstruction(spv::Op opcode)
+		{
+			m_lastInstruction = m_openInstructionBegin;
+			const size_t wordCount = m_sink.size() - m_lastInstruction;
+			const uint32_t header = makeInstructionHeader(opcode, static_cast<uint16_t>(wordCount));
+			m_sink.patch(m_lastInstruction, header);
+
+#if defined(DYNSPV_ENABLE_INSTRUMENTATION)
+			if (!std::is_constant_evaluated())
+			{
+				m_instrumentation.record(getInstructionIndex(opcode), wordCount, 0);
+			}
+#endif
+			if constexpr (requires { m_sink.data(); })
+			{
+				updateFingerprint(m_sink.data() + m_lastInstruction, wordCount);
+			}
+			else if (m_openInstruction.size() == wordCount)
+			{
+				m_openInstruction[0] = header;
+				updateFingerprint(m_openInstruction.data(), wordCount);
+			}
+		}
+
+		// Emits one OpConstant of type per value with the ids [firstId, firstId + size) and a single reservation.
+		// values is a contiguous range of scalars, e.g. a std::span<const float>. See dynspv::writeConstants() to allocate the ids.
+		template<std::ranges::contiguous_range TValues>
+			requires spvConstant<std::ranges::range_value_t<TValues>>
+		constexpr void writeConstants(IdResultType type, IdResult firstId, const TValues& table)
+		{
+			using T = std::ranges::range_value_t<TValues>;
+			const std::span<const T> values{table};
+			constexpr uint16_t instructionWordCount = 3 + (sizeof(T) + 3) / sizeof(uint32_t);
+			if (values.empty())
+			{
+				return;
+			}
+
+			m_lastInstruction = m_sink.size() + (values.size() - 1) * instructionWordCount;
+			uint32_t* words = m_sink.reserve(values.size() * instructionWordCount);
+			uint32_t* instructions = words;
+			encodeConstants(instructions, makeInstructionHeader(spv::Op::OpConstant, instructionWordCount), type, firstId, values);
+
+			for (size_t i = 0; i < values.size() && m_fingerprintMode != FingerprintMode::Disabled; i++)
+			{
+				updateFingerprint(words + i * instructionWordCount, instructionWordCount);
+			}
+#if defined(DYNSPV_ENABLE_INSTRUMENTATION)
+			if (!std::is_constant_evaluated())
+			{
+				for (size_t i = 0; i < values.size(); i++)
+				{
+					m_instrumentation.record(getInstructionIndex(spv::Op::OpConstant), instructionWordCount, 0);
+				}
+			}
+#endif
+		}
+
+		// OpConstantComposite of compositeType over the constituentCount consecutive ids starting at firstConstituent.
+		// Throws std::length_error before writing anything when it would exceed 65535 words.
+		constexpr void writeConstantComposite(IdResultType compositeType, IdResult compositeId, IdRef firstConstituent, size_t constituentCount)
+		{
+			const size_t wordCount = constituentCount + 3;
+			checkInstructionWordCount(wordCount);
+
+			m_lastInstruction = m_sink.size();
+			uint32_t* words = m_sink.reserve(wordCount);
+			words[0] = makeInstructionHeader(spv::Op::OpConstantComposite, static_cast<uint16_t>(wordCount));
+			words[1] = compositeType;
+			words[2] = compositeId;
+			std::iota(words + 3, words + wordCount, firstConstituent);
+			updateFingerprint(words, wordCount);
+#if defined(DYNSPV_ENABLE_INSTRUMENTATION)
+			if (!std::is_constant_evaluated())
+			{
+				m_instrumentation.record(getInstructionIndex(spv::Op::OpConstantComposite), wordCount, 0);
+			}
+#endif
+		}
+
+		// Appends already encoded words, e.g. a module fragment produced by another generator
+		constexpr void writeCode(std::span<const uint32_t> code)
+		{
+			std::copy(code.begin(), code.end(), m_sink.reserve(code.size()));
+
+			// Hashed per instruction, so the fingerprint matches emitting the instructions one by one
+			if (m_fingerprintMode != FingerprintMode::Disabled)
+			{
+				for (size_t i = 0; i < code.size() && (code[i] >> 16) != 0; i += code[i] >> 16)
+				{
+					updateFingerprint(code.data() + i, std::min<size_t>(code[i] >> 16, code.size() - i));
+				}
+			}
+		}
+
+		constexpr void writeMagicNumber()
+		{
+			writeWord(spv::MagicNumber);
+		}
+
+		constexpr void writeVersionNumber(uint32_t version = spv::Version)
+		{
+			writeWord(version);
+		}
+
+		constexpr void writeGeneratorMagicNumber()
+		{
+			writeWord(0);
+		}
+
+		constexpr void writeBound(uint32_t bound = 0)
+		{
+			writeWord(bound);
+		}
+
+		// Records words of the most recently emitted instruction for later patching, wordOffset 0 is its header.
+		// e.g. OpSpecConstant(type, id, 1.0f) followed by relocateLastInstruction(3) covers the value.
+		constexpr Relocation relocateLastInstruction(size_t wordOffset, uint16_t wordCount = 1) const
+		{
+			return {m_lastInstruction + wordOffset, wordCount};
+		}
+
+		// Rewrites the literal covered by relocation in O(1), the value must have the relocated size
+		constexpr void patch(const Relocation& relocation, const auto& value)
+		{
+			std::array<uint32_t, 2> words = encodeRelocatedValue(relocation, value);
+			for (size_t i = 0; i < relocation.wordCount; i++)
+			{
+				m_sink.patch(relocation.wordIndex + i, words[i]);
+			}
+		}
+
+		constexpr void updateBound(uint32_t bound)
+		{
+			m_sink.patch(BOUND_INDEX, bound);
+		}
+
+		constexpr void writeInstructionSchema()
+		{
+			writeWord(0);
+		}
+
+		constexpr void writeHeader(uint32_t version = spv::Version)
+		{
+			writeMagicNumber();
+			writeVersionNumber(version);
+			writeGeneratorMagicNumber();
+			writeBound();
+			writeInstructionSchema();
+		}
+
+		constexpr void OpAccessChain(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef base,
+			OperandList<IdRef> indexes = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpAccessChain);
+
+			size_t wordCount = 4;
+			countOperandsWord(wordCount, indexes);
+
+			writeInstruction(spv::Op::OpAccessChain, wordCount, idResultType, idResult, base, indexes);
+		}
+
+		constexpr InstructionBuilder<BasicModuleGenerator, IdRef> beginOpAccessChain(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef base)
+		{
+			beginInstruction(idResultType, idResult, base);
+			return {*this, spv::Op::OpAccessChain};
+		}
+
+		constexpr void OpAll(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef vector)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpAll);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAll, 4);
+			writeFixedInstruction(header, idResultType, idResult, vector);
+		}
+
+		constexpr void OpAny(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef vector)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpAny);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAny, 4);
+			writeFixedInstruction(header, idResultType, idResult, vector);
+		}
+
+		constexpr void OpArrayLength(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef structure,
+			uint32_t arrayMember)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpArrayLength);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArrayLength, 5);
+			writeFixedInstruction(header, idResultType, idResult, structure, arrayMember);
+		}
+
+		constexpr void OpAtomicAnd(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer,
+			IdScope memory,
+			IdMemorySemantics semantics,
+			IdRef value)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpAtomicAnd);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAtomicAnd, 7);
+			writeFixedInstruction(header, idResultType, idResult, pointer, memory, semantics, value);
+		}
+
+		constexpr void OpAtomicCompareExchange(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer,
+			IdScope memory,
+			IdMemorySemantics equal,
+			IdMemorySemantics unequal,
+			IdRef value,
+			IdRef comparator)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpAtomicCompareExchange);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAtomicCompareExchange, 9);
+			writeFixedInstruction(header, idResultType, idResult, pointer, memory, equal, unequal, value, comparator);
+		}
+
+		constexpr void OpAtomicCompareExchangeWeak(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer,
+			IdScope memory,
+			IdMemorySemantics equal,
+			IdMemorySemantics unequal,
+			IdRef value,
+			IdRef comparator)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpAtomicCompareExchangeWeak);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAtomicCompareExchangeWeak, 9);
+			writeFixedInstruction(header, idResultType, idResult, pointer, memory, equal, unequal, value, comparator);
+		}
+
+		constexpr void OpAtomicExchange(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer,
+			IdScope memory,
+			IdMemorySemantics semantics,
+			IdRef value)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpAtomicExchange);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAtomicExchange, 7);
+			writeFixedInstruction(header, idResultType, idResult, pointer, memory, semantics, value);
+		}
+
+		constexpr void OpAtomicFlagClear(
+			IdRef pointer,
+			IdScope memory,
+			IdMemorySemantics semantics)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpAtomicFlagClear);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAtomicFlagClear, 4);
+			writeFixedInstruction(header, pointer, memory, semantics);
+		}
+
+		constexpr void OpAtomicFlagTestAndSet(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer,
+			IdScope memory,
+			IdMemorySemantics semantics)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpAtomicFlagTestAndSet);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAtomicFlagTestAndSet, 6);
+			writeFixedInstruction(header, idResultType, idResult, pointer, memory, semantics);
+		}
+
+		constexpr void OpAtomicIAdd(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer,
+			IdScope memory,
+			IdMemorySemantics semantics,
+			IdRef value)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpAtomicIAdd);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAtomicIAdd, 7);
+			writeFixedInstruction(header, idResultType, idResult, pointer, memory, semantics, value);
+		}
+
+		constexpr void OpAtomicIDecrement(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer,
+			IdScope memory,
+			IdMemorySemantics semantics)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpAtomicIDecrement);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAtomicIDecrement, 6);
+			writeFixedInstruction(header, idResultType, idResult, pointer, memory, semantics);
+		}
+
+		constexpr void OpAtomicIIncrement(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer,
+			IdScope memory,
+			IdMemorySemantics semantics)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpAtomicIIncrement);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAtomicIIncrement, 6);
+			writeFixedInstruction(header, idResultType, idResult, pointer, memory, semantics);
+		}
+
+		constexpr void OpAtomicISub(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer,
+			IdScope memory,
+			IdMemorySemantics semantics,
+			IdRef value)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpAtomicISub);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAtomicISub, 7);
+			writeFixedInstruction(header, idResultType, idResult, pointer, memory, semantics, value);
+		}
+
+		constexpr void OpAtomicLoad(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer,
+			IdScope memory,
+			IdMemorySemantics semantics)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpAtomicLoad);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAtomicLoad, 6);
+			writeFixedInstruction(header, idResultType, idResult, pointer, memory, semantics);
+		}
+
+		constexpr void OpAtomicOr(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer,
+			IdScope memory,
+			IdMemorySemantics semantics,
+			IdRef value)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpAtomicOr);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAtomicOr, 7);
+			writeFixedInstruction(header, idResultType, idResult, pointer, memory, semantics, value);
+		}
+
+		constexpr void OpAtomicSMax(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer,
+			IdScope memory,
+			IdMemorySemantics semantics,
+			IdRef value)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpAtomicSMax);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAtomicSMax, 7);
+			writeFixedInstruction(header, idResultType, idResult, pointer, memory, semantics, value);
+		}
+
+		constexpr void OpAtomicSMin(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer,
+			IdScope memory,
+			IdMemorySemantics semantics,
+			IdRef value)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpAtomicSMin);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAtomicSMin, 7);
+			writeFixedInstruction(header, idResultType, idResult, pointer, memory, semantics, value);
+		}
+
+		constexpr void OpAtomicStore(
+			IdRef pointer,
+			IdScope memory,
+			IdMemorySemantics semantics,
+			IdRef value)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpAtomicStore);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAtomicStore, 5);
+			writeFixedInstruction(header, pointer, memory, semantics, value);
+		}
+
+		constexpr void OpAtomicUMax(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer,
+			IdScope memory,
+			IdMemorySemantics semantics,
+			IdRef value)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpAtomicUMax);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAtomicUMax, 7);
+			writeFixedInstruction(header, idResultType, idResult, pointer, memory, semantics, value);
+		}
+
+		constexpr void OpAtomicUMin(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer,
+			IdScope memory,
+			IdMemorySemantics semantics,
+			IdRef value)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpAtomicUMin);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAtomicUMin, 7);
+			writeFixedInstruction(header, idResultType, idResult, pointer, memory, semantics, value);
+		}
+
+		constexpr void OpAtomicXor(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer,
+			IdScope memory,
+			IdMemorySemantics semantics,
+			IdRef value)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpAtomicXor);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAtomicXor, 7);
+			writeFixedInstruction(header, idResultType, idResult, pointer, memory, semantics, value);
+		}
+
+		constexpr void OpBitCount(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef base)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpBitCount);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpBitCount, 4);
+			writeFixedInstruction(header, idResultType, idResult, base);
+		}
+
+		constexpr void OpBitFieldInsert(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef base,
+			IdRef insert,
+			IdRef offset,
+			IdRef count)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpBitFieldInsert);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpBitFieldInsert, 7);
+			writeFixedInstruction(header, idResultType, idResult, base, insert, offset, count);
+		}
+
+		constexpr void OpBitFieldSExtract(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef base,
+			IdRef offset,
+			IdRef count)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpBitFieldSExtract);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpBitFieldSExtract, 6);
+			writeFixedInstruction(header, idResultType, idResult, base, offset, count);
+		}
+
+		constexpr void OpBitFieldUExtract(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef base,
+			IdRef offset,
+			IdRef count)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpBitFieldUExtract);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpBitFieldUExtract, 6);
+			writeFixedInstruction(header, idResultType, idResult, base, offset, count);
+		}
+
+		constexpr void OpBitReverse(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef base)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpBitReverse);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpBitReverse, 4);
+			writeFixedInstruction(header, idResultType, idResult, base);
+		}
+
+		constexpr void OpBitcast(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpBitcast);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpBitcast, 4);
+			writeFixedInstruction(header, idResultType, idResult, operand);
+		}
+
+		constexpr void OpBitwiseAnd(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpBitwiseAnd);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpBitwiseAnd, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpBitwiseOr(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpBitwiseOr);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpBitwiseOr, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpBitwiseXor(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpBitwiseXor);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpBitwiseXor, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpBranch(IdRef targetLabel)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpBranch);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpBranch, 2);
+			writeFixedInstruction(header, targetLabel);
+		}
+
+		constexpr void OpBranchConditional(
+			IdRef condition,
+			IdRef trueLabel,
+			IdRef falseLabel,
+			OperandList<uint32_t> branchWeights = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpBranchConditional);
+
+			size_t wordCount = 4;
+			countOperandsWord(wordCount, branchWeights);
+
+			writeInstruction(spv::Op::OpBranchConditional, wordCount, condition, trueLabel, falseLabel, branchWeights);
+		}
+
+		constexpr InstructionBuilder<BasicModuleGenerator, uint32_t> beginOpBranchConditional(
+			IdRef condition,
+			IdRef trueLabel,
+			IdRef falseLabel)
+		{
+			beginInstruction(condition, trueLabel, falseLabel);
+			return {*this, spv::Op::OpBranchConditional};
+		}
+
+		constexpr void OpBuildNDRange(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef globalWorkSize,
+			IdRef localWorkSize,
+			IdRef globalWorkOffset)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpBuildNDRange);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpBuildNDRange, 6);
+			writeFixedInstruction(header, idResultType, idResult, globalWorkSize, localWorkSize, globalWorkOffset);
+		}
+
+		constexpr void OpCapability(spv::Capability capability)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpCapability);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpCapability, 2);
+			writeFixedInstruction(header, static_cast<uint32_t>(capability));
+		}
+
+		constexpr void OpCaptureEventProfilingInfo(
+			IdRef event,
+			IdRef profilingInfo,
+			IdRef value)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpCaptureEventProfilingInfo);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpCaptureEventProfilingInfo, 4);
+			writeFixedInstruction(header, event, profilingInfo, value);
+		}
+
+		constexpr void OpCommitReadPipe(
+			IdRef pipe,
+			IdRef reserveId,
+			IdRef packetSize,
+			IdRef packetAlignment)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpCommitReadPipe);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpCommitReadPipe, 5);
+			writeFixedInstruction(header, pipe, reserveId, packetSize, packetAlignment);
+		}
+
+		constexpr void OpCommitWritePipe(
+			IdRef pipe,
+			IdRef reserveId,
+			IdRef packetSize,
+			IdRef packetAlignment)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpCommitWritePipe);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpCommitWritePipe, 5);
+			writeFixedInstruction(header, pipe, reserveId, packetSize, packetAlignment);
+		}
+
+		constexpr void OpCompositeConstruct(
+			IdResultType idResultType,
+			IdResult idResult,
+			OperandList<IdRef> constituents = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpCompositeConstruct);
+
+			size_t wordCount = 3;
+			countOperandsWord(wordCount, constituents);
+
+			writeInstruction(spv::Op::OpCompositeConstruct, wordCount, idResultType, idResult, constituents);
+		}
+
+		constexpr InstructionBuilder<BasicModuleGenerator, IdRef> beginOpCompositeConstruct(
+			IdResultType idResultType,
+			IdResult idResult)
+		{
+			beginInstruction(idResultType, idResult);
+			return {*this, spv::Op::OpCompositeConstruct};
+		}
+
+		constexpr void OpCompositeExtract(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef composite,
+			OperandList<uint32_t> indexes = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpCompositeExtract);
+
+			size_t wordCount = 4;
+			countOperandsWord(wordCount, indexes);
+
+			writeInstruction(spv::Op::OpCompositeExtract, wordCount, idResultType, idResult, composite, indexes);
+		}
+
+		constexpr InstructionBuilder<BasicModuleGenerator, uint32_t> beginOpCompositeExtract(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef composite)
+		{
+			beginInstruction(idResultType, idResult, composite);
+			return {*this, spv::Op::OpCompositeExtract};
+		}
+
+		constexpr void OpCompositeInsert(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef object,
+			IdRef composite,
+			OperandList<uint32_t> indexes = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpCompositeInsert);
+
+			size_t wordCount = 5;
+			countOperandsWord(wordCount, indexes);
+
+			writeInstruction(spv::Op::OpCompositeInsert, wordCount, idResultType, idResult, object, composite, indexes);
+		}
+
+		constexpr InstructionBuilder<BasicModuleGenerator, uint32_t> beginOpCompositeInsert(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef object,
+			IdRef composite)
+		{
+			beginInstruction(idResultType, idResult, object, composite);
+			return {*this, spv::Op::OpCompositeInsert};
+		}
+
+		constexpr void OpConstant(
+			IdResultType idResultType,
+			IdResult idResult,
+			spvConstant auto value)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpConstant);
+
+			size_t wordCount = 3;
+			countOperandsWord(wordCount, value);
+
+			writeInstruction(spv::Op::OpConstant, wordCount, idResultType, idResult, value);
+		}
+
+		constexpr void OpConstantComposite(
+			IdResultType idResultType,
+			IdResult idResult,
+			OperandList<IdRef> constituents = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpConstantComposite);
+
+			size_t wordCount = 3;
+			countOperandsWord(wordCount, constituents);
+
+			writeInstruction(spv::Op::OpConstantComposite, wordCount, idResultType, idResult, constituents);
+		}
+
+		constexpr InstructionBuilder<BasicModuleGenerator, IdRef> beginOpConstantComposite(
+			IdResultType idResultType,
+			IdResult idResult)
+		{
+			beginInstruction(idResultType, idResult);
+			return {*this, spv::Op::OpConstantComposite};
+		}
+
+		constexpr void OpConstantFalse(
+			IdResultType idResultType,
+			IdResult idResult)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpConstantFalse);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpConstantFalse, 3);
+			writeFixedInstruction(header, idResultType, idResult);
+		}
+
+		constexpr void OpConstantNull(
+			IdResultType idResultType,
+			IdResult idResult)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpConstantNull);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpConstantNull, 3);
+			writeFixedInstruction(header, idResultType, idResult);
+		}
+
+		constexpr void OpConstantPipeStorage(
+			IdResultType idResultType,
+			IdResult idResult,
+			uint32_t packetSize,
+			uint32_t packetAlignment,
+			uint32_t capacity)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpConstantPipeStorage);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpConstantPipeStorage, 6);
+			writeFixedInstruction(header, idResultType, idResult, packetSize, packetAlignment, capacity);
+		}
+
+		constexpr void OpConstantSampler(
+			IdResultType idResultType,
+			IdResult idResult,
+			spv::SamplerAddressingMode samplerAddressingMode,
+			uint32_t param,
+			spv::SamplerFilterMode samplerFilterMode)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpConstantSampler);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpConstantSampler, 6);
+			writeFixedInstruction(header, idResultType, idResult, static_cast<uint32_t>(samplerAddressingMode), param, static_cast<uint32_t>(samplerFilterMode));
+		}
+
+		constexpr void OpConstantTrue(
+			IdResultType idResultType,
+			IdResult idResult)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpConstantTrue);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpConstantTrue, 3);
+			writeFixedInstruction(header, idResultType, idResult);
+		}
+
+		constexpr void OpControlBarrier(
+			IdScope execution,
+			IdScope memory,
+			IdMemorySemantics semantics)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpControlBarrier);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpControlBarrier, 4);
+			writeFixedInstruction(header, execution, memory, semantics);
+		}
+
+		constexpr void OpConvertFToS(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef floatValue)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpConvertFToS);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpConvertFToS, 4);
+			writeFixedInstruction(header, idResultType, idResult, floatValue);
+		}
+
+		constexpr void OpConvertFToU(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef floatValue)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpConvertFToU);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpConvertFToU, 4);
+			writeFixedInstruction(header, idResultType, idResult, floatValue);
+		}
+
+		constexpr void OpConvertPtrToU(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpConvertPtrToU);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpConvertPtrToU, 4);
+			writeFixedInstruction(header, idResultType, idResult, pointer);
+		}
+
+		constexpr void OpConvertSToF(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef signedValue)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpConvertSToF);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpConvertSToF, 4);
+			writeFixedInstruction(header, idResultType, idResult, signedValue);
+		}
+
+		constexpr void OpConvertUToF(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef unsignedValue)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpConvertUToF);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpConvertUToF, 4);
+			writeFixedInstruction(header, idResultType, idResult, unsignedValue);
+		}
+
+		constexpr void OpConvertUToPtr(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef integerValue)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpConvertUToPtr);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpConvertUToPtr, 4);
+			writeFixedInstruction(header, idResultType, idResult, integerValue);
+		}
+
+		constexpr void OpCopyLogical(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpCopyLogical);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpCopyLogical, 4);
+			writeFixedInstruction(header, idResultType, idResult, operand);
+		}
+
+		constexpr void OpCopyMemory(
+			IdRef target,
+			IdRef source,
+			std::optional<spv::MemoryAccessMask> memoryAccess1 = {},
+			std::optional<spv::MemoryAccessMask> memoryAccess2 = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpCopyMemory);
+
+			size_t wordCount = 3;
+			countOperandsWord(wordCount, memoryAccess1, memoryAccess2);
+
+			writeInstruction(spv::Op::OpCopyMemory, wordCount, target, source, memoryAccess1, memoryAccess2);
+		}
+
+		constexpr void OpCopyMemorySized(
+			IdRef target,
+			IdRef source,
+			IdRef size,
+			std::optional<spv::MemoryAccessMask> memoryAccess1 = {},
+			std::optional<spv::MemoryAccessMask> memoryAccess2 = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpCopyMemorySized);
+
+			size_t wordCount = 4;
+			countOperandsWord(wordCount, memoryAccess1, memoryAccess2);
+
+			writeInstruction(spv::Op::OpCopyMemorySized, wordCount, target, source, size, memoryAccess1, memoryAccess2);
+		}
+
+		constexpr void OpCopyObject(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpCopyObject);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpCopyObject, 4);
+			writeFixedInstruction(header, idResultType, idResult, operand);
+		}
+
+		constexpr void OpCreatePipeFromPipeStorage(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pipeStorage)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpCreatePipeFromPipeStorage);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpCreatePipeFromPipeStorage, 4);
+			writeFixedInstruction(header, idResultType, idResult, pipeStorage);
+		}
+
+		constexpr void OpCreateUserEvent(
+			IdResultType idResultType,
+			IdResult idResult)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpCreateUserEvent);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpCreateUserEvent, 3);
+			writeFixedInstruction(header, idResultType, idResult);
+		}
+
+		constexpr void OpDPdx(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef P)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpDPdx);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpDPdx, 4);
+			writeFixedInstruction(header, idResultType, idResult, P);
+		}
+
+		constexpr void OpDPdxCoarse(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef P)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpDPdxCoarse);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpDPdxCoarse, 4);
+			writeFixedInstruction(header, idResultType, idResult, P);
+		}
+
+		constexpr void OpDPdxFine(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef P)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpDPdxFine);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpDPdxFine, 4);
+			writeFixedInstruction(header, idResultType, idResult, P);
+		}
+
+		constexpr void OpDPdy(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef P)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpDPdy);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpDPdy, 4);
+			writeFixedInstruction(header, idResultType, idResult, P);
+		}
+
+		constexpr void OpDPdyCoarse(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef P)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpDPdyCoarse);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpDPdyCoarse, 4);
+			writeFixedInstruction(header, idResultType, idResult, P);
+		}
+
+		constexpr void OpDPdyFine(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef P)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpDPdyFine);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpDPdyFine, 4);
+			writeFixedInstruction(header, idResultType, idResult, P);
+		}
+
+		constexpr void OpDecorate(
+			IdRef target,
+			spv::Decoration decoration)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpDecorate);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpDecorate, 3);
+			writeFixedInstruction(header, target, static_cast<uint32_t>(decoration));
+		}
+
+		constexpr void OpDecorateId(
+			IdRef target,
+			spv::Decoration decoration)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpDecorateId);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpDecorateId, 3);
+			writeFixedInstruction(header, target, static_cast<uint32_t>(decoration));
+		}
+
+		constexpr void OpDecorateString(
+			IdRef target,
+			spv::Decoration decoration)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpDecorateString);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpDecorateString, 3);
+			writeFixedInstruction(header, target, static_cast<uint32_t>(decoration));
+		}
+
+		constexpr void OpDecorationGroup(IdResult idResult)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpDecorationGroup);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpDecorationGroup, 2);
+			writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpDemoteToHelperInvocation()
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpDemoteToHelperInvocation);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpDemoteToHelperInvocation, 1);
+			writeFixedInstruction(header);
+		}
+
+		constexpr void OpDot(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef vector1,
+			IdRef vector2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpDot);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpDot, 5);
+			writeFixedInstruction(header, idResultType, idResult, vector1, vector2);
+		}
+
+		constexpr void OpEmitStreamVertex(IdRef stream)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpEmitStreamVertex);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpEmitStreamVertex, 2);
+			writeFixedInstruction(header, stream);
+		}
+
+		constexpr void OpEmitVertex()
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpEmitVertex);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpEmitVertex, 1);
+			writeFixedInstruction(header);
+		}
+
+		constexpr void OpEndPrimitive()
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpEndPrimitive);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpEndPrimitive, 1);
+			writeFixedInstruction(header);
+		}
+
+		constexpr void OpEndStreamPrimitive(IdRef stream)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpEndStreamPrimitive);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpEndStreamPrimitive, 2);
+			writeFixedInstruction(header, stream);
+		}
+
+		constexpr void OpEnqueueKernel(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef queue,
+			IdRef flags,
+			IdRef nDRange,
+			IdRef numEvents,
+			IdRef waitEvents,
+			IdRef retEvent,
+			IdRef invoke,
+			IdRef param,
+			IdRef paramSize,
+			IdRef paramAlign,
+			OperandList<IdRef> localSize = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpEnqueueKernel);
+
+			size_t wordCount = 13;
+			countOperandsWord(wordCount, localSize);
+
+			writeInstruction(spv::Op::OpEnqueueKernel, wordCount, idResultType, idResult, queue, flags, nDRange, numEvents, waitEvents, retEvent, invoke, param, paramSize, paramAlign, localSize);
+		}
+
+		constexpr InstructionBuilder<BasicModuleGenerator, IdRef> beginOpEnqueueKernel(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef queue,
+			IdRef flags,
+			IdRef nDRange,
+			IdRef numEvents,
+			IdRef waitEvents,
+			IdRef retEvent,
+			IdRef invoke,
+			IdRef param,
+			IdRef paramSize,
+			IdRef paramAlign)
+		{
+			beginInstruction(idResultType, idResult, queue, flags, nDRange, numEvents, waitEvents, retEvent, invoke, param, paramSize, paramAlign);
+			return {*this, spv::Op::OpEnqueueKernel};
+		}
+
+		constexpr void OpEnqueueMarker(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef queue,
+			IdRef numEvents,
+			IdRef waitEvents,
+			IdRef retEvent)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpEnqueueMarker);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpEnqueueMarker, 7);
+			writeFixedInstruction(header, idResultType, idResult, queue, numEvents, waitEvents, retEvent);
+		}
+
+		constexpr void OpEntryPoint(
+			spv::ExecutionModel executionModel,
+			IdRef entryPoint,
+			std::string_view name,
+			OperandList<IdRef> interface = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpEntryPoint);
+
+			size_t wordCount = 3;
+			countOperandsWord(wordCount, name, interface);
+
+			writeInstruction(spv::Op::OpEntryPoint, wordCount, executionModel, entryPoint, name, interface);
+		}
+
+		constexpr InstructionBuilder<BasicModuleGenerator, IdRef> beginOpEntryPoint(
+			spv::ExecutionModel executionModel,
+			IdRef entryPoint,
+			std::string_view name)
+		{
+			beginInstruction(executionModel, entryPoint, name);
+			return {*this, spv::Op::OpEntryPoint};
+		}
+
+		constexpr void OpExecutionMode(
+			IdRef entryPoint,
+			spv::ExecutionMode mode)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpExecutionMode);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpExecutionMode, 3);
+			writeFixedInstruction(header, entryPoint, static_cast<uint32_t>(mode));
+		}
+
+		constexpr void OpExecutionModeId(
+			IdRef entryPoint,
+			spv::ExecutionMode mode)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpExecutionModeId);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpExecutionModeId, 3);
+			writeFixedInstruction(header, entryPoint, static_cast<uint32_t>(mode));
+		}
+
+		constexpr void OpExtInst(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef set,
+			uint32_t instruction,
+			OperandList<IdRef> operands = {})
+		{
+			if (getStripDebugInfo() && isStrippedExtInstSet(set))
+			{
+				return;
+			}
+
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpExtInst);
+
+			size_t wordCount = 5;
+			countOperandsWord(wordCount, operands);
+
+			writeInstruction(spv::Op::OpExtInst, wordCount, idResultType, idResult, set, instruction, operands);
+		}
+
+		constexpr void OpExtInstImport(
+			IdResult idResult,
+			std::string_view name)
+		{
+			if (stripExtInstImport(idResult, name))
+			{
+				return;
+			}
+
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpExtInstImport);
+
+			size_t wordCount = 2;
+			countOperandsWord(wordCount, name);
+
+			writeInstruction(spv::Op::OpExtInstImport, wordCount, idResult, name);
+		}
+
+		constexpr void OpExtension(std::string_view name)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpExtension);
+
+			size_t wordCount = 1;
+			countOperandsWord(wordCount, name);
+
+			writeInstruction(spv::Op::OpExtension, wordCount, name);
+		}
+
+		constexpr void OpFAdd(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFAdd);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFAdd, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpFConvert(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef floatValue)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFConvert);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFConvert, 4);
+			writeFixedInstruction(header, idResultType, idResult, floatValue);
+		}
+
+		constexpr void OpFDiv(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFDiv);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFDiv, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpFMod(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFMod);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFMod, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpFMul(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFMul);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFMul, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpFNegate(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFNegate);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFNegate, 4);
+			writeFixedInstruction(header, idResultType, idResult, operand);
+		}
+
+		constexpr void OpFOrdEqual(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFOrdEqual);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFOrdEqual, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpFOrdGreaterThan(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFOrdGreaterThan);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFOrdGreaterThan, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpFOrdGreaterThanEqual(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFOrdGreaterThanEqual);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFOrdGreaterThanEqual, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpFOrdLessThan(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFOrdLessThan);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFOrdLessThan, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpFOrdLessThanEqual(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFOrdLessThanEqual);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFOrdLessThanEqual, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpFOrdNotEqual(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFOrdNotEqual);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFOrdNotEqual, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpFRem(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFRem);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFRem, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpFSub(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFSub);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFSub, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpFUnordEqual(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFUnordEqual);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFUnordEqual, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpFUnordGreaterThan(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFUnordGreaterThan);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFUnordGreaterThan, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpFUnordGreaterThanEqual(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFUnordGreaterThanEqual);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFUnordGreaterThanEqual, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpFUnordLessThan(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFUnordLessThan);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFUnordLessThan, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpFUnordLessThanEqual(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFUnordLessThanEqual);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFUnordLessThanEqual, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpFUnordNotEqual(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFUnordNotEqual);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFUnordNotEqual, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpFunction(
+			IdResultType idResultType,
+			IdResult idResult,
+			spv::FunctionControlMask functionControl,
+			IdRef functionType)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFunction);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFunction, 5);
+			writeFixedInstruction(header, idResultType, idResult, static_cast<uint32_t>(functionControl), functionType);
+		}
+
+		constexpr void OpFunctionCall(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef function,
+			OperandList<IdRef> arguments = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFunctionCall);
+
+			size_t wordCount = 4;
+			countOperandsWord(wordCount, arguments);
+
+			writeInstruction(spv::Op::OpFunctionCall, wordCount, idResultType, idResult, function, arguments);
+		}
+
+		constexpr InstructionBuilder<BasicModuleGenerator, IdRef> beginOpFunctionCall(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef function)
+		{
+			beginInstruction(idResultType, idResult, function);
+			return {*this, spv::Op::OpFunctionCall};
+		}
+
+		constexpr void OpFunctionEnd()
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFunctionEnd);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFunctionEnd, 1);
+			writeFixedInstruction(header);
+		}
+
+		constexpr void OpFunctionParameter(
+			IdResultType idResultType,
+			IdResult idResult)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFunctionParameter);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFunctionParameter, 3);
+			writeFixedInstruction(header, idResultType, idResult);
+		}
+
+		constexpr void OpFwidth(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef P)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFwidth);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFwidth, 4);
+			writeFixedInstruction(header, idResultType, idResult, P);
+		}
+
+		constexpr void OpFwidthCoarse(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef P)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFwidthCoarse);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFwidthCoarse, 4);
+			writeFixedInstruction(header, idResultType, idResult, P);
+		}
+
+		constexpr void OpFwidthFine(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef P)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpFwidthFine);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFwidthFine, 4);
+			writeFixedInstruction(header, idResultType, idResult, P);
+		}
+
+		constexpr void OpGenericCastToPtr(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGenericCastToPtr);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGenericCastToPtr, 4);
+			writeFixedInstruction(header, idResultType, idResult, pointer);
+		}
+
+		constexpr void OpGenericCastToPtrExplicit(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer,
+			spv::StorageClass storage)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGenericCastToPtrExplicit);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGenericCastToPtrExplicit, 5);
+			writeFixedInstruction(header, idResultType, idResult, pointer, static_cast<uint32_t>(storage));
+		}
+
+		constexpr void OpGenericPtrMemSemantics(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGenericPtrMemSemantics);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGenericPtrMemSemantics, 4);
+			writeFixedInstruction(header, idResultType, idResult, pointer);
+		}
+
+		constexpr void OpGetDefaultQueue(
+			IdResultType idResultType,
+			IdResult idResult)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGetDefaultQueue);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGetDefaultQueue, 3);
+			writeFixedInstruction(header, idResultType, idResult);
+		}
+
+		constexpr void OpGetKernelLocalSizeForSubgroupCount(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef subgroupCount,
+			IdRef invoke,
+			IdRef param,
+			IdRef paramSize,
+			IdRef paramAlign)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGetKernelLocalSizeForSubgroupCount);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGetKernelLocalSizeForSubgroupCount, 8);
+			writeFixedInstruction(header, idResultType, idResult, subgroupCount, invoke, param, paramSize, paramAlign);
+		}
+
+		constexpr void OpGetKernelMaxNumSubgroups(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef invoke,
+			IdRef param,
+			IdRef paramSize,
+			IdRef paramAlign)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGetKernelMaxNumSubgroups);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGetKernelMaxNumSubgroups, 7);
+			writeFixedInstruction(header, idResultType, idResult, invoke, param, paramSize, paramAlign);
+		}
+
+		constexpr void OpGetKernelNDrangeMaxSubGroupSize(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef nDRange,
+			IdRef invoke,
+			IdRef param,
+			IdRef paramSize,
+			IdRef paramAlign)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGetKernelNDrangeMaxSubGroupSize);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGetKernelNDrangeMaxSubGroupSize, 8);
+			writeFixedInstruction(header, idResultType, idResult, nDRange, invoke, param, paramSize, paramAlign);
+		}
+
+		constexpr void OpGetKernelNDrangeSubGroupCount(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef nDRange,
+			IdRef invoke,
+			IdRef param,
+			IdRef paramSize,
+			IdRef paramAlign)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGetKernelNDrangeSubGroupCount);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGetKernelNDrangeSubGroupCount, 8);
+			writeFixedInstruction(header, idResultType, idResult, nDRange, invoke, param, paramSize, paramAlign);
+		}
+
+		constexpr void OpGetKernelPreferredWorkGroupSizeMultiple(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef invoke,
+			IdRef param,
+			IdRef paramSize,
+			IdRef paramAlign)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGetKernelPreferredWorkGroupSizeMultiple);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGetKernelPreferredWorkGroupSizeMultiple, 7);
+			writeFixedInstruction(header, idResultType, idResult, invoke, param, paramSize, paramAlign);
+		}
+
+		constexpr void OpGetKernelWorkGroupSize(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef invoke,
+			IdRef param,
+			IdRef paramSize,
+			IdRef paramAlign)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGetKernelWorkGroupSize);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGetKernelWorkGroupSize, 7);
+			writeFixedInstruction(header, idResultType, idResult, invoke, param, paramSize, paramAlign);
+		}
+
+		constexpr void OpGetMaxPipePackets(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pipe,
+			IdRef packetSize,
+			IdRef packetAlignment)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGetMaxPipePackets);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGetMaxPipePackets, 6);
+			writeFixedInstruction(header, idResultType, idResult, pipe, packetSize, packetAlignment);
+		}
+
+		constexpr void OpGetNumPipePackets(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pipe,
+			IdRef packetSize,
+			IdRef packetAlignment)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGetNumPipePackets);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGetNumPipePackets, 6);
+			writeFixedInstruction(header, idResultType, idResult, pipe, packetSize, packetAlignment);
+		}
+
+		constexpr void OpGroupAll(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			IdRef predicate)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupAll);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupAll, 5);
+			writeFixedInstruction(header, idResultType, idResult, execution, predicate);
+		}
+
+		constexpr void OpGroupAny(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			IdRef predicate)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupAny);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupAny, 5);
+			writeFixedInstruction(header, idResultType, idResult, execution, predicate);
+		}
+
+		constexpr void OpGroupAsyncCopy(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			IdRef destination,
+			IdRef source,
+			IdRef numElements,
+			IdRef stride,
+			IdRef event)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupAsyncCopy);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupAsyncCopy, 9);
+			writeFixedInstruction(header, idResultType, idResult, execution, destination, source, numElements, stride, event);
+		}
+
+		constexpr void OpGroupBroadcast(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			IdRef value,
+			IdRef localId)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupBroadcast);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupBroadcast, 6);
+			writeFixedInstruction(header, idResultType, idResult, execution, value, localId);
+		}
+
+		constexpr void OpGroupCommitReadPipe(
+			IdScope execution,
+			IdRef pipe,
+			IdRef reserveId,
+			IdRef packetSize,
+			IdRef packetAlignment)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupCommitReadPipe);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupCommitReadPipe, 6);
+			writeFixedInstruction(header, execution, pipe, reserveId, packetSize, packetAlignment);
+		}
+
+		constexpr void OpGroupCommitWritePipe(
+			IdScope execution,
+			IdRef pipe,
+			IdRef reserveId,
+			IdRef packetSize,
+			IdRef packetAlignment)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupCommitWritePipe);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupCommitWritePipe, 6);
+			writeFixedInstruction(header, execution, pipe, reserveId, packetSize, packetAlignment);
+		}
+
+		constexpr void OpGroupDecorate(
+			IdRef decorationGroup,
+			OperandList<IdRef> targets = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupDecorate);
+
+			size_t wordCount = 2;
+			countOperandsWord(wordCount, targets);
+
+			writeInstruction(spv::Op::OpGroupDecorate, wordCount, decorationGroup, targets);
+		}
+
+		constexpr InstructionBuilder<BasicModuleGenerator, IdRef> beginOpGroupDecorate(IdRef decorationGroup)
+		{
+			beginInstruction(decorationGroup);
+			return {*this, spv::Op::OpGroupDecorate};
+		}
+
+		constexpr void OpGroupFAdd(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef X)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupFAdd);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupFAdd, 6);
+			writeFixedInstruction(header, idResultType, idResult, execution, static_cast<uint32_t>(operation), X);
+		}
+
+		constexpr void OpGroupFMax(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef X)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupFMax);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupFMax, 6);
+			writeFixedInstruction(header, idResultType, idResult, execution, static_cast<uint32_t>(operation), X);
+		}
+
+		constexpr void OpGroupFMin(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef X)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupFMin);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupFMin, 6);
+			writeFixedInstruction(header, idResultType, idResult, execution, static_cast<uint32_t>(operation), X);
+		}
+
+		constexpr void OpGroupIAdd(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef X)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupIAdd);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupIAdd, 6);
+			writeFixedInstruction(header, idResultType, idResult, execution, static_cast<uint32_t>(operation), X);
+		}
+
+		constexpr void OpGroupMemberDecorate(
+			IdRef decorationGroup,
+			OperandList<std::tuple<IdRef, uint32_t>> targets = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupMemberDecorate);
+
+			size_t wordCount = 2;
+			countOperandsWord(wordCount, targets);
+
+			writeInstruction(spv::Op::OpGroupMemberDecorate, wordCount, decorationGroup, targets);
+		}
+
+		constexpr InstructionBuilder<BasicModuleGenerator, std::tuple<IdRef, uint32_t>> beginOpGroupMemberDecorate(IdRef decorationGroup)
+		{
+			beginInstruction(decorationGroup);
+			return {*this, spv::Op::OpGroupMemberDecorate};
+		}
+
+		constexpr void OpGroupNonUniformAll(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			IdRef predicate)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformAll);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupNonUniformAll, 5);
+			writeFixedInstruction(header, idResultType, idResult, execution, predicate);
+		}
+
+		constexpr void OpGroupNonUniformAllEqual(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			IdRef value)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformAllEqual);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupNonUniformAllEqual, 5);
+			writeFixedInstruction(header, idResultType, idResult, execution, value);
+		}
+
+		constexpr void OpGroupNonUniformAny(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			IdRef predicate)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformAny);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupNonUniformAny, 5);
+			writeFixedInstruction(header, idResultType, idResult, execution, predicate);
+		}
+
+		constexpr void OpGroupNonUniformBallot(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			IdRef predicate)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformBallot);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupNonUniformBallot, 5);
+			writeFixedInstruction(header, idResultType, idResult, execution, predicate);
+		}
+
+		constexpr void OpGroupNonUniformBallotBitCount(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef value)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformBallotBitCount);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupNonUniformBallotBitCount, 6);
+			writeFixedInstruction(header, idResultType, idResult, execution, static_cast<uint32_t>(operation), value);
+		}
+
+		constexpr void OpGroupNonUniformBallotBitExtract(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			IdRef value,
+			IdRef index)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformBallotBitExtract);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupNonUniformBallotBitExtract, 6);
+			writeFixedInstruction(header, idResultType, idResult, execution, value, index);
+		}
+
+		constexpr void OpGroupNonUniformBallotFindLSB(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			IdRef value)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformBallotFindLSB);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupNonUniformBallotFindLSB, 5);
+			writeFixedInstruction(header, idResultType, idResult, execution, value);
+		}
+
+		constexpr void OpGroupNonUniformBallotFindMSB(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			IdRef value)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformBallotFindMSB);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupNonUniformBallotFindMSB, 5);
+			writeFixedInstruction(header, idResultType, idResult, execution, value);
+		}
+
+		constexpr void OpGroupNonUniformBitwiseAnd(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef value,
+			std::optional<IdRef> clusterSize = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformBitwiseAnd);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, clusterSize);
+
+			writeInstruction(spv::Op::OpGroupNonUniformBitwiseAnd, wordCount, idResultType, idResult, execution, operation, value, clusterSize);
+		}
+
+		constexpr void OpGroupNonUniformBitwiseOr(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef value,
+			std::optional<IdRef> clusterSize = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformBitwiseOr);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, clusterSize);
+
+			writeInstruction(spv::Op::OpGroupNonUniformBitwiseOr, wordCount, idResultType, idResult, execution, operation, value, clusterSize);
+		}
+
+		constexpr void OpGroupNonUniformBitwiseXor(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef value,
+			std::optional<IdRef> clusterSize = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformBitwiseXor);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, clusterSize);
+
+			writeInstruction(spv::Op::OpGroupNonUniformBitwiseXor, wordCount, idResultType, idResult, execution, operation, value, clusterSize);
+		}
+
+		constexpr void OpGroupNonUniformBroadcast(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			IdRef value,
+			IdRef id)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformBroadcast);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupNonUniformBroadcast, 6);
+			writeFixedInstruction(header, idResultType, idResult, execution, value, id);
+		}
+
+		constexpr void OpGroupNonUniformBroadcastFirst(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			IdRef value)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformBroadcastFirst);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupNonUniformBroadcastFirst, 5);
+			writeFixedInstruction(header, idResultType, idResult, execution, value);
+		}
+
+		constexpr void OpGroupNonUniformElect(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformElect);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupNonUniformElect, 4);
+			writeFixedInstruction(header, idResultType, idResult, execution);
+		}
+
+		constexpr void OpGroupNonUniformFAdd(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef value,
+			std::optional<IdRef> clusterSize = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformFAdd);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, clusterSize);
+
+			writeInstruction(spv::Op::OpGroupNonUniformFAdd, wordCount, idResultType, idResult, execution, operation, value, clusterSize);
+		}
+
+		constexpr void OpGroupNonUniformFMax(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef value,
+			std::optional<IdRef> clusterSize = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformFMax);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, clusterSize);
+
+			writeInstruction(spv::Op::OpGroupNonUniformFMax, wordCount, idResultType, idResult, execution, operation, value, clusterSize);
+		}
+
+		constexpr void OpGroupNonUniformFMin(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef value,
+			std::optional<IdRef> clusterSize = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformFMin);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, clusterSize);
+
+			writeInstruction(spv::Op::OpGroupNonUniformFMin, wordCount, idResultType, idResult, execution, operation, value, clusterSize);
+		}
+
+		constexpr void OpGroupNonUniformFMul(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef value,
+			std::optional<IdRef> clusterSize = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformFMul);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, clusterSize);
+
+			writeInstruction(spv::Op::OpGroupNonUniformFMul, wordCount, idResultType, idResult, execution, operation, value, clusterSize);
+		}
+
+		constexpr void OpGroupNonUniformIAdd(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef value,
+			std::optional<IdRef> clusterSize = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformIAdd);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, clusterSize);
+
+			writeInstruction(spv::Op::OpGroupNonUniformIAdd, wordCount, idResultType, idResult, execution, operation, value, clusterSize);
+		}
+
+		constexpr void OpGroupNonUniformIMul(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef value,
+			std::optional<IdRef> clusterSize = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformIMul);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, clusterSize);
+
+			writeInstruction(spv::Op::OpGroupNonUniformIMul, wordCount, idResultType, idResult, execution, operation, value, clusterSize);
+		}
+
+		constexpr void OpGroupNonUniformInverseBallot(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			IdRef value)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformInverseBallot);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupNonUniformInverseBallot, 5);
+			writeFixedInstruction(header, idResultType, idResult, execution, value);
+		}
+
+		constexpr void OpGroupNonUniformLogicalAnd(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef value,
+			std::optional<IdRef> clusterSize = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformLogicalAnd);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, clusterSize);
+
+			writeInstruction(spv::Op::OpGroupNonUniformLogicalAnd, wordCount, idResultType, idResult, execution, operation, value, clusterSize);
+		}
+
+		constexpr void OpGroupNonUniformLogicalOr(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef value,
+			std::optional<IdRef> clusterSize = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformLogicalOr);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, clusterSize);
+
+			writeInstruction(spv::Op::OpGroupNonUniformLogicalOr, wordCount, idResultType, idResult, execution, operation, value, clusterSize);
+		}
+
+		constexpr void OpGroupNonUniformLogicalXor(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef value,
+			std::optional<IdRef> clusterSize = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformLogicalXor);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, clusterSize);
+
+			writeInstruction(spv::Op::OpGroupNonUniformLogicalXor, wordCount, idResultType, idResult, execution, operation, value, clusterSize);
+		}
+
+		constexpr void OpGroupNonUniformQuadBroadcast(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			IdRef value,
+			IdRef index)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformQuadBroadcast);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupNonUniformQuadBroadcast, 6);
+			writeFixedInstruction(header, idResultType, idResult, execution, value, index);
+		}
+
+		constexpr void OpGroupNonUniformQuadSwap(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			IdRef value,
+			IdRef direction)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformQuadSwap);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupNonUniformQuadSwap, 6);
+			writeFixedInstruction(header, idResultType, idResult, execution, value, direction);
+		}
+
+		constexpr void OpGroupNonUniformSMax(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef value,
+			std::optional<IdRef> clusterSize = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformSMax);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, clusterSize);
+
+			writeInstruction(spv::Op::OpGroupNonUniformSMax, wordCount, idResultType, idResult, execution, operation, value, clusterSize);
+		}
+
+		constexpr void OpGroupNonUniformSMin(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef value,
+			std::optional<IdRef> clusterSize = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformSMin);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, clusterSize);
+
+			writeInstruction(spv::Op::OpGroupNonUniformSMin, wordCount, idResultType, idResult, execution, operation, value, clusterSize);
+		}
+
+		constexpr void OpGroupNonUniformShuffle(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			IdRef value,
+			IdRef id)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformShuffle);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupNonUniformShuffle, 6);
+			writeFixedInstruction(header, idResultType, idResult, execution, value, id);
+		}
+
+		constexpr void OpGroupNonUniformShuffleDown(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			IdRef value,
+			IdRef delta)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformShuffleDown);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupNonUniformShuffleDown, 6);
+			writeFixedInstruction(header, idResultType, idResult, execution, value, delta);
+		}
+
+		constexpr void OpGroupNonUniformShuffleUp(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			IdRef value,
+			IdRef delta)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformShuffleUp);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupNonUniformShuffleUp, 6);
+			writeFixedInstruction(header, idResultType, idResult, execution, value, delta);
+		}
+
+		constexpr void OpGroupNonUniformShuffleXor(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			IdRef value,
+			IdRef mask)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformShuffleXor);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupNonUniformShuffleXor, 6);
+			writeFixedInstruction(header, idResultType, idResult, execution, value, mask);
+		}
+
+		constexpr void OpGroupNonUniformUMax(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef value,
+			std::optional<IdRef> clusterSize = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformUMax);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, clusterSize);
+
+			writeInstruction(spv::Op::OpGroupNonUniformUMax, wordCount, idResultType, idResult, execution, operation, value, clusterSize);
+		}
+
+		constexpr void OpGroupNonUniformUMin(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef value,
+			std::optional<IdRef> clusterSize = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupNonUniformUMin);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, clusterSize);
+
+			writeInstruction(spv::Op::OpGroupNonUniformUMin, wordCount, idResultType, idResult, execution, operation, value, clusterSize);
+		}
+
+		constexpr void OpGroupReserveReadPipePackets(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			IdRef pipe,
+			IdRef numPackets,
+			IdRef packetSize,
+			IdRef packetAlignment)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupReserveReadPipePackets);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupReserveReadPipePackets, 8);
+			writeFixedInstruction(header, idResultType, idResult, execution, pipe, numPackets, packetSize, packetAlignment);
+		}
+
+		constexpr void OpGroupReserveWritePipePackets(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			IdRef pipe,
+			IdRef numPackets,
+			IdRef packetSize,
+			IdRef packetAlignment)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupReserveWritePipePackets);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupReserveWritePipePackets, 8);
+			writeFixedInstruction(header, idResultType, idResult, execution, pipe, numPackets, packetSize, packetAlignment);
+		}
+
+		constexpr void OpGroupSMax(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef X)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupSMax);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupSMax, 6);
+			writeFixedInstruction(header, idResultType, idResult, execution, static_cast<uint32_t>(operation), X);
+		}
+
+		constexpr void OpGroupSMin(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef X)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupSMin);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupSMin, 6);
+			writeFixedInstruction(header, idResultType, idResult, execution, static_cast<uint32_t>(operation), X);
+		}
+
+		constexpr void OpGroupUMax(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef X)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupUMax);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupUMax, 6);
+			writeFixedInstruction(header, idResultType, idResult, execution, static_cast<uint32_t>(operation), X);
+		}
+
+		constexpr void OpGroupUMin(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef X)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupUMin);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupUMin, 6);
+			writeFixedInstruction(header, idResultType, idResult, execution, static_cast<uint32_t>(operation), X);
+		}
+
+		constexpr void OpGroupWaitEvents(
+			IdScope execution,
+			IdRef numEvents,
+			IdRef eventsList)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpGroupWaitEvents);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupWaitEvents, 4);
+			writeFixedInstruction(header, execution, numEvents, eventsList);
+		}
+
+		constexpr void OpIAdd(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpIAdd);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpIAdd, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpIAddCarry(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpIAddCarry);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpIAddCarry, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpIEqual(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpIEqual);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpIEqual, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpIMul(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpIMul);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpIMul, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpINotEqual(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpINotEqual);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpINotEqual, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpISub(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpISub);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpISub, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpISubBorrow(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpISubBorrow);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpISubBorrow, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpImage(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sampledImage)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImage);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImage, 4);
+			writeFixedInstruction(header, idResultType, idResult, sampledImage);
+		}
+
+		constexpr void OpImageDrefGather(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sampledImage,
+			IdRef coordinate,
+			IdRef dref,
+			std::optional<spv::ImageOperandsMask> imageOperands = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageDrefGather);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, imageOperands);
+
+			writeInstruction(spv::Op::OpImageDrefGather, wordCount, idResultType, idResult, sampledImage, coordinate, dref, imageOperands);
+		}
+
+		constexpr void OpImageFetch(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef image,
+			IdRef coordinate,
+			std::optional<spv::ImageOperandsMask> imageOperands = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageFetch);
+
+			size_t wordCount = 5;
+			countOperandsWord(wordCount, imageOperands);
+
+			writeInstruction(spv::Op::OpImageFetch, wordCount, idResultType, idResult, image, coordinate, imageOperands);
+		}
+
+		constexpr void OpImageGather(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sampledImage,
+			IdRef coordinate,
+			IdRef component,
+			std::optional<spv::ImageOperandsMask> imageOperands = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageGather);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, imageOperands);
+
+			writeInstruction(spv::Op::OpImageGather, wordCount, idResultType, idResult, sampledImage, coordinate, component, imageOperands);
+		}
+
+		constexpr void OpImageQueryFormat(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef image)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageQueryFormat);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImageQueryFormat, 4);
+			writeFixedInstruction(header, idResultType, idResult, image);
+		}
+
+		constexpr void OpImageQueryLevels(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef image)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageQueryLevels);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImageQueryLevels, 4);
+			writeFixedInstruction(header, idResultType, idResult, image);
+		}
+
+		constexpr void OpImageQueryLod(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sampledImage,
+			IdRef coordinate)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageQueryLod);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImageQueryLod, 5);
+			writeFixedInstruction(header, idResultType, idResult, sampledImage, coordinate);
+		}
+
+		constexpr void OpImageQueryOrder(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef image)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageQueryOrder);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImageQueryOrder, 4);
+			writeFixedInstruction(header, idResultType, idResult, image);
+		}
+
+		constexpr void OpImageQuerySamples(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef image)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageQuerySamples);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImageQuerySamples, 4);
+			writeFixedInstruction(header, idResultType, idResult, image);
+		}
+
+		constexpr void OpImageQuerySize(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef image)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageQuerySize);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImageQuerySize, 4);
+			writeFixedInstruction(header, idResultType, idResult, image);
+		}
+
+		constexpr void OpImageQuerySizeLod(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef image,
+			IdRef levelOfDetail)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageQuerySizeLod);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImageQuerySizeLod, 5);
+			writeFixedInstruction(header, idResultType, idResult, image, levelOfDetail);
+		}
+
+		constexpr void OpImageRead(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef image,
+			IdRef coordinate,
+			std::optional<spv::ImageOperandsMask> imageOperands = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageRead);
+
+			size_t wordCount = 5;
+			countOperandsWord(wordCount, imageOperands);
+
+			writeInstruction(spv::Op::OpImageRead, wordCount, idResultType, idResult, image, coordinate, imageOperands);
+		}
+
+		constexpr void OpImageSampleDrefExplicitLod(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sampledImage,
+			IdRef coordinate,
+			IdRef dref,
+			spv::ImageOperandsMask imageOperands)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageSampleDrefExplicitLod);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImageSampleDrefExplicitLod, 7);
+			writeFixedInstruction(header, idResultType, idResult, sampledImage, coordinate, dref, static_cast<uint32_t>(imageOperands));
+		}
+
+		constexpr void OpImageSampleDrefImplicitLod(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sampledImage,
+			IdRef coordinate,
+			IdRef dref,
+			std::optional<spv::ImageOperandsMask> imageOperands = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageSampleDrefImplicitLod);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, imageOperands);
+
+			writeInstruction(spv::Op::OpImageSampleDrefImplicitLod, wordCount, idResultType, idResult, sampledImage, coordinate, dref, imageOperands);
+		}
+
+		constexpr void OpImageSampleExplicitLod(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sampledImage,
+			IdRef coordinate,
+			spv::ImageOperandsMask imageOperands)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageSampleExplicitLod);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImageSampleExplicitLod, 6);
+			writeFixedInstruction(header, idResultType, idResult, sampledImage, coordinate, static_cast<uint32_t>(imageOperands));
+		}
+
+		constexpr void OpImageSampleImplicitLod(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sampledImage,
+			IdRef coordinate,
+			std::optional<spv::ImageOperandsMask> imageOperands = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageSampleImplicitLod);
+
+			size_t wordCount = 5;
+			countOperandsWord(wordCount, imageOperands);
+
+			writeInstruction(spv::Op::OpImageSampleImplicitLod, wordCount, idResultType, idResult, sampledImage, coordinate, imageOperands);
+		}
+
+		constexpr void OpImageSampleProjDrefExplicitLod(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sampledImage,
+			IdRef coordinate,
+			IdRef dref,
+			spv::ImageOperandsMask imageOperands)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageSampleProjDrefExplicitLod);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImageSampleProjDrefExplicitLod, 7);
+			writeFixedInstruction(header, idResultType, idResult, sampledImage, coordinate, dref, static_cast<uint32_t>(imageOperands));
+		}
+
+		constexpr void OpImageSampleProjDrefImplicitLod(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sampledImage,
+			IdRef coordinate,
+			IdRef dref,
+			std::optional<spv::ImageOperandsMask> imageOperands = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageSampleProjDrefImplicitLod);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, imageOperands);
+
+			writeInstruction(spv::Op::OpImageSampleProjDrefImplicitLod, wordCount, idResultType, idResult, sampledImage, coordinate, dref, imageOperands);
+		}
+
+		constexpr void OpImageSampleProjExplicitLod(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sampledImage,
+			IdRef coordinate,
+			spv::ImageOperandsMask imageOperands)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageSampleProjExplicitLod);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImageSampleProjExplicitLod, 6);
+			writeFixedInstruction(header, idResultType, idResult, sampledImage, coordinate, static_cast<uint32_t>(imageOperands));
+		}
+
+		constexpr void OpImageSampleProjImplicitLod(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sampledImage,
+			IdRef coordinate,
+			std::optional<spv::ImageOperandsMask> imageOperands = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageSampleProjImplicitLod);
+
+			size_t wordCount = 5;
+			countOperandsWord(wordCount, imageOperands);
+
+			writeInstruction(spv::Op::OpImageSampleProjImplicitLod, wordCount, idResultType, idResult, sampledImage, coordinate, imageOperands);
+		}
+
+		constexpr void OpImageSparseDrefGather(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sampledImage,
+			IdRef coordinate,
+			IdRef dref,
+			std::optional<spv::ImageOperandsMask> imageOperands = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageSparseDrefGather);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, imageOperands);
+
+			writeInstruction(spv::Op::OpImageSparseDrefGather, wordCount, idResultType, idResult, sampledImage, coordinate, dref, imageOperands);
+		}
+
+		constexpr void OpImageSparseFetch(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef image,
+			IdRef coordinate,
+			std::optional<spv::ImageOperandsMask> imageOperands = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageSparseFetch);
+
+			size_t wordCount = 5;
+			countOperandsWord(wordCount, imageOperands);
+
+			writeInstruction(spv::Op::OpImageSparseFetch, wordCount, idResultType, idResult, image, coordinate, imageOperands);
+		}
+
+		constexpr void OpImageSparseGather(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sampledImage,
+			IdRef coordinate,
+			IdRef component,
+			std::optional<spv::ImageOperandsMask> imageOperands = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageSparseGather);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, imageOperands);
+
+			writeInstruction(spv::Op::OpImageSparseGather, wordCount, idResultType, idResult, sampledImage, coordinate, component, imageOperands);
+		}
+
+		constexpr void OpImageSparseRead(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef image,
+			IdRef coordinate,
+			std::optional<spv::ImageOperandsMask> imageOperands = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageSparseRead);
+
+			size_t wordCount = 5;
+			countOperandsWord(wordCount, imageOperands);
+
+			writeInstruction(spv::Op::OpImageSparseRead, wordCount, idResultType, idResult, image, coordinate, imageOperands);
+		}
+
+		constexpr void OpImageSparseSampleDrefExplicitLod(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sampledImage,
+			IdRef coordinate,
+			IdRef dref,
+			spv::ImageOperandsMask imageOperands)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageSparseSampleDrefExplicitLod);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImageSparseSampleDrefExplicitLod, 7);
+			writeFixedInstruction(header, idResultType, idResult, sampledImage, coordinate, dref, static_cast<uint32_t>(imageOperands));
+		}
+
+		constexpr void OpImageSparseSampleDrefImplicitLod(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sampledImage,
+			IdRef coordinate,
+			IdRef dref,
+			std::optional<spv::ImageOperandsMask> imageOperands = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageSparseSampleDrefImplicitLod);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, imageOperands);
+
+			writeInstruction(spv::Op::OpImageSparseSampleDrefImplicitLod, wordCount, idResultType, idResult, sampledImage, coordinate, dref, imageOperands);
+		}
+
+		constexpr void OpImageSparseSampleExplicitLod(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sampledImage,
+			IdRef coordinate,
+			spv::ImageOperandsMask imageOperands)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageSparseSampleExplicitLod);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImageSparseSampleExplicitLod, 6);
+			writeFixedInstruction(header, idResultType, idResult, sampledImage, coordinate, static_cast<uint32_t>(imageOperands));
+		}
+
+		constexpr void OpImageSparseSampleImplicitLod(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sampledImage,
+			IdRef coordinate,
+			std::optional<spv::ImageOperandsMask> imageOperands = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageSparseSampleImplicitLod);
+
+			size_t wordCount = 5;
+			countOperandsWord(wordCount, imageOperands);
+
+			writeInstruction(spv::Op::OpImageSparseSampleImplicitLod, wordCount, idResultType, idResult, sampledImage, coordinate, imageOperands);
+		}
+
+		constexpr void OpImageSparseSampleProjDrefExplicitLod(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sampledImage,
+			IdRef coordinate,
+			IdRef dref,
+			spv::ImageOperandsMask imageOperands)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageSparseSampleProjDrefExplicitLod);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImageSparseSampleProjDrefExplicitLod, 7);
+			writeFixedInstruction(header, idResultType, idResult, sampledImage, coordinate, dref, static_cast<uint32_t>(imageOperands));
+		}
+
+		constexpr void OpImageSparseSampleProjDrefImplicitLod(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sampledImage,
+			IdRef coordinate,
+			IdRef dref,
+			std::optional<spv::ImageOperandsMask> imageOperands = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageSparseSampleProjDrefImplicitLod);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, imageOperands);
+
+			writeInstruction(spv::Op::OpImageSparseSampleProjDrefImplicitLod, wordCount, idResultType, idResult, sampledImage, coordinate, dref, imageOperands);
+		}
+
+		constexpr void OpImageSparseSampleProjExplicitLod(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sampledImage,
+			IdRef coordinate,
+			spv::ImageOperandsMask imageOperands)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageSparseSampleProjExplicitLod);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImageSparseSampleProjExplicitLod, 6);
+			writeFixedInstruction(header, idResultType, idResult, sampledImage, coordinate, static_cast<uint32_t>(imageOperands));
+		}
+
+		constexpr void OpImageSparseSampleProjImplicitLod(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sampledImage,
+			IdRef coordinate,
+			std::optional<spv::ImageOperandsMask> imageOperands = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageSparseSampleProjImplicitLod);
+
+			size_t wordCount = 5;
+			countOperandsWord(wordCount, imageOperands);
+
+			writeInstruction(spv::Op::OpImageSparseSampleProjImplicitLod, wordCount, idResultType, idResult, sampledImage, coordinate, imageOperands);
+		}
+
+		constexpr void OpImageSparseTexelsResident(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef residentCode)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageSparseTexelsResident);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImageSparseTexelsResident, 4);
+			writeFixedInstruction(header, idResultType, idResult, residentCode);
+		}
+
+		constexpr void OpImageTexelPointer(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef image,
+			IdRef coordinate,
+			IdRef sample)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageTexelPointer);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImageTexelPointer, 6);
+			writeFixedInstruction(header, idResultType, idResult, image, coordinate, sample);
+		}
+
+		constexpr void OpImageWrite(
+			IdRef image,
+			IdRef coordinate,
+			IdRef texel,
+			std::optional<spv::ImageOperandsMask> imageOperands = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpImageWrite);
+
+			size_t wordCount = 4;
+			countOperandsWord(wordCount, imageOperands);
+
+			writeInstruction(spv::Op::OpImageWrite, wordCount, image, coordinate, texel, imageOperands);
+		}
+
+		constexpr void OpInBoundsAccessChain(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef base,
+			OperandList<IdRef> indexes = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpInBoundsAccessChain);
+
+			size_t wordCount = 4;
+			countOperandsWord(wordCount, indexes);
+
+			writeInstruction(spv::Op::OpInBoundsAccessChain, wordCount, idResultType, idResult, base, indexes);
+		}
+
+		constexpr InstructionBuilder<BasicModuleGenerator, IdRef> beginOpInBoundsAccessChain(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef base)
+		{
+			beginInstruction(idResultType, idResult, base);
+			return {*this, spv::Op::OpInBoundsAccessChain};
+		}
+
+		constexpr void OpInBoundsPtrAccessChain(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef base,
+			IdRef element,
+			OperandList<IdRef> indexes = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpInBoundsPtrAccessChain);
+
+			size_t wordCount = 5;
+			countOperandsWord(wordCount, indexes);
+
+			writeInstruction(spv::Op::OpInBoundsPtrAccessChain, wordCount, idResultType, idResult, base, element, indexes);
+		}
+
+		constexpr InstructionBuilder<BasicModuleGenerator, IdRef> beginOpInBoundsPtrAccessChain(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef base,
+			IdRef element)
+		{
+			beginInstruction(idResultType, idResult, base, element);
+			return {*this, spv::Op::OpInBoundsPtrAccessChain};
+		}
+
+		constexpr void OpIsFinite(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef x)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpIsFinite);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpIsFinite, 4);
+			writeFixedInstruction(header, idResultType, idResult, x);
+		}
+
+		constexpr void OpIsInf(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef x)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpIsInf);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpIsInf, 4);
+			writeFixedInstruction(header, idResultType, idResult, x);
+		}
+
+		constexpr void OpIsNan(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef x)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpIsNan);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpIsNan, 4);
+			writeFixedInstruction(header, idResultType, idResult, x);
+		}
+
+		constexpr void OpIsNormal(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef x)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpIsNormal);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpIsNormal, 4);
+			writeFixedInstruction(header, idResultType, idResult, x);
+		}
+
+		constexpr void OpIsValidEvent(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef event)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpIsValidEvent);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpIsValidEvent, 4);
+			writeFixedInstruction(header, idResultType, idResult, event);
+		}
+
+		constexpr void OpIsValidReserveId(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef reserveId)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpIsValidReserveId);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpIsValidReserveId, 4);
+			writeFixedInstruction(header, idResultType, idResult, reserveId);
+		}
+
+		constexpr void OpKill()
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpKill);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpKill, 1);
+			writeFixedInstruction(header);
+		}
+
+		constexpr void OpLabel(IdResult idResult)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpLabel);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpLabel, 2);
+			writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpLessOrGreater(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef x,
+			IdRef y)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpLessOrGreater);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpLessOrGreater, 5);
+			writeFixedInstruction(header, idResultType, idResult, x, y);
+		}
+
+		constexpr void OpLifetimeStart(
+			IdRef pointer,
+			uint32_t size)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpLifetimeStart);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpLifetimeStart, 3);
+			writeFixedInstruction(header, pointer, size);
+		}
+
+		constexpr void OpLifetimeStop(
+			IdRef pointer,
+			uint32_t size)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpLifetimeStop);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpLifetimeStop, 3);
+			writeFixedInstruction(header, pointer, size);
+		}
+
+		constexpr void OpLine(
+			IdRef file,
+			uint32_t line,
+			uint32_t column)
+		{
+			if (getStripDebugInfo())
+			{
+				return;
+			}
+
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpLine);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpLine, 4);
+			writeFixedInstruction(header, file, line, column);
+		}
+
+		constexpr void OpLoad(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer,
+			std::optional<spv::MemoryAccessMask> memoryAccess = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpLoad);
+
+			size_t wordCount = 4;
+			countOperandsWord(wordCount, memoryAccess);
+
+			writeInstruction(spv::Op::OpLoad, wordCount, idResultType, idResult, pointer, memoryAccess);
+		}
+
+		constexpr void OpLogicalAnd(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpLogicalAnd);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpLogicalAnd, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpLogicalEqual(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpLogicalEqual);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpLogicalEqual, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpLogicalNot(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpLogicalNot);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpLogicalNot, 4);
+			writeFixedInstruction(header, idResultType, idResult, operand);
+		}
+
+		constexpr void OpLogicalNotEqual(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpLogicalNotEqual);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpLogicalNotEqual, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpLogicalOr(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpLogicalOr);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpLogicalOr, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpLoopMerge(
+			IdRef mergeBlock,
+			IdRef continueTarget,
+			spv::LoopControlMask loopControl)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpLoopMerge);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpLoopMerge, 4);
+			writeFixedInstruction(header, mergeBlock, continueTarget, static_cast<uint32_t>(loopControl));
+		}
+
+		constexpr void OpMatrixTimesMatrix(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef leftMatrix,
+			IdRef rightMatrix)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpMatrixTimesMatrix);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpMatrixTimesMatrix, 5);
+			writeFixedInstruction(header, idResultType, idResult, leftMatrix, rightMatrix);
+		}
+
+		constexpr void OpMatrixTimesScalar(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef matrix,
+			IdRef scalar)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpMatrixTimesScalar);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpMatrixTimesScalar, 5);
+			writeFixedInstruction(header, idResultType, idResult, matrix, scalar);
+		}
+
+		constexpr void OpMatrixTimesVector(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef matrix,
+			IdRef vector)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpMatrixTimesVector);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpMatrixTimesVector, 5);
+			writeFixedInstruction(header, idResultType, idResult, matrix, vector);
+		}
+
+		constexpr void OpMemberDecorate(
+			IdRef structureType,
+			uint32_t member,
+			spv::Decoration decoration)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpMemberDecorate);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpMemberDecorate, 4);
+			writeFixedInstruction(header, structureType, member, static_cast<uint32_t>(decoration));
+		}
+
+		constexpr void OpMemberDecorateString(
+			IdRef structType,
+			uint32_t member,
+			spv::Decoration decoration)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpMemberDecorateString);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpMemberDecorateString, 4);
+			writeFixedInstruction(header, structType, member, static_cast<uint32_t>(decoration));
+		}
+
+		constexpr void OpMemberName(
+			IdRef type,
+			uint32_t member,
+			std::string_view name)
+		{
+			if (getStripDebugInfo())
+			{
+				return;
+			}
+
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpMemberName);
+
+			size_t wordCount = 3;
+			countOperandsWord(wordCount, name);
+
+			writeInstruction(spv::Op::OpMemberName, wordCount, type, member, name);
+		}
+
+		constexpr void OpMemoryBarrier(
+			IdScope memory,
+			IdMemorySemantics semantics)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpMemoryBarrier);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpMemoryBarrier, 3);
+			writeFixedInstruction(header, memory, semantics);
+		}
+
+		constexpr void OpMemoryModel(
+			spv::AddressingModel addressingModel,
+			spv::MemoryModel memoryModel)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpMemoryModel);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpMemoryModel, 3);
+			writeFixedInstruction(header, static_cast<uint32_t>(addressingModel), static_cast<uint32_t>(memoryModel));
+		}
+
+		constexpr void OpMemoryNamedBarrier(
+			IdRef namedBarrier,
+			IdScope memory,
+			IdMemorySemantics semantics)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpMemoryNamedBarrier);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpMemoryNamedBarrier, 4);
+			writeFixedInstruction(header, namedBarrier, memory, semantics);
+		}
+
+		constexpr void OpModuleProcessed(std::string_view process)
+		{
+			if (getStripDebugInfo())
+			{
+				return;
+			}
+
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpModuleProcessed);
+
+			size_t wordCount = 1;
+			countOperandsWord(wordCount, process);
+
+			writeInstruction(spv::Op::OpModuleProcessed, wordCount, process);
+		}
+
+		constexpr void OpName(
+			IdRef target,
+			std::string_view name)
+		{
+			if (getStripDebugInfo())
+			{
+				return;
+			}
+
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpName);
+
+			size_t wordCount = 2;
+			countOperandsWord(wordCount, name);
+
+			writeInstruction(spv::Op::OpName, wordCount, target, name);
+		}
+
+		constexpr void OpNamedBarrierInitialize(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef subgroupCount)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpNamedBarrierInitialize);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpNamedBarrierInitialize, 4);
+			writeFixedInstruction(header, idResultType, idResult, subgroupCount);
+		}
+
+		constexpr void OpNoLine()
+		{
+			if (getStripDebugInfo())
+			{
+				return;
+			}
+
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpNoLine);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpNoLine, 1);
+			writeFixedInstruction(header);
+		}
+
+		constexpr void OpNop()
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpNop);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpNop, 1);
+			writeFixedInstruction(header);
+		}
+
+		constexpr void OpNot(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpNot);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpNot, 4);
+			writeFixedInstruction(header, idResultType, idResult, operand);
+		}
+
+		constexpr void OpOrdered(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef x,
+			IdRef y)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpOrdered);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpOrdered, 5);
+			writeFixedInstruction(header, idResultType, idResult, x, y);
+		}
+
+		constexpr void OpOuterProduct(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef vector1,
+			IdRef vector2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpOuterProduct);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpOuterProduct, 5);
+			writeFixedInstruction(header, idResultType, idResult, vector1, vector2);
+		}
+
+		constexpr void OpPhi(
+			IdResultType idResultType,
+			IdResult idResult,
+			OperandList<std::tuple<IdRef, IdRef>> variableParents = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpPhi);
+
+			size_t wordCount = 3;
+			countOperandsWord(wordCount, variableParents);
+
+			writeInstruction(spv::Op::OpPhi, wordCount, idResultType, idResult, variableParents);
+		}
+
+		constexpr InstructionBuilder<BasicModuleGenerator, std::tuple<IdRef, IdRef>> beginOpPhi(
+			IdResultType idResultType,
+			IdResult idResult)
+		{
+			beginInstruction(idResultType, idResult);
+			return {*this, spv::Op::OpPhi};
+		}
+
+		constexpr void OpPtrAccessChain(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef base,
+			IdRef element,
+			OperandList<IdRef> indexes = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpPtrAccessChain);
+
+			size_t wordCount = 5;
+			countOperandsWord(wordCount, indexes);
+
+			writeInstruction(spv::Op::OpPtrAccessChain, wordCount, idResultType, idResult, base, element, indexes);
+		}
+
+		constexpr InstructionBuilder<BasicModuleGenerator, IdRef> beginOpPtrAccessChain(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef base,
+			IdRef element)
+		{
+			beginInstruction(idResultType, idResult, base, element);
+			return {*this, spv::Op::OpPtrAccessChain};
+		}
+
+		constexpr void OpPtrCastToGeneric(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpPtrCastToGeneric);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpPtrCastToGeneric, 4);
+			writeFixedInstruction(header, idResultType, idResult, pointer);
+		}
+
+		constexpr void OpPtrDiff(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpPtrDiff);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpPtrDiff, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpPtrEqual(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpPtrEqual);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpPtrEqual, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpPtrNotEqual(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpPtrNotEqual);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpPtrNotEqual, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpQuantizeToF16(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef value)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpQuantizeToF16);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpQuantizeToF16, 4);
+			writeFixedInstruction(header, idResultType, idResult, value);
+		}
+
+		constexpr void OpReadPipe(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pipe,
+			IdRef pointer,
+			IdRef packetSize,
+			IdRef packetAlignment)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpReadPipe);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpReadPipe, 7);
+			writeFixedInstruction(header, idResultType, idResult, pipe, pointer, packetSize, packetAlignment);
+		}
+
+		constexpr void OpReleaseEvent(IdRef event)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpReleaseEvent);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpReleaseEvent, 2);
+			writeFixedInstruction(header, event);
+		}
+
+		constexpr void OpReserveReadPipePackets(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pipe,
+			IdRef numPackets,
+			IdRef packetSize,
+			IdRef packetAlignment)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpReserveReadPipePackets);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpReserveReadPipePackets, 7);
+			writeFixedInstruction(header, idResultType, idResult, pipe, numPackets, packetSize, packetAlignment);
+		}
+
+		constexpr void OpReserveWritePipePackets(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pipe,
+			IdRef numPackets,
+			IdRef packetSize,
+			IdRef packetAlignment)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpReserveWritePipePackets);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpReserveWritePipePackets, 7);
+			writeFixedInstruction(header, idResultType, idResult, pipe, numPackets, packetSize, packetAlignment);
+		}
+
+		constexpr void OpReservedReadPipe(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pipe,
+			IdRef reserveId,
+			IdRef index,
+			IdRef pointer,
+			IdRef packetSize,
+			IdRef packetAlignment)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpReservedReadPipe);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpReservedReadPipe, 9);
+			writeFixedInstruction(header, idResultType, idResult, pipe, reserveId, index, pointer, packetSize, packetAlignment);
+		}
+
+		constexpr void OpReservedWritePipe(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pipe,
+			IdRef reserveId,
+			IdRef index,
+			IdRef pointer,
+			IdRef packetSize,
+			IdRef packetAlignment)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpReservedWritePipe);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpReservedWritePipe, 9);
+			writeFixedInstruction(header, idResultType, idResult, pipe, reserveId, index, pointer, packetSize, packetAlignment);
+		}
+
+		constexpr void OpRetainEvent(IdRef event)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpRetainEvent);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRetainEvent, 2);
+			writeFixedInstruction(header, event);
+		}
+
+		constexpr void OpReturn()
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpReturn);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpReturn, 1);
+			writeFixedInstruction(header);
+		}
+
+		constexpr void OpReturnValue(IdRef value)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpReturnValue);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpReturnValue, 2);
+			writeFixedInstruction(header, value);
+		}
+
+		constexpr void OpSConvert(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef signedValue)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSConvert);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSConvert, 4);
+			writeFixedInstruction(header, idResultType, idResult, signedValue);
+		}
+
+		constexpr void OpSDiv(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSDiv);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSDiv, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpSDot(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef vector1,
+			IdRef vector2,
+			std::optional<spv::PackedVectorFormat> packedVectorFormat = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSDot);
+
+			size_t wordCount = 5;
+			countOperandsWord(wordCount, packedVectorFormat);
+
+			writeInstruction(spv::Op::OpSDot, wordCount, idResultType, idResult, vector1, vector2, packedVectorFormat);
+		}
+
+		constexpr void OpSDotAccSat(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef vector1,
+			IdRef vector2,
+			IdRef accumulator,
+			std::optional<spv::PackedVectorFormat> packedVectorFormat = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSDotAccSat);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, packedVectorFormat);
+
+			writeInstruction(spv::Op::OpSDotAccSat, wordCount, idResultType, idResult, vector1, vector2, accumulator, packedVectorFormat);
+		}
+
+		constexpr void OpSGreaterThan(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSGreaterThan);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSGreaterThan, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpSGreaterThanEqual(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSGreaterThanEqual);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSGreaterThanEqual, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpSLessThan(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSLessThan);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSLessThan, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpSLessThanEqual(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSLessThanEqual);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSLessThanEqual, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpSMod(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSMod);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSMod, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpSMulExtended(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSMulExtended);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSMulExtended, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpSNegate(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSNegate);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSNegate, 4);
+			writeFixedInstruction(header, idResultType, idResult, operand);
+		}
+
+		constexpr void OpSRem(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSRem);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSRem, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpSUDot(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef vector1,
+			IdRef vector2,
+			std::optional<spv::PackedVectorFormat> packedVectorFormat = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSUDot);
+
+			size_t wordCount = 5;
+			countOperandsWord(wordCount, packedVectorFormat);
+
+			writeInstruction(spv::Op::OpSUDot, wordCount, idResultType, idResult, vector1, vector2, packedVectorFormat);
+		}
+
+		constexpr void OpSUDotAccSat(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef vector1,
+			IdRef vector2,
+			IdRef accumulator,
+			std::optional<spv::PackedVectorFormat> packedVectorFormat = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSUDotAccSat);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, packedVectorFormat);
+
+			writeInstruction(spv::Op::OpSUDotAccSat, wordCount, idResultType, idResult, vector1, vector2, accumulator, packedVectorFormat);
+		}
+
+		constexpr void OpSampledImage(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef image,
+			IdRef sampler)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSampledImage);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSampledImage, 5);
+			writeFixedInstruction(header, idResultType, idResult, image, sampler);
+		}
+
+		constexpr void OpSatConvertSToU(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef signedValue)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSatConvertSToU);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSatConvertSToU, 4);
+			writeFixedInstruction(header, idResultType, idResult, signedValue);
+		}
+
+		constexpr void OpSatConvertUToS(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef unsignedValue)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSatConvertUToS);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSatConvertUToS, 4);
+			writeFixedInstruction(header, idResultType, idResult, unsignedValue);
+		}
+
+		constexpr void OpSelect(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef condition,
+			IdRef object1,
+			IdRef object2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSelect);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSelect, 6);
+			writeFixedInstruction(header, idResultType, idResult, condition, object1, object2);
+		}
+
+		constexpr void OpSelectionMerge(
+			IdRef mergeBlock,
+			spv::SelectionControlMask selectionControl)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSelectionMerge);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSelectionMerge, 3);
+			writeFixedInstruction(header, mergeBlock, static_cast<uint32_t>(selectionControl));
+		}
+
+		constexpr void OpSetUserEventStatus(
+			IdRef event,
+			IdRef status)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSetUserEventStatus);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSetUserEventStatus, 3);
+			writeFixedInstruction(header, event, status);
+		}
+
+		constexpr void OpShiftLeftLogical(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef base,
+			IdRef shift)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpShiftLeftLogical);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpShiftLeftLogical, 5);
+			writeFixedInstruction(header, idResultType, idResult, base, shift);
+		}
+
+		constexpr void OpShiftRightArithmetic(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef base,
+			IdRef shift)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpShiftRightArithmetic);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpShiftRightArithmetic, 5);
+			writeFixedInstruction(header, idResultType, idResult, base, shift);
+		}
+
+		constexpr void OpShiftRightLogical(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef base,
+			IdRef shift)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpShiftRightLogical);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpShiftRightLogical, 5);
+			writeFixedInstruction(header, idResultType, idResult, base, shift);
+		}
+
+		constexpr void OpSignBitSet(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef x)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSignBitSet);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSignBitSet, 4);
+			writeFixedInstruction(header, idResultType, idResult, x);
+		}
+
+		constexpr void OpSizeOf(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSizeOf);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSizeOf, 4);
+			writeFixedInstruction(header, idResultType, idResult, pointer);
+		}
+
+		constexpr void OpSource(
+			spv::SourceLanguage sourceLanguage,
+			uint32_t version,
+			std::optional<IdRef> file = {},
+			std::optional<std::string_view> source = {})
+		{
+			if (getStripDebugInfo())
+			{
+				return;
+			}
+
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSource);
+
+			size_t wordCount = 3;
+			countOperandsWord(wordCount, file, source);
+
+			writeInstruction(spv::Op::OpSource, wordCount, sourceLanguage, version, file, source);
+		}
+
+		constexpr void OpSourceContinued(std::string_view continuedSource)
+		{
+			if (getStripDebugInfo())
+			{
+				return;
+			}
+
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSourceContinued);
+
+			size_t wordCount = 1;
+			countOperandsWord(wordCount, continuedSource);
+
+			writeInstruction(spv::Op::OpSourceContinued, wordCount, continuedSource);
+		}
+
+		constexpr void OpSourceExtension(std::string_view extension)
+		{
+			if (getStripDebugInfo())
+			{
+				return;
+			}
+
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSourceExtension);
+
+			size_t wordCount = 1;
+			countOperandsWord(wordCount, extension);
+
+			writeInstruction(spv::Op::OpSourceExtension, wordCount, extension);
+		}
+
+		constexpr void OpSpecConstant(
+			IdResultType idResultType,
+			IdResult idResult,
+			spvConstant auto value)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSpecConstant);
+
+			size_t wordCount = 3;
+			countOperandsWord(wordCount, value);
+
+			writeInstruction(spv::Op::OpSpecConstant, wordCount, idResultType, idResult, value);
+		}
+
+		constexpr void OpSpecConstantComposite(
+			IdResultType idResultType,
+			IdResult idResult,
+			OperandList<IdRef> constituents = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSpecConstantComposite);
+
+			size_t wordCount = 3;
+			countOperandsWord(wordCount, constituents);
+
+			writeInstruction(spv::Op::OpSpecConstantComposite, wordCount, idResultType, idResult, constituents);
+		}
+
+		constexpr InstructionBuilder<BasicModuleGenerator, IdRef> beginOpSpecConstantComposite(
+			IdResultType idResultType,
+			IdResult idResult)
+		{
+			beginInstruction(idResultType, idResult);
+			return {*this, spv::Op::OpSpecConstantComposite};
+		}
+
+		constexpr void OpSpecConstantFalse(
+			IdResultType idResultType,
+			IdResult idResult)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSpecConstantFalse);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSpecConstantFalse, 3);
+			writeFixedInstruction(header, idResultType, idResult);
+		}
+
+		constexpr void OpSpecConstantOp(
+			IdResultType idResultType,
+			IdResult idResult,
+			uint32_t opcode)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSpecConstantOp);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSpecConstantOp, 4);
+			writeFixedInstruction(header, idResultType, idResult, opcode);
+		}
+
+		constexpr void OpSpecConstantTrue(
+			IdResultType idResultType,
+			IdResult idResult)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSpecConstantTrue);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSpecConstantTrue, 3);
+			writeFixedInstruction(header, idResultType, idResult);
+		}
+
+		constexpr void OpStore(
+			IdRef pointer,
+			IdRef object,
+			std::optional<spv::MemoryAccessMask> memoryAccess = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpStore);
+
+			size_t wordCount = 3;
+			countOperandsWord(wordCount, memoryAccess);
+
+			writeInstruction(spv::Op::OpStore, wordCount, pointer, object, memoryAccess);
+		}
+
+		constexpr void OpString(
+			IdResult idResult,
+			std::string_view string)
+		{
+			if (getStripDebugInfo())
+			{
+				return;
+			}
+
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpString);
+
+			size_t wordCount = 2;
+			countOperandsWord(wordCount, string);
+
+			writeInstruction(spv::Op::OpString, wordCount, idResult, string);
+		}
+
+		constexpr void OpSwitch(
+			IdRef selector,
+			IdRef _default,
+			OperandList<std::tuple<uint32_t, IdRef>> target = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpSwitch);
+
+			size_t wordCount = 3;
+			countOperandsWord(wordCount, target);
+
+			writeInstruction(spv::Op::OpSwitch, wordCount, selector, _default, target);
+		}
+
+		constexpr InstructionBuilder<BasicModuleGenerator, std::tuple<uint32_t, IdRef>> beginOpSwitch(
+			IdRef selector,
+			IdRef _default)
+		{
+			beginInstruction(selector, _default);
+			return {*this, spv::Op::OpSwitch};
+		}
+
+		constexpr void OpTerminateInvocation()
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpTerminateInvocation);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTerminateInvocation, 1);
+			writeFixedInstruction(header);
+		}
+
+		constexpr void OpTranspose(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef matrix)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpTranspose);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTranspose, 4);
+			writeFixedInstruction(header, idResultType, idResult, matrix);
+		}
+
+		constexpr void OpTypeArray(
+			IdResult idResult,
+			IdRef elementType,
+			IdRef length)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpTypeArray);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeArray, 4);
+			writeFixedInstruction(header, idResult, elementType, length);
+		}
+
+		constexpr void OpTypeBool(IdResult idResult)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpTypeBool);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeBool, 2);
+			writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpTypeDeviceEvent(IdResult idResult)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpTypeDeviceEvent);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeDeviceEvent, 2);
+			writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpTypeEvent(IdResult idResult)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpTypeEvent);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeEvent, 2);
+			writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpTypeFloat(
+			IdResult idResult,
+			uint32_t width,
+			std::optional<spv::FPEncoding> floatingPointEncoding = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpTypeFloat);
+
+			size_t wordCount = 3;
+			countOperandsWord(wordCount, floatingPointEncoding);
+
+			writeInstruction(spv::Op::OpTypeFloat, wordCount, idResult, width, floatingPointEncoding);
+		}
+
+		constexpr void OpTypeForwardPointer(
+			IdRef pointerType,
+			spv::StorageClass storageClass)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpTypeForwardPointer);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeForwardPointer, 3);
+			writeFixedInstruction(header, pointerType, static_cast<uint32_t>(storageClass));
+		}
+
+		constexpr void OpTypeFunction(
+			IdResult idResult,
+			IdRef returnType,
+			OperandList<IdRef> parameterTypes = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpTypeFunction);
+
+			size_t wordCount = 3;
+			countOperandsWord(wordCount, parameterTypes);
+
+			writeInstruction(spv::Op::OpTypeFunction, wordCount, idResult, returnType, parameterTypes);
+		}
+
+		constexpr InstructionBuilder<BasicModuleGenerator, IdRef> beginOpTypeFunction(
+			IdResult idResult,
+			IdRef returnType)
+		{
+			beginInstruction(idResult, returnType);
+			return {*this, spv::Op::OpTypeFunction};
+		}
+
+		constexpr void OpTypeImage(
+			IdResult idResult,
+			IdRef sampledType,
+			spv::Dim dim,
+			uint32_t depth,
+			uint32_t arrayed,
+			uint32_t MS,
+			uint32_t sampled,
+			spv::ImageFormat imageFormat,
+			std::optional<spv::AccessQualifier> accessQualifier = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpTypeImage);
+
+			size_t wordCount = 9;
+			countOperandsWord(wordCount, accessQualifier);
+
+			writeInstruction(spv::Op::OpTypeImage, wordCount, idResult, sampledType, dim, depth, arrayed, MS, sampled, imageFormat, accessQualifier);
+		}
+
+		constexpr void OpTypeInt(
+			IdResult idResult,
+			uint32_t width,
+			uint32_t signedness)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpTypeInt);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeInt, 4);
+			writeFixedInstruction(header, idResult, width, signedness);
+		}
+
+		constexpr void OpTypeMatrix(
+			IdResult idResult,
+			IdRef columnType,
+			uint32_t columnCount)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpTypeMatrix);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeMatrix, 4);
+			writeFixedInstruction(header, idResult, columnType, columnCount);
+		}
+
+		constexpr void OpTypeNamedBarrier(IdResult idResult)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpTypeNamedBarrier);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeNamedBarrier, 2);
+			writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpTypeOpaque(
+			IdResult idResult,
+			std::string_view theNameOfTheOpaqueType)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpTypeOpaque);
+
+			size_t wordCount = 2;
+			countOperandsWord(wordCount, theNameOfTheOpaqueType);
+
+			writeInstruction(spv::Op::OpTypeOpaque, wordCount, idResult, theNameOfTheOpaqueType);
+		}
+
+		constexpr void OpTypePipe(
+			IdResult idResult,
+			spv::AccessQualifier qualifier)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpTypePipe);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypePipe, 3);
+			writeFixedInstruction(header, idResult, static_cast<uint32_t>(qualifier));
+		}
+
+		constexpr void OpTypePipeStorage(IdResult idResult)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpTypePipeStorage);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypePipeStorage, 2);
+			writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpTypePointer(
+			IdResult idResult,
+			spv::StorageClass storageClass,
+			IdRef type)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpTypePointer);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypePointer, 4);
+			writeFixedInstruction(header, idResult, static_cast<uint32_t>(storageClass), type);
+		}
+
+		constexpr void OpTypeQueue(IdResult idResult)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpTypeQueue);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeQueue, 2);
+			writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpTypeReserveId(IdResult idResult)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpTypeReserveId);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeReserveId, 2);
+			writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpTypeRuntimeArray(
+			IdResult idResult,
+			IdRef elementType)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpTypeRuntimeArray);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeRuntimeArray, 3);
+			writeFixedInstruction(header, idResult, elementType);
+		}
+
+		constexpr void OpTypeSampledImage(
+			IdResult idResult,
+			IdRef imageType)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpTypeSampledImage);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeSampledImage, 3);
+			writeFixedInstruction(header, idResult, imageType);
+		}
+
+		constexpr void OpTypeSampler(IdResult idResult)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpTypeSampler);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeSampler, 2);
+			writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpTypeStruct(
+			IdResult idResult,
+			OperandList<IdRef> memberTypes = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpTypeStruct);
+
+			size_t wordCount = 2;
+			countOperandsWord(wordCount, memberTypes);
+
+			writeInstruction(spv::Op::OpTypeStruct, wordCount, idResult, memberTypes);
+		}
+
+		constexpr InstructionBuilder<BasicModuleGenerator, IdRef> beginOpTypeStruct(IdResult idResult)
+		{
+			beginInstruction(idResult);
+			return {*this, spv::Op::OpTypeStruct};
+		}
+
+		constexpr void OpTypeVector(
+			IdResult idResult,
+			IdRef componentType,
+			uint32_t componentCount)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpTypeVector);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeVector, 4);
+			writeFixedInstruction(header, idResult, componentType, componentCount);
+		}
+
+		constexpr void OpTypeVoid(IdResult idResult)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpTypeVoid);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeVoid, 2);
+			writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpUConvert(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef unsignedValue)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpUConvert);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpUConvert, 4);
+			writeFixedInstruction(header, idResultType, idResult, unsignedValue);
+		}
+
+		constexpr void OpUDiv(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpUDiv);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpUDiv, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpUDot(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef vector1,
+			IdRef vector2,
+			std::optional<spv::PackedVectorFormat> packedVectorFormat = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpUDot);
+
+			size_t wordCount = 5;
+			countOperandsWord(wordCount, packedVectorFormat);
+
+			writeInstruction(spv::Op::OpUDot, wordCount, idResultType, idResult, vector1, vector2, packedVectorFormat);
+		}
+
+		constexpr void OpUDotAccSat(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef vector1,
+			IdRef vector2,
+			IdRef accumulator,
+			std::optional<spv::PackedVectorFormat> packedVectorFormat = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpUDotAccSat);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, packedVectorFormat);
+
+			writeInstruction(spv::Op::OpUDotAccSat, wordCount, idResultType, idResult, vector1, vector2, accumulator, packedVectorFormat);
+		}
+
+		constexpr void OpUGreaterThan(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpUGreaterThan);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpUGreaterThan, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpUGreaterThanEqual(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpUGreaterThanEqual);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpUGreaterThanEqual, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpULessThan(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpULessThan);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpULessThan, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpULessThanEqual(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpULessThanEqual);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpULessThanEqual, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpUMod(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpUMod);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpUMod, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpUMulExtended(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpUMulExtended);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpUMulExtended, 5);
+			writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpUndef(
+			IdResultType idResultType,
+			IdResult idResult)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpUndef);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpUndef, 3);
+			writeFixedInstruction(header, idResultType, idResult);
+		}
+
+		constexpr void OpUnordered(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef x,
+			IdRef y)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpUnordered);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpUnordered, 5);
+			writeFixedInstruction(header, idResultType, idResult, x, y);
+		}
+
+		constexpr void OpUnreachable()
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpUnreachable);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpUnreachable, 1);
+			writeFixedInstruction(header);
+		}
+
+		constexpr void OpVariable(
+			IdResultType idResultType,
+			IdResult idResult,
+			spv::StorageClass storageClass,
+			std::optional<IdRef> initializer = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpVariable);
+
+			size_t wordCount = 4;
+			countOperandsWord(wordCount, initializer);
+
+			writeInstruction(spv::Op::OpVariable, wordCount, idResultType, idResult, storageClass, initializer);
+		}
+
+		constexpr void OpVectorExtractDynamic(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef vector,
+			IdRef index)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpVectorExtractDynamic);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpVectorExtractDynamic, 5);
+			writeFixedInstruction(header, idResultType, idResult, vector, index);
+		}
+
+		constexpr void OpVectorInsertDynamic(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef vector,
+			IdRef component,
+			IdRef index)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpVectorInsertDynamic);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpVectorInsertDynamic, 6);
+			writeFixedInstruction(header, idResultType, idResult, vector, component, index);
+		}
+
+		constexpr void OpVectorShuffle(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef vector1,
+			IdRef vector2,
+			OperandList<uint32_t> components = {})
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpVectorShuffle);
+
+			size_t wordCount = 5;
+			countOperandsWord(wordCount, components);
+
+			writeInstruction(spv::Op::OpVectorShuffle, wordCount, idResultType, idResult, vector1, vector2, components);
+		}
+
+		constexpr InstructionBuilder<BasicModuleGenerator, uint32_t> beginOpVectorShuffle(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef vector1,
+			IdRef vector2)
+		{
+			beginInstruction(idResultType, idResult, vector1, vector2);
+			return {*this, spv::Op::OpVectorShuffle};
+		}
+
+		constexpr void OpVectorTimesMatrix(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef vector,
+			IdRef matrix)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpVectorTimesMatrix);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpVectorTimesMatrix, 5);
+			writeFixedInstruction(header, idResultType, idResult, vector, matrix);
+		}
+
+		constexpr void OpVectorTimesScalar(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef vector,
+			IdRef scalar)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpVectorTimesScalar);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpVectorTimesScalar, 5);
+			writeFixedInstruction(header, idResultType, idResult, vector, scalar);
+		}
+
+		constexpr void OpWritePipe(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pipe,
+			IdRef pointer,
+			IdRef packetSize,
+			IdRef packetAlignment)
+		{
+			DYNSPV_INSTRUMENT(*this, spv::Op::OpWritePipe);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpWritePipe, 7);
+			writeFixedInstruction(header, idResultType, idResult, pipe, pointer, packetSize, packetAlignment);
+		}
+	};
+
+	using ModuleGenerator = BasicModuleGenerator<>;
+
+	// Returns the number of words builder emits, builder is called with a generator as its only argument
+	template<typename TBuilder, typename TInstructionSets = DefaultInstructionSets>
+	constexpr size_t measureModule(TBuilder&& builder)
+	{
+		BasicModuleGenerator<CountingSink, TInstructionSets> generator{};
+		builder(generator);
+		return generator.getSink().size();
+	}
+
+	// Measures builder first, then emits it into a buffer allocated once with the exact size
+	template<typename TBuilder, typename TInstructionSets = DefaultInstructionSets>
+	std::vector<uint32_t> buildModule(TBuilder&& builder)
+	{
+		BasicModuleGenerator<VectorSink, TInstructionSets> generator{VectorSink{measureModule<TBuilder&, TInstructionSets>(builder)}};
+		builder(generator);
+		return generator.getSink().releaseCode();
+	}
+
+	// Emits builder into an array of N words, usable at compile time:
+	// static constexpr auto code = buildModule<measureModule(builder)>(builder);
+	template<size_t N, typename TBuilder, typename TInstructionSets = DefaultInstructionSets>
+	constexpr std::array<uint32_t, N> buildModule(TBuilder&& builder)
+	{
+		BasicModuleGenerator<ArraySink<N>, TInstructionSets> generator{};
+		builder(generator);
+		return generator.getSink().getCode();
+	}
+
+	// Emits one OpConstant of type per value with consecutive ids, returns the first one.
+	// Ids come from generator.allocateIds(), so generators drawing ids from a shared allocator keep them unique.
+	template<typename TGenerator, std::ranges::contiguous_range TValues>
+		requires spvConstant<std::ranges::range_value_t<TValues>>
+	constexpr IdResult writeConstants(TGenerator& generator, IdResultType type, const TValues& values)
+	{
+		const IdResult firstId = generator.allocateIds(static_cast<uint32_t>(std::ranges::size(values)));
+		generator.writeConstants(type, firstId, values);
+		return firstId;
+	}
+
+	// writeConstants() followed by an OpConstantComposite of compositeType over the constants, returns the composite id.
+	// Throws std::length_error before emitting anything when the composite would exceed 65535 words.
+	template<typename TGenerator, std::ranges::contiguous_range TValues>
+		requires spvConstant<std::ranges::range_value_t<TValues>>
+	constexpr IdResult writeConstantComposite(TGenerator& generator, IdResultType compositeType, IdResultType type, const TValues& values)
+	{
+		const size_t constituentCount = std::ranges::size(values);
+		checkInstructionWordCount(constituentCount + 3);
+
+		const IdResult firstId = writeConstants(generator, type, values);
+		const IdResult compositeId = generator.nextId();
+		generator.writeConstantComposite(compositeType, compositeId, firstId, constituentCount);
+		return compositeId;
+	}
+
+	// Word range of a module, [begin, end)
+	struct WordRange
+	{
+		size_t begin = 0;
+		size_t end = 0;
+	};
+
+	// Edits a finished module in place, functions can be replaced without re-encoding the rest of the module.
+	// Changed word ranges are tracked so only those need to be uploaded again.
+	template<typename TGenerator = ModuleGenerator>
+	class ModuleEditor
+	{
+	  protected:
+		struct FunctionRange
+		{
+			IdResult id;
+			WordRange range;
+		};
+
+		std::vector<uint32_t> m_code;
+		std::vector<FunctionRange> m_functions;
+		std::vector<WordRange> m_dirtyRanges;
+
+		// Merges range with every dirty range it touches, so the ranges never overlap
+		void markDirty(WordRange range)
+		{
+			std::erase_if(m_dirtyRanges, [&range](const WordRange& dirtyRange) {
+					if (range.begin > dirtyRange.end || dirtyRange.begin > range.end)
+					{
+						return false;
+					}
+
+					range.begin = std::min(dirtyRange.begin, range.begin);
+					range.end = std::max(dirtyRange.end, range.end);
+					return true;
+				});
+			m_dirtyRanges.push_back(range);
+		}
+
+	  public:
+		explicit ModuleEditor(std::vector<uint32_t> code)
+			: m_code(std::move(code))
+		{
+			if (m_code.size() < HEADER_SIZE || m_code[0] != spv::MagicNumber)
+			{
+				throw std::invalid_argument("dynspv: not a SPIR-V module");
+			}
+
+			for (size_t i = HEADER_SIZE; i < m_code.size(); i += m_code[i] >> 16)
+			{
+				const size_t wordCount = m_code[i] >> 16;
+				if (wordCount == 0 || wordCount > m_code.size() - i)
+				{
+					throw std::invalid_argument("dynspv: malformed instruction in module");
+				}
+
+				auto opcode = static_cast<spv::Op>(m_code[i] & 0xffff);
+				if (opcode == spv::Op::OpFunction)
+				{
+					if (wordCount < 3)
+					{
+						throw std::invalid_argument("dynspv: malformed instruction in module");
+					}
+					m_functions.push_back({m_code[i + 2], {i, i}});
+				}
+				else if (opcode == spv::Op::OpFunctionEnd && !m_functions.empty())
+				{
+					m_functions.back().range.end = i + 1;
+				}
+			}
+		}
+
+		std::span<const uint32_t> view() const
+		{
+			return m_code;
+		}
+
+		uint32_t getBound() const
+		{
+			return m_code[BOUND_INDEX];
+		}
+
+		std::optional<WordRange> findFunction(IdResult function) const
+		{
+			for (auto&& functionRange : m_functions)
+			{
+				if (functionRange.id == function)
+				{
+					return functionRange.range;
+				}
+			}
+
+			return std::nullopt;
+		}
+
+		// Generator for a replacement function, its ids start at the current bound of the module
+		TGenerator beginFunction() const
+		{
+			TGenerator generator{};
+			ModuleSnapshot snapshot{};
+			snapshot.nextId = getBound();
+			generator.restore(snapshot);
+			return generator;
+		}
+
+		// Splices the OpFunction ... OpFunctionEnd words emitted by generator in place of function
+		void replaceFunction(IdResult function, const TGenerator& generator)
+		{
+			auto it = std::find_if(m_functions.begin(), m_functions.end(), [function](auto&& functionRange) { return functionRange.id == function; });
+			if (it == m_functions.end())
+			{
+				throw std::invalid_argument("dynspv: function not found in module");
+			}
+
+			const std::span<const uint32_t> code = generator.view();
+			const WordRange range = it->range;
+			const size_t oldSize = range.end - range.begin;
+
+			if (code.size() == oldSize)
+			{
+				std::copy(code.begin(), code.end(), m_code.begin() + range.begin);
+				markDirty({range.begin, range.begin + code.size()});
+			}
+			else
+			{
+				m_code.erase(m_code.begin() + range.begin, m_code.begin() + range.end);
+				m_code.insert(m_code.begin() + range.begin, code.begin(), code.end());
+
+				// Everything after the function moved
+				const ptrdiff_t delta = static_cast<ptrdiff_t>(code.size()) - static_cast<ptrdiff_t>(oldSize);
+				for (auto next = it + 1; next != m_functions.end(); next++)
+				{
+					next->range.begin += delta;
+					next->range.end += delta;
+				}
+
+				// The old dirty ranges past the function are covered by the new one, the others are cut where it starts
+				for (auto&& dirtyRange : m_dirtyRanges)
+				{
+					dirtyRange.begin = std::min(dirtyRange.begin, range.begin);
+					dirtyRange.end = std::min(dirtyRange.end, range.begin);
+				}
+				markDirty({range.begin, m_code.size()});
+			}
+			it->range.end = range.begin + code.size();
+
+			if (generator.getBound() > getBound())
+			{
+				m_code[BOUND_INDEX] = generator.getBound();
+				markDirty({BOUND_INDEX, BOUND_INDEX + 1});
+			}
+		}
+
+		const std::vector<WordRange>& getDirtyRanges() const
+		{
+			return m_dirtyRanges;
+		}
+
+		void clearDirtyRanges()
+		{
+			m_dirtyRanges.clear();
+		}
+
+		std::vector<uint32_t> releaseCode()
+		{
+			return std::move(m_code);
+		}
+	};
+
+	// Open addressing hash map from encoded instruction words to the id defined by that instruction
+	class InstructionCache
+	{
+	  protected:
+		struct Entry
+		{
+			uint64_t hash = 0;
+			uint32_t keyOffset = 0;
+			uint32_t id = 0;
+		};
+
+		// Keys are stored back to back, each one prefixed by its length
+		std::vector<uint32_t> m_keys;
+		std::vector<uint32_t> m_key;
+		std::vector<Entry> m_entries;
+		size_t m_count = 0;
+
+		static uint64_t hashKey(std::span<const uint32_t> key)
+		{
+			return hashWords(key) | 1;
+		}
+
+		bool matches(const Entry& entry, std::span<const uint32_t> key) const
+		{
+			const uint32_t* storedKey = m_keys.data() + entry.keyOffset;
+			return storedKey[0] == key.size() && std::equal(key.begin(), key.end(), storedKey + 1);
+		}
+
+		void rehash()
+		{
+			std::vector<Entry> entries(std::max<size_t>(64, m_entries.size() * 2));
+			const size_t mask = entries.size() - 1;
+			for (auto&& entry : m_entries)
+			{
+				if (entry.hash == 0)
+				{
+					continue;
+				}
+
+				size_t index = entry.hash & mask;
+				while (entries[index].hash != 0)
+				{
+					index = (index + 1) & mask;
+				}
+				entries[index] = entry;
+			}
+			m_entries = std::move(entries);
+		}
+
+	  public:
+		// Returns storage for the key used by the next findOrAdd() call
+		uint32_t* prepareKey(size_t size)
+		{
+			m_key.resize(size);
+			return m_key.data();
+		}
+
+		// Returns the id stored for the prepared key, a new entry holds 0 and the caller must assign it
+		uint32_t& findOrAdd()
+		{
+			if ((m_count + 1) * 2 > m_entries.size())
+			{
+				rehash();
+			}
+
+			const uint64_t hash = hashKey(m_key);
+			const size_t mask = m_entries.size() - 1;
+			size_t index = hash & mask;
+			while (m_entries[index].hash != 0)
+			{
+				Entry& entry = m_entries[index];
+				if (entry.hash == hash && matches(entry, m_key))
+				{
+					return entry.id;
+				}
+				index = (index + 1) & mask;
+			}
+
+			Entry& entry = m_entries[index];
+			entry.hash = hash;
+			entry.keyOffset = static_cast<uint32_t>(m_keys.size());
+			m_keys.push_back(static_cast<uint32_t>(m_key.size()));
+			m_keys.insert(m_keys.end(), m_key.begin(), m_key.end());
+			m_count++;
+			return entry.id;
+		}
+
+		size_t size() const
+		{
+			return m_count;
+		}
+
+		void clear()
+		{
+			m_keys.clear();
+			m_entries.clear();
+			m_count = 0;
+		}
+	};
+
+	// Snapshot of an InterningGenerator, restoring it brings back the types and constants interned before it was taken
+	struct InterningSnapshot : ModuleSnapshot
+	{
+		InstructionCache cache;
+	};
+
+	// Opt-in deduplication of types and constants on top of any generator
+	template<typename TGenerator = ModuleGenerator>
+	class InterningGenerator : public TGenerator
+	{
+	  protected:
+		InstructionCache m_cache;
+
+	  public:
+		using TGenerator::TGenerator;
+
+		// Emits a type instruction unless an identical one was emitted before, returns its result id,
+		// e.g. internType(spv::Op::OpTypeInt, 32, 1)
+		template<typename... TArgs>
+		IdResult internType(spv::Op opcode, const TArgs&... operands)
+		{
+			size_t wordCount = 2;
+			countOperandsWord(wordCount, operands...);
+			checkInstructionWordCount(wordCount);
+
+			uint32_t* key = m_cache.prepareKey(wordCount - 1);
+			*key++ = makeInstructionHeader(opcode, static_cast<uint16_t>(wordCount));
+			encodeWords(key, operands...);
+
+			uint32_t& id = m_cache.findOrAdd();
+			if (id == 0)
+			{
+				id = this->nextId();
+				this->writeInstruction(opcode, wordCount, id, operands...);
+			}
+			return id;
+		}
+
+		// Same as internType() for instructions with a result type, e.g. internConstant(spv::Op::OpConstant, intType, 1)
+		template<typename... TArgs>
+		IdResult internConstant(spv::Op opcode, IdResultType resultType, const TArgs&... operands)
+		{
+			size_t wordCount = 3;
+			countOperandsWord(wordCount, operands...);
+			checkInstructionWordCount(wordCount);
+
+			uint32_t* key = m_cache.prepareKey(wordCount - 1);
+			*key++ = makeInstructionHeader(opcode, static_cast<uint16_t>(wordCount));
+			*key++ = resultType;
+			encodeWords(key, operands...);
+
+			uint32_t& id = m_cache.findOrAdd();
+			if (id == 0)
+			{
+				id = this->nextId();
+				this->writeInstruction(opcode, wordCount, resultType, id, operands...);
+			}
+			return id;
+		}
+
+		InstructionCache& getCache()
+		{
+			return m_cache;
+		}
+
+		InterningSnapshot snapshot() const
+		{
+			return {TGenerator::snapshot(), m_cache};
+		}
+
+		// The cache is rewound with the code, so it never returns the id of an instruction emitted after snapshot
+		void restore(const InterningSnapshot& snapshot)
+		{
+			TGenerator::restore(snapshot);
+			m_cache = snapshot.cache;
+		}
+
+		// A plain ModuleSnapshot does not know which instructions were interned, types and constants are emitted again
+		void restore(const ModuleSnapshot& snapshot)
+		{
+			TGenerator::restore(snapshot);
+			m_cache.clear();
+		}
+
+		void reset()
+		{
+			TGenerator::reset();
+			m_cache.clear();
+		}
+	};
+
+	// Emits prefix once and every variant on top of a copy of it, variant is called with the generator and the
+	// variant index and should finish its module, e.g. by calling updateBound()
+	template<typename TGenerator = ModuleGenerator, typename TPrefix, typename TVariant>
+	std::vector<std::vector<uint32_t>> buildVariants(TPrefix&& prefix, size_t variantCount, TVariant&& variant)
+	{
+		TGenerator generator{};
+		prefix(generator);
+		const auto snapshot = generator.snapshot();
+
+		std::vector<std::vector<uint32_t>> modules;
+		modules.reserve(variantCount);
+		for (size_t i = 0; i < variantCount; i++)
+		{
+			generator.restore(snapshot);
+			variant(generator, i);
+
+			const std::span<const uint32_t> code = generator.view();
+			modules.emplace_back(code.begin(), code.end());
+		}
+
+		return modules;
+	}
+
+	// Logical layout of a module, sections are stitched together in this order
+	enum class ModuleSection : uint8_t
+	{
+		Capabilities,
+		Extensions,
+		ExtInstImports,
+		MemoryModel,
+		EntryPoints,
+		ExecutionModes,
+		DebugStrings,
+		DebugNames,
+		DebugModuleProcessed,
+		Annotations,
+		Types,
+		FunctionDeclarations,
+		Count
+	};
+
+	// Generator for a single section, ids come in blocks from the owning ModuleBuilder
+	template<typename TGenerator = ModuleGenerator>
+	class SectionGenerator : public TGenerator
+	{
+	  protected:
+		IdBlock m_ids;
+
+	  public:
+		explicit SectionGenerator(IdAllocator& allocator, uint32_t idBlockSize = DEFAULT_ID_BLOCK_SIZE)
+			: m_ids(allocator, idBlockSize)
+		{
+			this->setIdBlock(&m_ids);
+		}
+
+		SectionGenerator(const SectionGenerator&) = delete;
+		SectionGenerator& operator=(const SectionGenerator&) = delete;
+
+		IdBlock& getIdBlock()
+		{
+			return m_ids;
+		}
+	};
+
+	// Builds a module out of per-section buffers, so instructions can be emitted in any order.
+	// Function generators can be filled concurrently, each one from a single thread at a time.
+	template<typename TGenerator = ModuleGenerator>
+	class ModuleBuilder
+	{
+	  protected:
+		IdAllocator m_ids;
+		uint32_t m_idBlockSize;
+		std::deque<SectionGenerator<TGenerator>> m_sections;
+		std::deque<SectionGenerator<TGenerator>> m_functions;
+
+		// Hands unused id blocks back, newest first, so the bound stays as tight as the allocation order allows
+		void releaseIdBlocks()
+		{
+			std::vector<IdBlock*> blocks;
+			for (auto&& generator : m_sections)
+			{
+				blocks.push_back(&generator.getIdBlock());
+			}
+			for (auto&& generator : m_functions)
+			{
+				blocks.push_back(&generator.getIdBlock());
+			}
+
+			std::sort(blocks.begin(), blocks.end(), [](const IdBlock* a, const IdBlock* b) { return a->getBlockEnd() > b->getBlockEnd(); });
+			for (IdBlock* block : blocks)
+			{
+				block->release();
+			}
+		}
+
+	  public:
+		explicit ModuleBuilder(uint32_t idBlockSize = DEFAULT_ID_BLOCK_SIZE)
+			: m_idBlockSize(idBlockSize)
+		{
+			for (size_t i = 0; i < static_cast<size_t>(ModuleSection::Count); i++)
+			{
+				m_sections.emplace_back(m_ids, m_idBlockSize);
+			}
+		}
+
+		ModuleBuilder(const ModuleBuilder&) = delete;
+		ModuleBuilder& operator=(const ModuleBuilder&) = delete;
+
+		// Thread-safe, generators obtained from the builder should prefer their own nextId()
+		uint32_t nextId()
+		{
+			return m_ids.allocate();
+		}
+
+		uint32_t getBound() const
+		{
+			return m_ids.getBound();
+		}
+
+		SectionGenerator<TGenerator>& section(ModuleSection section)
+		{
+			return m_sections[static_cast<size_t>(section)];
+		}
+
+		// Functions are stitched in the order they were added, not thread-safe
+		SectionGenerator<TGenerator>& addFunction()
+		{
+			return m_functions.emplace_back(m_ids, m_idBlockSize);
+		}
+
+		std::vector<uint32_t> finish(uint32_t version = spv::Version)
+		{
+			releaseIdBlocks();
+
+			size_t size = HEADER_SIZE;
+			for (auto&& generator : m_sections)
+			{
+				size += generator.view().size();
+			}
+			for (auto&& generator : m_functions)
+			{
+				size += generator.view().size();
+			}
+
+			TGenerator module{VectorSink{size}};
+			module.writeHeader(version);
+			for (auto&& generator : m_sections)
+			{
+				module.writeCode(generator.view());
+			}
+			for (auto&& generator : m_functions)
+			{
+				module.writeCode(generator.view());
+			}
+			module.updateBound(getBound());
+
+			return module.getSink().releaseCode();
+		}
+	};
+} // namespace dynspv
\ No newline at end of file
@@ -0,0 +1,220 @@
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include <dynspv_base.hpp>
+
+namespace dynspv
+{
+	// Instructions with the EXT suffix, mixed into generators listing it in their InstructionSets
+	template<typename TGenerator>
+	class ExtInstructions
+	{
+	  public:
+		constexpr void OpArithmeticFenceEXT(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef target)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArithmeticFenceEXT);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArithmeticFenceEXT, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, target);
+		}
+
+		constexpr void OpAtomicFAddEXT(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer,
+			IdScope memory,
+			IdMemorySemantics semantics,
+			IdRef value)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpAtomicFAddEXT);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAtomicFAddEXT, 7);
+			generator.writeFixedInstruction(header, idResultType, idResult, pointer, memory, semantics, value);
+		}
+
+		constexpr void OpAtomicFMaxEXT(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer,
+			IdScope memory,
+			IdMemorySemantics semantics,
+			IdRef value)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpAtomicFMaxEXT);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAtomicFMaxEXT, 7);
+			generator.writeFixedInstruction(header, idResultType, idResult, pointer, memory, semantics, value);
+		}
+
+		constexpr void OpAtomicFMinEXT(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer,
+			IdScope memory,
+			IdMemorySemantics semantics,
+			IdRef value)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpAtomicFMinEXT);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAtomicFMinEXT, 7);
+			generator.writeFixedInstruction(header, idResultType, idResult, pointer, memory, semantics, value);
+		}
+
+		constexpr void OpBeginInvocationInterlockEXT()
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpBeginInvocationInterlockEXT);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpBeginInvocationInterlockEXT, 1);
+			generator.writeFixedInstruction(header);
+		}
+
+		constexpr void OpColorAttachmentReadEXT(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef attachment,
+			std::optional<IdRef> sample = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpColorAttachmentReadEXT);
+
+			size_t wordCount = 4;
+			countOperandsWord(wordCount, sample);
+
+			generator.writeInstruction(spv::Op::OpColorAttachmentReadEXT, wordCount, idResultType, idResult, attachment, sample);
+		}
+
+		constexpr void OpCompositeConstructReplicateEXT(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef value)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpCompositeConstructReplicateEXT);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpCompositeConstructReplicateEXT, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, value);
+		}
+
+		constexpr void OpConstantCompositeReplicateEXT(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef value)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpConstantCompositeReplicateEXT);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpConstantCompositeReplicateEXT, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, value);
+		}
+
+		constexpr void OpDepthAttachmentReadEXT(
+			IdResultType idResultType,
+			IdResult idResult,
+			std::optional<IdRef> sample = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpDepthAttachmentReadEXT);
+
+			size_t wordCount = 3;
+			countOperandsWord(wordCount, sample);
+
+			generator.writeInstruction(spv::Op::OpDepthAttachmentReadEXT, wordCount, idResultType, idResult, sample);
+		}
+
+		constexpr void OpEmitMeshTasksEXT(
+			IdRef groupCountX,
+			IdRef groupCountY,
+			IdRef groupCountZ,
+			std::optional<IdRef> payload = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpEmitMeshTasksEXT);
+
+			size_t wordCount = 4;
+			countOperandsWord(wordCount, payload);
+
+			generator.writeInstruction(spv::Op::OpEmitMeshTasksEXT, wordCount, groupCountX, groupCountY, groupCountZ, payload);
+		}
+
+		constexpr void OpEndInvocationInterlockEXT()
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpEndInvocationInterlockEXT);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpEndInvocationInterlockEXT, 1);
+			generator.writeFixedInstruction(header);
+		}
+
+		constexpr void OpIsHelperInvocationEXT(
+			IdResultType idResultType,
+			IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpIsHelperInvocationEXT);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpIsHelperInvocationEXT, 3);
+			generator.writeFixedInstruction(header, idResultType, idResult);
+		}
+
+		constexpr void OpSetMeshOutputsEXT(
+			IdRef vertexCount,
+			IdRef primitiveCount)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSetMeshOutputsEXT);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSetMeshOutputsEXT, 3);
+			generator.writeFixedInstruction(header, vertexCount, primitiveCount);
+		}
+
+		constexpr void OpSpecConstantCompositeReplicateEXT(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef value)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSpecConstantCompositeReplicateEXT);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSpecConstantCompositeReplicateEXT, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, value);
+		}
+
+		constexpr void OpStencilAttachmentReadEXT(
+			IdResultType idResultType,
+			IdResult idResult,
+			std::optional<IdRef> sample = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpStencilAttachmentReadEXT);
+
+			size_t wordCount = 3;
+			countOperandsWord(wordCount, sample);
+
+			generator.writeInstruction(spv::Op::OpStencilAttachmentReadEXT, wordCount, idResultType, idResult, sample);
+		}
+	};
+} // namespace dynspv
\ No newline at end of file
@@ -0,0 +1,3599 @@
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include <dynspv_base.hpp>
+
+namespace dynspv
+{
+	// Instructions with the INTEL suffix, mixed into generators listing it in their InstructionSets
+	template<typename TGenerator>
+	class IntelInstructions
+	{
+	  public:
+		constexpr void OpAbsISubINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpAbsISubINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAbsISubINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpAbsUSubINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpAbsUSubINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAbsUSubINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpAliasDomainDeclINTEL(
+			IdResult idResult,
+			std::optional<IdRef> name = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpAliasDomainDeclINTEL);
+
+			size_t wordCount = 2;
+			countOperandsWord(wordCount, name);
+
+			generator.writeInstruction(spv::Op::OpAliasDomainDeclINTEL, wordCount, idResult, name);
+		}
+
+		constexpr void OpAliasScopeDeclINTEL(
+			IdResult idResult,
+			IdRef aliasDomain,
+			std::optional<IdRef> name = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpAliasScopeDeclINTEL);
+
+			size_t wordCount = 3;
+			countOperandsWord(wordCount, name);
+
+			generator.writeInstruction(spv::Op::OpAliasScopeDeclINTEL, wordCount, idResult, aliasDomain, name);
+		}
+
+		constexpr void OpAliasScopeListDeclINTEL(
+			IdResult idResult,
+			OperandList<IdRef> aliasScopes = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpAliasScopeListDeclINTEL);
+
+			size_t wordCount = 2;
+			countOperandsWord(wordCount, aliasScopes);
+
+			generator.writeInstruction(spv::Op::OpAliasScopeListDeclINTEL, wordCount, idResult, aliasScopes);
+		}
+
+		constexpr InstructionBuilder<TGenerator, IdRef> beginOpAliasScopeListDeclINTEL(IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			generator.beginInstruction(idResult);
+			return {generator, spv::Op::OpAliasScopeListDeclINTEL};
+		}
+
+		constexpr void OpArbitraryFloatACosINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t M1,
+			uint32_t mout,
+			uint32_t enableSubnormals,
+			uint32_t roundingMode,
+			uint32_t roundingAccuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatACosINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatACosINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, M1, mout, enableSubnormals, roundingMode, roundingAccuracy);
+		}
+
+		constexpr void OpArbitraryFloatACosPiINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatACosPiINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatACosPiINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatASinINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatASinINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatASinINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatASinPiINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatASinPiINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatASinPiINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatATan2INTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			IdRef B,
+			uint32_t mb,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatATan2INTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatATan2INTEL, 11);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, B, mb, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatATanINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatATanINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatATanINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatATanPiINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatATanPiINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatATanPiINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatAddINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			IdRef B,
+			uint32_t mb,
+			uint32_t mResult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatAddINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatAddINTEL, 11);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, B, mb, mResult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatCastFromIntINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t mresult,
+			uint32_t fromSign,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatCastFromIntINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatCastFromIntINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, mresult, fromSign, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatCastINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatCastINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatCastINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatCastToIntINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			uint32_t toSign,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatCastToIntINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatCastToIntINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, toSign, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatCbrtINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatCbrtINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatCbrtINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatCosINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatCosINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatCosINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatCosPiINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatCosPiINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatCosPiINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatDivINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			IdRef B,
+			uint32_t mb,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatDivINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatDivINTEL, 11);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, B, mb, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatEQINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			IdRef B,
+			uint32_t mb)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatEQINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatEQINTEL, 7);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, B, mb);
+		}
+
+		constexpr void OpArbitraryFloatExp10INTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatExp10INTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatExp10INTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatExp2INTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatExp2INTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatExp2INTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatExpINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatExpINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatExpINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatExpm1INTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatExpm1INTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatExpm1INTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatGEINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			IdRef B,
+			uint32_t mb)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatGEINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatGEINTEL, 7);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, B, mb);
+		}
+
+		constexpr void OpArbitraryFloatGTINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			IdRef B,
+			uint32_t mb)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatGTINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatGTINTEL, 7);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, B, mb);
+		}
+
+		constexpr void OpArbitraryFloatHypotINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			IdRef B,
+			uint32_t mb,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatHypotINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatHypotINTEL, 11);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, B, mb, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatLEINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			IdRef B,
+			uint32_t mb)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatLEINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatLEINTEL, 7);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, B, mb);
+		}
+
+		constexpr void OpArbitraryFloatLTINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			IdRef B,
+			uint32_t mb)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatLTINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatLTINTEL, 7);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, B, mb);
+		}
+
+		constexpr void OpArbitraryFloatLog10INTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatLog10INTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatLog10INTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatLog1pINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatLog1pINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatLog1pINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatLog2INTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatLog2INTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatLog2INTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatLogINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatLogINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatLogINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatMulINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			IdRef B,
+			uint32_t mb,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatMulINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatMulINTEL, 11);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, B, mb, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatPowINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			IdRef B,
+			uint32_t mb,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatPowINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatPowINTEL, 11);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, B, mb, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatPowNINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			IdRef B,
+			uint32_t signOfB,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatPowNINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatPowNINTEL, 11);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, B, signOfB, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatPowRINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			IdRef B,
+			uint32_t mb,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatPowRINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatPowRINTEL, 11);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, B, mb, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatRSqrtINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatRSqrtINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatRSqrtINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatRecipINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatRecipINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatRecipINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatSinCosINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatSinCosINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatSinCosINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatSinCosPiINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			uint32_t mResult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t roundingAccuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatSinCosPiINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatSinCosPiINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, mResult, subnormal, rounding, roundingAccuracy);
+		}
+
+		constexpr void OpArbitraryFloatSinINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatSinINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatSinINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatSinPiINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatSinPiINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatSinPiINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatSqrtINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatSqrtINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatSqrtINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpArbitraryFloatSubINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			uint32_t ma,
+			IdRef B,
+			uint32_t mb,
+			uint32_t mresult,
+			uint32_t subnormal,
+			uint32_t rounding,
+			uint32_t accuracy)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpArbitraryFloatSubINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpArbitraryFloatSubINTEL, 11);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, ma, B, mb, mresult, subnormal, rounding, accuracy);
+		}
+
+		constexpr void OpAsmCallINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef _asm,
+			OperandList<IdRef> argument0 = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpAsmCallINTEL);
+
+			size_t wordCount = 4;
+			countOperandsWord(wordCount, argument0);
+
+			generator.writeInstruction(spv::Op::OpAsmCallINTEL, wordCount, idResultType, idResult, _asm, argument0);
+		}
+
+		constexpr InstructionBuilder<TGenerator, IdRef> beginOpAsmCallINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef _asm)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			generator.beginInstruction(idResultType, idResult, _asm);
+			return {generator, spv::Op::OpAsmCallINTEL};
+		}
+
+		constexpr void OpAsmINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef asmType,
+			IdRef target,
+			std::string_view asmInstructions,
+			std::string_view constraints)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpAsmINTEL);
+
+			size_t wordCount = 5;
+			countOperandsWord(wordCount, asmInstructions, constraints);
+
+			generator.writeInstruction(spv::Op::OpAsmINTEL, wordCount, idResultType, idResult, asmType, target, asmInstructions, constraints);
+		}
+
+		constexpr void OpAsmTargetINTEL(
+			IdResult idResult,
+			std::string_view asmTarget)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpAsmTargetINTEL);
+
+			size_t wordCount = 2;
+			countOperandsWord(wordCount, asmTarget);
+
+			generator.writeInstruction(spv::Op::OpAsmTargetINTEL, wordCount, idResult, asmTarget);
+		}
+
+		constexpr void OpBitwiseFunctionINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			IdRef B,
+			IdRef C,
+			IdRef lUTIndex)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpBitwiseFunctionINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpBitwiseFunctionINTEL, 7);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, B, C, lUTIndex);
+		}
+
+		constexpr void OpCompositeConstructContinuedINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			OperandList<IdRef> constituents = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpCompositeConstructContinuedINTEL);
+
+			size_t wordCount = 3;
+			countOperandsWord(wordCount, constituents);
+
+			generator.writeInstruction(spv::Op::OpCompositeConstructContinuedINTEL, wordCount, idResultType, idResult, constituents);
+		}
+
+		constexpr InstructionBuilder<TGenerator, IdRef> beginOpCompositeConstructContinuedINTEL(
+			IdResultType idResultType,
+			IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			generator.beginInstruction(idResultType, idResult);
+			return {generator, spv::Op::OpCompositeConstructContinuedINTEL};
+		}
+
+		constexpr void OpConstantCompositeContinuedINTEL(OperandList<IdRef> constituents = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpConstantCompositeContinuedINTEL);
+
+			size_t wordCount = 1;
+			countOperandsWord(wordCount, constituents);
+
+			generator.writeInstruction(spv::Op::OpConstantCompositeContinuedINTEL, wordCount, constituents);
+		}
+
+		constexpr InstructionBuilder<TGenerator, IdRef> beginOpConstantCompositeContinuedINTEL()
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			generator.beginInstruction();
+			return {generator, spv::Op::OpConstantCompositeContinuedINTEL};
+		}
+
+		constexpr void OpConstantFunctionPointerINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef function)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpConstantFunctionPointerINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpConstantFunctionPointerINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, function);
+		}
+
+		constexpr void OpControlBarrierArriveINTEL(
+			IdScope execution,
+			IdScope memory,
+			IdMemorySemantics semantics)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpControlBarrierArriveINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpControlBarrierArriveINTEL, 4);
+			generator.writeFixedInstruction(header, execution, memory, semantics);
+		}
+
+		constexpr void OpControlBarrierWaitINTEL(
+			IdScope execution,
+			IdScope memory,
+			IdMemorySemantics semantics)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpControlBarrierWaitINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpControlBarrierWaitINTEL, 4);
+			generator.writeFixedInstruction(header, execution, memory, semantics);
+		}
+
+		constexpr void OpConvertBF16ToFINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef bFloat16Value)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpConvertBF16ToFINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpConvertBF16ToFINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, bFloat16Value);
+		}
+
+		constexpr void OpConvertFToBF16INTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef floatValue)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpConvertFToBF16INTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpConvertFToBF16INTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, floatValue);
+		}
+
+		constexpr void OpCrossWorkgroupCastToPtrINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpCrossWorkgroupCastToPtrINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpCrossWorkgroupCastToPtrINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, pointer);
+		}
+
+		constexpr void OpFPGARegINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef input)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpFPGARegINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFPGARegINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, input);
+		}
+
+		constexpr void OpFixedCosINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef input,
+			uint32_t S,
+			uint32_t I,
+			uint32_t rI,
+			uint32_t Q,
+			uint32_t O)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpFixedCosINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFixedCosINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, input, S, I, rI, Q, O);
+		}
+
+		constexpr void OpFixedCosPiINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef input,
+			uint32_t S,
+			uint32_t I,
+			uint32_t rI,
+			uint32_t Q,
+			uint32_t O)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpFixedCosPiINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFixedCosPiINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, input, S, I, rI, Q, O);
+		}
+
+		constexpr void OpFixedExpINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef input,
+			uint32_t S,
+			uint32_t I,
+			uint32_t rI,
+			uint32_t Q,
+			uint32_t O)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpFixedExpINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFixedExpINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, input, S, I, rI, Q, O);
+		}
+
+		constexpr void OpFixedLogINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef input,
+			uint32_t S,
+			uint32_t I,
+			uint32_t rI,
+			uint32_t Q,
+			uint32_t O)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpFixedLogINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFixedLogINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, input, S, I, rI, Q, O);
+		}
+
+		constexpr void OpFixedRecipINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef input,
+			uint32_t S,
+			uint32_t I,
+			uint32_t rI,
+			uint32_t Q,
+			uint32_t O)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpFixedRecipINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFixedRecipINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, input, S, I, rI, Q, O);
+		}
+
+		constexpr void OpFixedRsqrtINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef input,
+			uint32_t S,
+			uint32_t I,
+			uint32_t rI,
+			uint32_t Q,
+			uint32_t O)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpFixedRsqrtINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFixedRsqrtINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, input, S, I, rI, Q, O);
+		}
+
+		constexpr void OpFixedSinCosINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef input,
+			uint32_t S,
+			uint32_t I,
+			uint32_t rI,
+			uint32_t Q,
+			uint32_t O)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpFixedSinCosINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFixedSinCosINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, input, S, I, rI, Q, O);
+		}
+
+		constexpr void OpFixedSinCosPiINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef input,
+			uint32_t S,
+			uint32_t I,
+			uint32_t rI,
+			uint32_t Q,
+			uint32_t O)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpFixedSinCosPiINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFixedSinCosPiINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, input, S, I, rI, Q, O);
+		}
+
+		constexpr void OpFixedSinINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef input,
+			uint32_t S,
+			uint32_t I,
+			uint32_t rI,
+			uint32_t Q,
+			uint32_t O)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpFixedSinINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFixedSinINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, input, S, I, rI, Q, O);
+		}
+
+		constexpr void OpFixedSinPiINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef input,
+			uint32_t S,
+			uint32_t I,
+			uint32_t rI,
+			uint32_t Q,
+			uint32_t O)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpFixedSinPiINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFixedSinPiINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, input, S, I, rI, Q, O);
+		}
+
+		constexpr void OpFixedSqrtINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef input,
+			uint32_t S,
+			uint32_t I,
+			uint32_t rI,
+			uint32_t Q,
+			uint32_t O)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpFixedSqrtINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFixedSqrtINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, input, S, I, rI, Q, O);
+		}
+
+		constexpr void OpFunctionPointerCallINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			OperandList<IdRef> operand1 = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpFunctionPointerCallINTEL);
+
+			size_t wordCount = 3;
+			countOperandsWord(wordCount, operand1);
+
+			generator.writeInstruction(spv::Op::OpFunctionPointerCallINTEL, wordCount, idResultType, idResult, operand1);
+		}
+
+		constexpr InstructionBuilder<TGenerator, IdRef> beginOpFunctionPointerCallINTEL(
+			IdResultType idResultType,
+			IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			generator.beginInstruction(idResultType, idResult);
+			return {generator, spv::Op::OpFunctionPointerCallINTEL};
+		}
+
+		constexpr void OpIAddSatINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpIAddSatINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpIAddSatINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpIAverageINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpIAverageINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpIAverageINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpIAverageRoundedINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpIAverageRoundedINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpIAverageRoundedINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpIMul32x16INTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpIMul32x16INTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpIMul32x16INTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpISubSatINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpISubSatINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpISubSatINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpLoopControlINTEL(OperandList<uint32_t> loopControlParameters = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpLoopControlINTEL);
+
+			size_t wordCount = 1;
+			countOperandsWord(wordCount, loopControlParameters);
+
+			generator.writeInstruction(spv::Op::OpLoopControlINTEL, wordCount, loopControlParameters);
+		}
+
+		constexpr InstructionBuilder<TGenerator, uint32_t> beginOpLoopControlINTEL()
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			generator.beginInstruction();
+			return {generator, spv::Op::OpLoopControlINTEL};
+		}
+
+		constexpr void OpMaskedGatherINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef ptrVector,
+			uint32_t alignment,
+			IdRef mask,
+			IdRef fillEmpty)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpMaskedGatherINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpMaskedGatherINTEL, 7);
+			generator.writeFixedInstruction(header, idResultType, idResult, ptrVector, alignment, mask, fillEmpty);
+		}
+
+		constexpr void OpMaskedScatterINTEL(
+			IdRef inputVector,
+			IdRef ptrVector,
+			uint32_t alignment,
+			IdRef mask)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpMaskedScatterINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpMaskedScatterINTEL, 5);
+			generator.writeFixedInstruction(header, inputVector, ptrVector, alignment, mask);
+		}
+
+		constexpr void OpPtrCastToCrossWorkgroupINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpPtrCastToCrossWorkgroupINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpPtrCastToCrossWorkgroupINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, pointer);
+		}
+
+		constexpr void OpReadPipeBlockingINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef packetSize,
+			IdRef packetAlignment)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpReadPipeBlockingINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpReadPipeBlockingINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, packetSize, packetAlignment);
+		}
+
+		constexpr void OpRestoreMemoryINTEL(IdRef ptr)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRestoreMemoryINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRestoreMemoryINTEL, 2);
+			generator.writeFixedInstruction(header, ptr);
+		}
+
+		constexpr void OpRoundFToTF32INTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef floatValue)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRoundFToTF32INTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRoundFToTF32INTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, floatValue);
+		}
+
+		constexpr void OpSaveMemoryINTEL(
+			IdResultType idResultType,
+			IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSaveMemoryINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSaveMemoryINTEL, 3);
+			generator.writeFixedInstruction(header, idResultType, idResult);
+		}
+
+		constexpr void OpSpecConstantCompositeContinuedINTEL(OperandList<IdRef> constituents = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSpecConstantCompositeContinuedINTEL);
+
+			size_t wordCount = 1;
+			countOperandsWord(wordCount, constituents);
+
+			generator.writeInstruction(spv::Op::OpSpecConstantCompositeContinuedINTEL, wordCount, constituents);
+		}
+
+		constexpr InstructionBuilder<TGenerator, IdRef> beginOpSpecConstantCompositeContinuedINTEL()
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			generator.beginInstruction();
+			return {generator, spv::Op::OpSpecConstantCompositeContinuedINTEL};
+		}
+
+		constexpr void OpSubgroup2DBlockLoadINTEL(
+			IdRef elementSize,
+			IdRef blockWidth,
+			IdRef blockHeight,
+			IdRef blockCount,
+			IdRef srcBasePointer,
+			IdRef memoryWidth,
+			IdRef memoryHeight,
+			IdRef memoryPitch,
+			IdRef coordinate,
+			IdRef dstPointer)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroup2DBlockLoadINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroup2DBlockLoadINTEL, 11);
+			generator.writeFixedInstruction(header, elementSize, blockWidth, blockHeight, blockCount, srcBasePointer, memoryWidth, memoryHeight, memoryPitch, coordinate, dstPointer);
+		}
+
+		constexpr void OpSubgroup2DBlockLoadTransformINTEL(
+			IdRef elementSize,
+			IdRef blockWidth,
+			IdRef blockHeight,
+			IdRef blockCount,
+			IdRef srcBasePointer,
+			IdRef memoryWidth,
+			IdRef memoryHeight,
+			IdRef memoryPitch,
+			IdRef coordinate,
+			IdRef dstPointer)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroup2DBlockLoadTransformINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroup2DBlockLoadTransformINTEL, 11);
+			generator.writeFixedInstruction(header, elementSize, blockWidth, blockHeight, blockCount, srcBasePointer, memoryWidth, memoryHeight, memoryPitch, coordinate, dstPointer);
+		}
+
+		constexpr void OpSubgroup2DBlockLoadTransposeINTEL(
+			IdRef elementSize,
+			IdRef blockWidth,
+			IdRef blockHeight,
+			IdRef blockCount,
+			IdRef srcBasePointer,
+			IdRef memoryWidth,
+			IdRef memoryHeight,
+			IdRef memoryPitch,
+			IdRef coordinate,
+			IdRef dstPointer)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroup2DBlockLoadTransposeINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroup2DBlockLoadTransposeINTEL, 11);
+			generator.writeFixedInstruction(header, elementSize, blockWidth, blockHeight, blockCount, srcBasePointer, memoryWidth, memoryHeight, memoryPitch, coordinate, dstPointer);
+		}
+
+		constexpr void OpSubgroup2DBlockPrefetchINTEL(
+			IdRef elementSize,
+			IdRef blockWidth,
+			IdRef blockHeight,
+			IdRef blockCount,
+			IdRef srcBasePointer,
+			IdRef memoryWidth,
+			IdRef memoryHeight,
+			IdRef memoryPitch,
+			IdRef coordinate)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroup2DBlockPrefetchINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroup2DBlockPrefetchINTEL, 10);
+			generator.writeFixedInstruction(header, elementSize, blockWidth, blockHeight, blockCount, srcBasePointer, memoryWidth, memoryHeight, memoryPitch, coordinate);
+		}
+
+		constexpr void OpSubgroup2DBlockStoreINTEL(
+			IdRef elementSize,
+			IdRef blockWidth,
+			IdRef blockHeight,
+			IdRef blockCount,
+			IdRef srcPointer,
+			IdRef dstBasePointer,
+			IdRef memoryWidth,
+			IdRef memoryHeight,
+			IdRef memoryPitch,
+			IdRef coordinate)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroup2DBlockStoreINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroup2DBlockStoreINTEL, 11);
+			generator.writeFixedInstruction(header, elementSize, blockWidth, blockHeight, blockCount, srcPointer, dstBasePointer, memoryWidth, memoryHeight, memoryPitch, coordinate);
+		}
+
+		constexpr void OpSubgroupAvcBmeInitializeINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef srcCoord,
+			IdRef motionVectors,
+			IdRef majorShapes,
+			IdRef minorShapes,
+			IdRef direction,
+			IdRef pixelResolution,
+			IdRef bidirectionalWeight,
+			IdRef sadAdjustment)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcBmeInitializeINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcBmeInitializeINTEL, 11);
+			generator.writeFixedInstruction(header, idResultType, idResult, srcCoord, motionVectors, majorShapes, minorShapes, direction, pixelResolution, bidirectionalWeight, sadAdjustment);
+		}
+
+		constexpr void OpSubgroupAvcFmeInitializeINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef srcCoord,
+			IdRef motionVectors,
+			IdRef majorShapes,
+			IdRef minorShapes,
+			IdRef direction,
+			IdRef pixelResolution,
+			IdRef sadAdjustment)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcFmeInitializeINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcFmeInitializeINTEL, 10);
+			generator.writeFixedInstruction(header, idResultType, idResult, srcCoord, motionVectors, majorShapes, minorShapes, direction, pixelResolution, sadAdjustment);
+		}
+
+		constexpr void OpSubgroupAvcImeAdjustRefOffsetINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef refOffset,
+			IdRef srcCoord,
+			IdRef refWindowSize,
+			IdRef imageSize)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeAdjustRefOffsetINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeAdjustRefOffsetINTEL, 7);
+			generator.writeFixedInstruction(header, idResultType, idResult, refOffset, srcCoord, refWindowSize, imageSize);
+		}
+
+		constexpr void OpSubgroupAvcImeConvertToMcePayloadINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeConvertToMcePayloadINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeConvertToMcePayloadINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcImeConvertToMceResultINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeConvertToMceResultINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeConvertToMceResultINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcImeEvaluateWithDualReferenceINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef srcImage,
+			IdRef fwdRefImage,
+			IdRef bwdRefImage,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeEvaluateWithDualReferenceINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeEvaluateWithDualReferenceINTEL, 7);
+			generator.writeFixedInstruction(header, idResultType, idResult, srcImage, fwdRefImage, bwdRefImage, payload);
+		}
+
+		constexpr void OpSubgroupAvcImeEvaluateWithDualReferenceStreaminINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef srcImage,
+			IdRef fwdRefImage,
+			IdRef bwdRefImage,
+			IdRef payload,
+			IdRef streaminComponents)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeEvaluateWithDualReferenceStreaminINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeEvaluateWithDualReferenceStreaminINTEL, 8);
+			generator.writeFixedInstruction(header, idResultType, idResult, srcImage, fwdRefImage, bwdRefImage, payload, streaminComponents);
+		}
+
+		constexpr void OpSubgroupAvcImeEvaluateWithDualReferenceStreaminoutINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef srcImage,
+			IdRef fwdRefImage,
+			IdRef bwdRefImage,
+			IdRef payload,
+			IdRef streaminComponents)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeEvaluateWithDualReferenceStreaminoutINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeEvaluateWithDualReferenceStreaminoutINTEL, 8);
+			generator.writeFixedInstruction(header, idResultType, idResult, srcImage, fwdRefImage, bwdRefImage, payload, streaminComponents);
+		}
+
+		constexpr void OpSubgroupAvcImeEvaluateWithDualReferenceStreamoutINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef srcImage,
+			IdRef fwdRefImage,
+			IdRef bwdRefImage,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeEvaluateWithDualReferenceStreamoutINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeEvaluateWithDualReferenceStreamoutINTEL, 7);
+			generator.writeFixedInstruction(header, idResultType, idResult, srcImage, fwdRefImage, bwdRefImage, payload);
+		}
+
+		constexpr void OpSubgroupAvcImeEvaluateWithSingleReferenceINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef srcImage,
+			IdRef refImage,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeEvaluateWithSingleReferenceINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeEvaluateWithSingleReferenceINTEL, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, srcImage, refImage, payload);
+		}
+
+		constexpr void OpSubgroupAvcImeEvaluateWithSingleReferenceStreaminINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef srcImage,
+			IdRef refImage,
+			IdRef payload,
+			IdRef streaminComponents)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeEvaluateWithSingleReferenceStreaminINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeEvaluateWithSingleReferenceStreaminINTEL, 7);
+			generator.writeFixedInstruction(header, idResultType, idResult, srcImage, refImage, payload, streaminComponents);
+		}
+
+		constexpr void OpSubgroupAvcImeEvaluateWithSingleReferenceStreaminoutINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef srcImage,
+			IdRef refImage,
+			IdRef payload,
+			IdRef streaminComponents)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeEvaluateWithSingleReferenceStreaminoutINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeEvaluateWithSingleReferenceStreaminoutINTEL, 7);
+			generator.writeFixedInstruction(header, idResultType, idResult, srcImage, refImage, payload, streaminComponents);
+		}
+
+		constexpr void OpSubgroupAvcImeEvaluateWithSingleReferenceStreamoutINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef srcImage,
+			IdRef refImage,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeEvaluateWithSingleReferenceStreamoutINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeEvaluateWithSingleReferenceStreamoutINTEL, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, srcImage, refImage, payload);
+		}
+
+		constexpr void OpSubgroupAvcImeGetBorderReachedINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef imageSelect,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeGetBorderReachedINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeGetBorderReachedINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, imageSelect, payload);
+		}
+
+		constexpr void OpSubgroupAvcImeGetDualReferenceStreaminINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeGetDualReferenceStreaminINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeGetDualReferenceStreaminINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcImeGetSingleReferenceStreaminINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeGetSingleReferenceStreaminINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeGetSingleReferenceStreaminINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcImeGetStreamoutDualReferenceMajorShapeDistortionsINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload,
+			IdRef majorShape,
+			IdRef direction)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeGetStreamoutDualReferenceMajorShapeDistortionsINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeGetStreamoutDualReferenceMajorShapeDistortionsINTEL, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload, majorShape, direction);
+		}
+
+		constexpr void OpSubgroupAvcImeGetStreamoutDualReferenceMajorShapeMotionVectorsINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload,
+			IdRef majorShape,
+			IdRef direction)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeGetStreamoutDualReferenceMajorShapeMotionVectorsINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeGetStreamoutDualReferenceMajorShapeMotionVectorsINTEL, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload, majorShape, direction);
+		}
+
+		constexpr void OpSubgroupAvcImeGetStreamoutDualReferenceMajorShapeReferenceIdsINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload,
+			IdRef majorShape,
+			IdRef direction)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeGetStreamoutDualReferenceMajorShapeReferenceIdsINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeGetStreamoutDualReferenceMajorShapeReferenceIdsINTEL, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload, majorShape, direction);
+		}
+
+		constexpr void OpSubgroupAvcImeGetStreamoutSingleReferenceMajorShapeDistortionsINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload,
+			IdRef majorShape)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeGetStreamoutSingleReferenceMajorShapeDistortionsINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeGetStreamoutSingleReferenceMajorShapeDistortionsINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload, majorShape);
+		}
+
+		constexpr void OpSubgroupAvcImeGetStreamoutSingleReferenceMajorShapeMotionVectorsINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload,
+			IdRef majorShape)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeGetStreamoutSingleReferenceMajorShapeMotionVectorsINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeGetStreamoutSingleReferenceMajorShapeMotionVectorsINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload, majorShape);
+		}
+
+		constexpr void OpSubgroupAvcImeGetStreamoutSingleReferenceMajorShapeReferenceIdsINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload,
+			IdRef majorShape)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeGetStreamoutSingleReferenceMajorShapeReferenceIdsINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeGetStreamoutSingleReferenceMajorShapeReferenceIdsINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload, majorShape);
+		}
+
+		constexpr void OpSubgroupAvcImeGetTruncatedSearchIndicationINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeGetTruncatedSearchIndicationINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeGetTruncatedSearchIndicationINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcImeGetUnidirectionalEarlySearchTerminationINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeGetUnidirectionalEarlySearchTerminationINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeGetUnidirectionalEarlySearchTerminationINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcImeGetWeightingPatternMinimumDistortionINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeGetWeightingPatternMinimumDistortionINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeGetWeightingPatternMinimumDistortionINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcImeGetWeightingPatternMinimumMotionVectorINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeGetWeightingPatternMinimumMotionVectorINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeGetWeightingPatternMinimumMotionVectorINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcImeInitializeINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef srcCoord,
+			IdRef partitionMask,
+			IdRef sADAdjustment)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeInitializeINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeInitializeINTEL, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, srcCoord, partitionMask, sADAdjustment);
+		}
+
+		constexpr void OpSubgroupAvcImeRefWindowSizeINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef searchWindowConfig,
+			IdRef dualRef)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeRefWindowSizeINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeRefWindowSizeINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, searchWindowConfig, dualRef);
+		}
+
+		constexpr void OpSubgroupAvcImeSetDualReferenceINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef fwdRefOffset,
+			IdRef bwdRefOffset,
+			IdRef idSearchWindowConfig,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeSetDualReferenceINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeSetDualReferenceINTEL, 7);
+			generator.writeFixedInstruction(header, idResultType, idResult, fwdRefOffset, bwdRefOffset, idSearchWindowConfig, payload);
+		}
+
+		constexpr void OpSubgroupAvcImeSetEarlySearchTerminationThresholdINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef threshold,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeSetEarlySearchTerminationThresholdINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeSetEarlySearchTerminationThresholdINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, threshold, payload);
+		}
+
+		constexpr void OpSubgroupAvcImeSetMaxMotionVectorCountINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef maxMotionVectorCount,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeSetMaxMotionVectorCountINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeSetMaxMotionVectorCountINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, maxMotionVectorCount, payload);
+		}
+
+		constexpr void OpSubgroupAvcImeSetSingleReferenceINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef refOffset,
+			IdRef searchWindowConfig,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeSetSingleReferenceINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeSetSingleReferenceINTEL, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, refOffset, searchWindowConfig, payload);
+		}
+
+		constexpr void OpSubgroupAvcImeSetUnidirectionalMixDisableINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeSetUnidirectionalMixDisableINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeSetUnidirectionalMixDisableINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcImeSetWeightedSadINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef packedSadWeights,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeSetWeightedSadINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeSetWeightedSadINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, packedSadWeights, payload);
+		}
+
+		constexpr void OpSubgroupAvcImeStripDualReferenceStreamoutINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeStripDualReferenceStreamoutINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeStripDualReferenceStreamoutINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcImeStripSingleReferenceStreamoutINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcImeStripSingleReferenceStreamoutINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcImeStripSingleReferenceStreamoutINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcMceConvertToImePayloadINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceConvertToImePayloadINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceConvertToImePayloadINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcMceConvertToImeResultINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceConvertToImeResultINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceConvertToImeResultINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcMceConvertToRefPayloadINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceConvertToRefPayloadINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceConvertToRefPayloadINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcMceConvertToRefResultINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceConvertToRefResultINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceConvertToRefResultINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcMceConvertToSicPayloadINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceConvertToSicPayloadINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceConvertToSicPayloadINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcMceConvertToSicResultINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceConvertToSicResultINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceConvertToSicResultINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcMceGetBestInterDistortionsINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceGetBestInterDistortionsINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceGetBestInterDistortionsINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcMceGetDefaultHighPenaltyCostTableINTEL(
+			IdResultType idResultType,
+			IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceGetDefaultHighPenaltyCostTableINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceGetDefaultHighPenaltyCostTableINTEL, 3);
+			generator.writeFixedInstruction(header, idResultType, idResult);
+		}
+
+		constexpr void OpSubgroupAvcMceGetDefaultInterBaseMultiReferencePenaltyINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sliceType,
+			IdRef qp)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceGetDefaultInterBaseMultiReferencePenaltyINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceGetDefaultInterBaseMultiReferencePenaltyINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, sliceType, qp);
+		}
+
+		constexpr void OpSubgroupAvcMceGetDefaultInterDirectionPenaltyINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sliceType,
+			IdRef qp)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceGetDefaultInterDirectionPenaltyINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceGetDefaultInterDirectionPenaltyINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, sliceType, qp);
+		}
+
+		constexpr void OpSubgroupAvcMceGetDefaultInterMotionVectorCostTableINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sliceType,
+			IdRef qp)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceGetDefaultInterMotionVectorCostTableINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceGetDefaultInterMotionVectorCostTableINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, sliceType, qp);
+		}
+
+		constexpr void OpSubgroupAvcMceGetDefaultInterShapePenaltyINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sliceType,
+			IdRef qp)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceGetDefaultInterShapePenaltyINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceGetDefaultInterShapePenaltyINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, sliceType, qp);
+		}
+
+		constexpr void OpSubgroupAvcMceGetDefaultIntraChromaModeBasePenaltyINTEL(
+			IdResultType idResultType,
+			IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceGetDefaultIntraChromaModeBasePenaltyINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceGetDefaultIntraChromaModeBasePenaltyINTEL, 3);
+			generator.writeFixedInstruction(header, idResultType, idResult);
+		}
+
+		constexpr void OpSubgroupAvcMceGetDefaultIntraLumaModePenaltyINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sliceType,
+			IdRef qp)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceGetDefaultIntraLumaModePenaltyINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceGetDefaultIntraLumaModePenaltyINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, sliceType, qp);
+		}
+
+		constexpr void OpSubgroupAvcMceGetDefaultIntraLumaShapePenaltyINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sliceType,
+			IdRef qp)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceGetDefaultIntraLumaShapePenaltyINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceGetDefaultIntraLumaShapePenaltyINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, sliceType, qp);
+		}
+
+		constexpr void OpSubgroupAvcMceGetDefaultLowPenaltyCostTableINTEL(
+			IdResultType idResultType,
+			IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceGetDefaultLowPenaltyCostTableINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceGetDefaultLowPenaltyCostTableINTEL, 3);
+			generator.writeFixedInstruction(header, idResultType, idResult);
+		}
+
+		constexpr void OpSubgroupAvcMceGetDefaultMediumPenaltyCostTableINTEL(
+			IdResultType idResultType,
+			IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceGetDefaultMediumPenaltyCostTableINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceGetDefaultMediumPenaltyCostTableINTEL, 3);
+			generator.writeFixedInstruction(header, idResultType, idResult);
+		}
+
+		constexpr void OpSubgroupAvcMceGetDefaultNonDcLumaIntraPenaltyINTEL(
+			IdResultType idResultType,
+			IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceGetDefaultNonDcLumaIntraPenaltyINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceGetDefaultNonDcLumaIntraPenaltyINTEL, 3);
+			generator.writeFixedInstruction(header, idResultType, idResult);
+		}
+
+		constexpr void OpSubgroupAvcMceGetInterDirectionsINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceGetInterDirectionsINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceGetInterDirectionsINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcMceGetInterDistortionsINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceGetInterDistortionsINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceGetInterDistortionsINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcMceGetInterMajorShapeINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceGetInterMajorShapeINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceGetInterMajorShapeINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcMceGetInterMinorShapeINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceGetInterMinorShapeINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceGetInterMinorShapeINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcMceGetInterMotionVectorCountINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceGetInterMotionVectorCountINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceGetInterMotionVectorCountINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcMceGetInterReferenceIdsINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceGetInterReferenceIdsINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceGetInterReferenceIdsINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcMceGetInterReferenceInterlacedFieldPolaritiesINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef packedReferenceIds,
+			IdRef packedReferenceParameterFieldPolarities,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceGetInterReferenceInterlacedFieldPolaritiesINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceGetInterReferenceInterlacedFieldPolaritiesINTEL, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, packedReferenceIds, packedReferenceParameterFieldPolarities, payload);
+		}
+
+		constexpr void OpSubgroupAvcMceGetMotionVectorsINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceGetMotionVectorsINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceGetMotionVectorsINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcMceSetAcOnlyHaarINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceSetAcOnlyHaarINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceSetAcOnlyHaarINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcMceSetDualReferenceInterlacedFieldPolaritiesINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef forwardReferenceFieldPolarity,
+			IdRef backwardReferenceFieldPolarity,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceSetDualReferenceInterlacedFieldPolaritiesINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceSetDualReferenceInterlacedFieldPolaritiesINTEL, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, forwardReferenceFieldPolarity, backwardReferenceFieldPolarity, payload);
+		}
+
+		constexpr void OpSubgroupAvcMceSetInterBaseMultiReferencePenaltyINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef referenceBasePenalty,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceSetInterBaseMultiReferencePenaltyINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceSetInterBaseMultiReferencePenaltyINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, referenceBasePenalty, payload);
+		}
+
+		constexpr void OpSubgroupAvcMceSetInterDirectionPenaltyINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef directionCost,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceSetInterDirectionPenaltyINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceSetInterDirectionPenaltyINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, directionCost, payload);
+		}
+
+		constexpr void OpSubgroupAvcMceSetInterShapePenaltyINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef packedShapePenalty,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceSetInterShapePenaltyINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceSetInterShapePenaltyINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, packedShapePenalty, payload);
+		}
+
+		constexpr void OpSubgroupAvcMceSetMotionVectorCostFunctionINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef packedCostCenterDelta,
+			IdRef packedCostTable,
+			IdRef costPrecision,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceSetMotionVectorCostFunctionINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceSetMotionVectorCostFunctionINTEL, 7);
+			generator.writeFixedInstruction(header, idResultType, idResult, packedCostCenterDelta, packedCostTable, costPrecision, payload);
+		}
+
+		constexpr void OpSubgroupAvcMceSetSingleReferenceInterlacedFieldPolarityINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef referenceFieldPolarity,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceSetSingleReferenceInterlacedFieldPolarityINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceSetSingleReferenceInterlacedFieldPolarityINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, referenceFieldPolarity, payload);
+		}
+
+		constexpr void OpSubgroupAvcMceSetSourceInterlacedFieldPolarityINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sourceFieldPolarity,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcMceSetSourceInterlacedFieldPolarityINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcMceSetSourceInterlacedFieldPolarityINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, sourceFieldPolarity, payload);
+		}
+
+		constexpr void OpSubgroupAvcRefConvertToMcePayloadINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcRefConvertToMcePayloadINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcRefConvertToMcePayloadINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcRefConvertToMceResultINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcRefConvertToMceResultINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcRefConvertToMceResultINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcRefEvaluateWithDualReferenceINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef srcImage,
+			IdRef fwdRefImage,
+			IdRef bwdRefImage,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcRefEvaluateWithDualReferenceINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcRefEvaluateWithDualReferenceINTEL, 7);
+			generator.writeFixedInstruction(header, idResultType, idResult, srcImage, fwdRefImage, bwdRefImage, payload);
+		}
+
+		constexpr void OpSubgroupAvcRefEvaluateWithMultiReferenceINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef srcImage,
+			IdRef packedReferenceIds,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcRefEvaluateWithMultiReferenceINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcRefEvaluateWithMultiReferenceINTEL, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, srcImage, packedReferenceIds, payload);
+		}
+
+		constexpr void OpSubgroupAvcRefEvaluateWithMultiReferenceInterlacedINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef srcImage,
+			IdRef packedReferenceIds,
+			IdRef packedReferenceFieldPolarities,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcRefEvaluateWithMultiReferenceInterlacedINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcRefEvaluateWithMultiReferenceInterlacedINTEL, 7);
+			generator.writeFixedInstruction(header, idResultType, idResult, srcImage, packedReferenceIds, packedReferenceFieldPolarities, payload);
+		}
+
+		constexpr void OpSubgroupAvcRefEvaluateWithSingleReferenceINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef srcImage,
+			IdRef refImage,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcRefEvaluateWithSingleReferenceINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcRefEvaluateWithSingleReferenceINTEL, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, srcImage, refImage, payload);
+		}
+
+		constexpr void OpSubgroupAvcRefSetBidirectionalMixDisableINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcRefSetBidirectionalMixDisableINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcRefSetBidirectionalMixDisableINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcRefSetBilinearFilterEnableINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcRefSetBilinearFilterEnableINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcRefSetBilinearFilterEnableINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcSicConfigureIpeLumaChromaINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef lumaIntraPartitionMask,
+			IdRef intraNeighbourAvailabilty,
+			IdRef leftEdgeLumaPixels,
+			IdRef upperLeftCornerLumaPixel,
+			IdRef upperEdgeLumaPixels,
+			IdRef upperRightEdgeLumaPixels,
+			IdRef leftEdgeChromaPixels,
+			IdRef upperLeftCornerChromaPixel,
+			IdRef upperEdgeChromaPixels,
+			IdRef sadAdjustment,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicConfigureIpeLumaChromaINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicConfigureIpeLumaChromaINTEL, 14);
+			generator.writeFixedInstruction(header, idResultType, idResult, lumaIntraPartitionMask, intraNeighbourAvailabilty, leftEdgeLumaPixels, upperLeftCornerLumaPixel, upperEdgeLumaPixels, upperRightEdgeLumaPixels, leftEdgeChromaPixels, upperLeftCornerChromaPixel, upperEdgeChromaPixels, sadAdjustment, payload);
+		}
+
+		constexpr void OpSubgroupAvcSicConfigureIpeLumaINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef lumaIntraPartitionMask,
+			IdRef intraNeighbourAvailabilty,
+			IdRef leftEdgeLumaPixels,
+			IdRef upperLeftCornerLumaPixel,
+			IdRef upperEdgeLumaPixels,
+			IdRef upperRightEdgeLumaPixels,
+			IdRef sadAdjustment,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicConfigureIpeLumaINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicConfigureIpeLumaINTEL, 11);
+			generator.writeFixedInstruction(header, idResultType, idResult, lumaIntraPartitionMask, intraNeighbourAvailabilty, leftEdgeLumaPixels, upperLeftCornerLumaPixel, upperEdgeLumaPixels, upperRightEdgeLumaPixels, sadAdjustment, payload);
+		}
+
+		constexpr void OpSubgroupAvcSicConfigureSkcINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef skipBlockPartitionType,
+			IdRef skipMotionVectorMask,
+			IdRef motionVectors,
+			IdRef bidirectionalWeight,
+			IdRef sadAdjustment,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicConfigureSkcINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicConfigureSkcINTEL, 9);
+			generator.writeFixedInstruction(header, idResultType, idResult, skipBlockPartitionType, skipMotionVectorMask, motionVectors, bidirectionalWeight, sadAdjustment, payload);
+		}
+
+		constexpr void OpSubgroupAvcSicConvertToMcePayloadINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicConvertToMcePayloadINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicConvertToMcePayloadINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcSicConvertToMceResultINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicConvertToMceResultINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicConvertToMceResultINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcSicEvaluateIpeINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef srcImage,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicEvaluateIpeINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicEvaluateIpeINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, srcImage, payload);
+		}
+
+		constexpr void OpSubgroupAvcSicEvaluateWithDualReferenceINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef srcImage,
+			IdRef fwdRefImage,
+			IdRef bwdRefImage,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicEvaluateWithDualReferenceINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicEvaluateWithDualReferenceINTEL, 7);
+			generator.writeFixedInstruction(header, idResultType, idResult, srcImage, fwdRefImage, bwdRefImage, payload);
+		}
+
+		constexpr void OpSubgroupAvcSicEvaluateWithMultiReferenceINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef srcImage,
+			IdRef packedReferenceIds,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicEvaluateWithMultiReferenceINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicEvaluateWithMultiReferenceINTEL, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, srcImage, packedReferenceIds, payload);
+		}
+
+		constexpr void OpSubgroupAvcSicEvaluateWithMultiReferenceInterlacedINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef srcImage,
+			IdRef packedReferenceIds,
+			IdRef packedReferenceFieldPolarities,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicEvaluateWithMultiReferenceInterlacedINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicEvaluateWithMultiReferenceInterlacedINTEL, 7);
+			generator.writeFixedInstruction(header, idResultType, idResult, srcImage, packedReferenceIds, packedReferenceFieldPolarities, payload);
+		}
+
+		constexpr void OpSubgroupAvcSicEvaluateWithSingleReferenceINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef srcImage,
+			IdRef refImage,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicEvaluateWithSingleReferenceINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicEvaluateWithSingleReferenceINTEL, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, srcImage, refImage, payload);
+		}
+
+		constexpr void OpSubgroupAvcSicGetBestIpeChromaDistortionINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicGetBestIpeChromaDistortionINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicGetBestIpeChromaDistortionINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcSicGetBestIpeLumaDistortionINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicGetBestIpeLumaDistortionINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicGetBestIpeLumaDistortionINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcSicGetInterRawSadsINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicGetInterRawSadsINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicGetInterRawSadsINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcSicGetIpeChromaModeINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicGetIpeChromaModeINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicGetIpeChromaModeINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcSicGetIpeLumaShapeINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicGetIpeLumaShapeINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicGetIpeLumaShapeINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcSicGetMotionVectorMaskINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef skipBlockPartitionType,
+			IdRef direction)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicGetMotionVectorMaskINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicGetMotionVectorMaskINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, skipBlockPartitionType, direction);
+		}
+
+		constexpr void OpSubgroupAvcSicGetPackedIpeLumaModesINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicGetPackedIpeLumaModesINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicGetPackedIpeLumaModesINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcSicGetPackedSkcLumaCountThresholdINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicGetPackedSkcLumaCountThresholdINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicGetPackedSkcLumaCountThresholdINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcSicGetPackedSkcLumaSumThresholdINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicGetPackedSkcLumaSumThresholdINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicGetPackedSkcLumaSumThresholdINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcSicInitializeINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef srcCoord)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicInitializeINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicInitializeINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, srcCoord);
+		}
+
+		constexpr void OpSubgroupAvcSicSetBilinearFilterEnableINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicSetBilinearFilterEnableINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicSetBilinearFilterEnableINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, payload);
+		}
+
+		constexpr void OpSubgroupAvcSicSetBlockBasedRawSkipSadINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef blockBasedSkipType,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicSetBlockBasedRawSkipSadINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicSetBlockBasedRawSkipSadINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, blockBasedSkipType, payload);
+		}
+
+		constexpr void OpSubgroupAvcSicSetIntraChromaModeCostFunctionINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef chromaModeBasePenalty,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicSetIntraChromaModeCostFunctionINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicSetIntraChromaModeCostFunctionINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, chromaModeBasePenalty, payload);
+		}
+
+		constexpr void OpSubgroupAvcSicSetIntraLumaModeCostFunctionINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef lumaModePenalty,
+			IdRef lumaPackedNeighborModes,
+			IdRef lumaPackedNonDcPenalty,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicSetIntraLumaModeCostFunctionINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicSetIntraLumaModeCostFunctionINTEL, 7);
+			generator.writeFixedInstruction(header, idResultType, idResult, lumaModePenalty, lumaPackedNeighborModes, lumaPackedNonDcPenalty, payload);
+		}
+
+		constexpr void OpSubgroupAvcSicSetIntraLumaShapePenaltyINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef packedShapePenalty,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicSetIntraLumaShapePenaltyINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicSetIntraLumaShapePenaltyINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, packedShapePenalty, payload);
+		}
+
+		constexpr void OpSubgroupAvcSicSetSkcForwardTransformEnableINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef packedSadCoefficients,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAvcSicSetSkcForwardTransformEnableINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAvcSicSetSkcForwardTransformEnableINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, packedSadCoefficients, payload);
+		}
+
+		constexpr void OpSubgroupBlockPrefetchINTEL(
+			IdRef ptr,
+			IdRef numBytes,
+			std::optional<spv::MemoryAccessMask> memoryAccess = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupBlockPrefetchINTEL);
+
+			size_t wordCount = 3;
+			countOperandsWord(wordCount, memoryAccess);
+
+			generator.writeInstruction(spv::Op::OpSubgroupBlockPrefetchINTEL, wordCount, ptr, numBytes, memoryAccess);
+		}
+
+		constexpr void OpSubgroupBlockReadINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef ptr)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupBlockReadINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupBlockReadINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, ptr);
+		}
+
+		constexpr void OpSubgroupBlockWriteINTEL(
+			IdRef ptr,
+			IdRef data)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupBlockWriteINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupBlockWriteINTEL, 3);
+			generator.writeFixedInstruction(header, ptr, data);
+		}
+
+		constexpr void OpSubgroupImageBlockReadINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef image,
+			IdRef coordinate)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupImageBlockReadINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupImageBlockReadINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, image, coordinate);
+		}
+
+		constexpr void OpSubgroupImageBlockWriteINTEL(
+			IdRef image,
+			IdRef coordinate,
+			IdRef data)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupImageBlockWriteINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupImageBlockWriteINTEL, 4);
+			generator.writeFixedInstruction(header, image, coordinate, data);
+		}
+
+		constexpr void OpSubgroupImageMediaBlockReadINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef image,
+			IdRef coordinate,
+			IdRef width,
+			IdRef height)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupImageMediaBlockReadINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupImageMediaBlockReadINTEL, 7);
+			generator.writeFixedInstruction(header, idResultType, idResult, image, coordinate, width, height);
+		}
+
+		constexpr void OpSubgroupImageMediaBlockWriteINTEL(
+			IdRef image,
+			IdRef coordinate,
+			IdRef width,
+			IdRef height,
+			IdRef data)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupImageMediaBlockWriteINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupImageMediaBlockWriteINTEL, 6);
+			generator.writeFixedInstruction(header, image, coordinate, width, height, data);
+		}
+
+		constexpr void OpSubgroupMatrixMultiplyAccumulateINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef kDim,
+			IdRef matrixA,
+			IdRef matrixB,
+			IdRef matrixC,
+			std::optional<spv::MatrixMultiplyAccumulateOperandsMask> matrixMultiplyAccumulateOperands = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupMatrixMultiplyAccumulateINTEL);
+
+			size_t wordCount = 7;
+			countOperandsWord(wordCount, matrixMultiplyAccumulateOperands);
+
+			generator.writeInstruction(spv::Op::OpSubgroupMatrixMultiplyAccumulateINTEL, wordCount, idResultType, idResult, kDim, matrixA, matrixB, matrixC, matrixMultiplyAccumulateOperands);
+		}
+
+		constexpr void OpSubgroupShuffleDownINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef current,
+			IdRef next,
+			IdRef delta)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupShuffleDownINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupShuffleDownINTEL, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, current, next, delta);
+		}
+
+		constexpr void OpSubgroupShuffleINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef data,
+			IdRef invocationId)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupShuffleINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupShuffleINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, data, invocationId);
+		}
+
+		constexpr void OpSubgroupShuffleUpINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef previous,
+			IdRef current,
+			IdRef delta)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupShuffleUpINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupShuffleUpINTEL, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, previous, current, delta);
+		}
+
+		constexpr void OpSubgroupShuffleXorINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef data,
+			IdRef value)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupShuffleXorINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupShuffleXorINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, data, value);
+		}
+
+		constexpr void OpTaskSequenceAsyncINTEL(
+			IdRef sequence,
+			OperandList<IdRef> arguments = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTaskSequenceAsyncINTEL);
+
+			size_t wordCount = 2;
+			countOperandsWord(wordCount, arguments);
+
+			generator.writeInstruction(spv::Op::OpTaskSequenceAsyncINTEL, wordCount, sequence, arguments);
+		}
+
+		constexpr InstructionBuilder<TGenerator, IdRef> beginOpTaskSequenceAsyncINTEL(IdRef sequence)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			generator.beginInstruction(sequence);
+			return {generator, spv::Op::OpTaskSequenceAsyncINTEL};
+		}
+
+		constexpr void OpTaskSequenceCreateINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef function,
+			uint32_t pipelined,
+			uint32_t useStallEnableClusters,
+			uint32_t getCapacity,
+			uint32_t asyncCapacity)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTaskSequenceCreateINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTaskSequenceCreateINTEL, 8);
+			generator.writeFixedInstruction(header, idResultType, idResult, function, pipelined, useStallEnableClusters, getCapacity, asyncCapacity);
+		}
+
+		constexpr void OpTaskSequenceGetINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sequence)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTaskSequenceGetINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTaskSequenceGetINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, sequence);
+		}
+
+		constexpr void OpTaskSequenceReleaseINTEL(IdRef sequence)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTaskSequenceReleaseINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTaskSequenceReleaseINTEL, 2);
+			generator.writeFixedInstruction(header, sequence);
+		}
+
+		constexpr void OpTypeAvcImeDualReferenceStreaminINTEL(IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeAvcImeDualReferenceStreaminINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeAvcImeDualReferenceStreaminINTEL, 2);
+			generator.writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpTypeAvcImePayloadINTEL(IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeAvcImePayloadINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeAvcImePayloadINTEL, 2);
+			generator.writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpTypeAvcImeResultDualReferenceStreamoutINTEL(IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeAvcImeResultDualReferenceStreamoutINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeAvcImeResultDualReferenceStreamoutINTEL, 2);
+			generator.writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpTypeAvcImeResultINTEL(IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeAvcImeResultINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeAvcImeResultINTEL, 2);
+			generator.writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpTypeAvcImeResultSingleReferenceStreamoutINTEL(IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeAvcImeResultSingleReferenceStreamoutINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeAvcImeResultSingleReferenceStreamoutINTEL, 2);
+			generator.writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpTypeAvcImeSingleReferenceStreaminINTEL(IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeAvcImeSingleReferenceStreaminINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeAvcImeSingleReferenceStreaminINTEL, 2);
+			generator.writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpTypeAvcMcePayloadINTEL(IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeAvcMcePayloadINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeAvcMcePayloadINTEL, 2);
+			generator.writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpTypeAvcMceResultINTEL(IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeAvcMceResultINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeAvcMceResultINTEL, 2);
+			generator.writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpTypeAvcRefPayloadINTEL(IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeAvcRefPayloadINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeAvcRefPayloadINTEL, 2);
+			generator.writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpTypeAvcRefResultINTEL(IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeAvcRefResultINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeAvcRefResultINTEL, 2);
+			generator.writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpTypeAvcSicPayloadINTEL(IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeAvcSicPayloadINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeAvcSicPayloadINTEL, 2);
+			generator.writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpTypeAvcSicResultINTEL(IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeAvcSicResultINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeAvcSicResultINTEL, 2);
+			generator.writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpTypeBufferSurfaceINTEL(
+			IdResult idResult,
+			spv::AccessQualifier accessQualifier)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeBufferSurfaceINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeBufferSurfaceINTEL, 3);
+			generator.writeFixedInstruction(header, idResult, static_cast<uint32_t>(accessQualifier));
+		}
+
+		constexpr void OpTypeStructContinuedINTEL(OperandList<IdRef> memberTypes = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeStructContinuedINTEL);
+
+			size_t wordCount = 1;
+			countOperandsWord(wordCount, memberTypes);
+
+			generator.writeInstruction(spv::Op::OpTypeStructContinuedINTEL, wordCount, memberTypes);
+		}
+
+		constexpr InstructionBuilder<TGenerator, IdRef> beginOpTypeStructContinuedINTEL()
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			generator.beginInstruction();
+			return {generator, spv::Op::OpTypeStructContinuedINTEL};
+		}
+
+		constexpr void OpTypeTaskSequenceINTEL(IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeTaskSequenceINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeTaskSequenceINTEL, 2);
+			generator.writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpTypeVmeImageINTEL(
+			IdResult idResult,
+			IdRef imageType)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeVmeImageINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeVmeImageINTEL, 3);
+			generator.writeFixedInstruction(header, idResult, imageType);
+		}
+
+		constexpr void OpUAddSatINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpUAddSatINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpUAddSatINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpUAverageINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpUAverageINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpUAverageINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpUAverageRoundedINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpUAverageRoundedINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpUAverageRoundedINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpUCountLeadingZerosINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpUCountLeadingZerosINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpUCountLeadingZerosINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, operand);
+		}
+
+		constexpr void OpUCountTrailingZerosINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpUCountTrailingZerosINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpUCountTrailingZerosINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, operand);
+		}
+
+		constexpr void OpUMul32x16INTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpUMul32x16INTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpUMul32x16INTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpUSubSatINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand1,
+			IdRef operand2)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpUSubSatINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpUSubSatINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, operand1, operand2);
+		}
+
+		constexpr void OpVariableLengthArrayINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef lenght)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpVariableLengthArrayINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpVariableLengthArrayINTEL, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, lenght);
+		}
+
+		constexpr void OpVmeImageINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef imageType,
+			IdRef sampler)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpVmeImageINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpVmeImageINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, imageType, sampler);
+		}
+
+		constexpr void OpWritePipeBlockingINTEL(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef packetSize,
+			IdRef packetAlignment)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpWritePipeBlockingINTEL);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpWritePipeBlockingINTEL, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, packetSize, packetAlignment);
+		}
+	};
+} // namespace dynspv
\ No newline at end of file
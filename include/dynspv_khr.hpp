@@ -0,0 +1,1003 @@
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include <dynspv_base.hpp>
+
+namespace dynspv
+{
+	// Instructions with the KHR suffix, mixed into generators listing it in their InstructionSets
+	template<typename TGenerator>
+	class KhrInstructions
+	{
+	  public:
+		constexpr void OpAssumeTrueKHR(IdRef condition)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpAssumeTrueKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpAssumeTrueKHR, 2);
+			generator.writeFixedInstruction(header, condition);
+		}
+
+		constexpr void OpConvertUToAccelerationStructureKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef accel)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpConvertUToAccelerationStructureKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpConvertUToAccelerationStructureKHR, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, accel);
+		}
+
+		constexpr void OpCooperativeMatrixLengthKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef type)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpCooperativeMatrixLengthKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpCooperativeMatrixLengthKHR, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, type);
+		}
+
+		constexpr void OpCooperativeMatrixLoadKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer,
+			IdRef memoryLayout,
+			std::optional<IdRef> stride = {},
+			std::optional<spv::MemoryAccessMask> memoryOperand = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpCooperativeMatrixLoadKHR);
+
+			size_t wordCount = 5;
+			countOperandsWord(wordCount, stride, memoryOperand);
+
+			generator.writeInstruction(spv::Op::OpCooperativeMatrixLoadKHR, wordCount, idResultType, idResult, pointer, memoryLayout, stride, memoryOperand);
+		}
+
+		constexpr void OpCooperativeMatrixMulAddKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			IdRef B,
+			IdRef C,
+			std::optional<spv::CooperativeMatrixOperandsMask> cooperativeMatrixOperands = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpCooperativeMatrixMulAddKHR);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, cooperativeMatrixOperands);
+
+			generator.writeInstruction(spv::Op::OpCooperativeMatrixMulAddKHR, wordCount, idResultType, idResult, A, B, C, cooperativeMatrixOperands);
+		}
+
+		constexpr void OpCooperativeMatrixStoreKHR(
+			IdRef pointer,
+			IdRef object,
+			IdRef memoryLayout,
+			std::optional<IdRef> stride = {},
+			std::optional<spv::MemoryAccessMask> memoryOperand = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpCooperativeMatrixStoreKHR);
+
+			size_t wordCount = 4;
+			countOperandsWord(wordCount, stride, memoryOperand);
+
+			generator.writeInstruction(spv::Op::OpCooperativeMatrixStoreKHR, wordCount, pointer, object, memoryLayout, stride, memoryOperand);
+		}
+
+		constexpr void OpExecuteCallableKHR(
+			IdRef sBTIndex,
+			IdRef callableData)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpExecuteCallableKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpExecuteCallableKHR, 3);
+			generator.writeFixedInstruction(header, sBTIndex, callableData);
+		}
+
+		constexpr void OpExpectKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef value,
+			IdRef expectedValue)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpExpectKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpExpectKHR, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, value, expectedValue);
+		}
+
+		constexpr void OpExtInstWithForwardRefsKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef set,
+			uint32_t instruction,
+			OperandList<IdRef> operands = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			if (generator.getStripDebugInfo() && generator.isStrippedExtInstSet(set))
+			{
+				return;
+			}
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpExtInstWithForwardRefsKHR);
+
+			size_t wordCount = 5;
+			countOperandsWord(wordCount, operands);
+
+			generator.writeInstruction(spv::Op::OpExtInstWithForwardRefsKHR, wordCount, idResultType, idResult, set, instruction, operands);
+		}
+
+		constexpr void OpGroupBitwiseAndKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef X)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpGroupBitwiseAndKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupBitwiseAndKHR, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, execution, static_cast<uint32_t>(operation), X);
+		}
+
+		constexpr void OpGroupBitwiseOrKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef X)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpGroupBitwiseOrKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupBitwiseOrKHR, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, execution, static_cast<uint32_t>(operation), X);
+		}
+
+		constexpr void OpGroupBitwiseXorKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef X)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpGroupBitwiseXorKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupBitwiseXorKHR, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, execution, static_cast<uint32_t>(operation), X);
+		}
+
+		constexpr void OpGroupFMulKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef X)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpGroupFMulKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupFMulKHR, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, execution, static_cast<uint32_t>(operation), X);
+		}
+
+		constexpr void OpGroupIMulKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef X)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpGroupIMulKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupIMulKHR, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, execution, static_cast<uint32_t>(operation), X);
+		}
+
+		constexpr void OpGroupLogicalAndKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef X)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpGroupLogicalAndKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupLogicalAndKHR, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, execution, static_cast<uint32_t>(operation), X);
+		}
+
+		constexpr void OpGroupLogicalOrKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef X)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpGroupLogicalOrKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupLogicalOrKHR, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, execution, static_cast<uint32_t>(operation), X);
+		}
+
+		constexpr void OpGroupLogicalXorKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			spv::GroupOperation operation,
+			IdRef X)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpGroupLogicalXorKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupLogicalXorKHR, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, execution, static_cast<uint32_t>(operation), X);
+		}
+
+		constexpr void OpGroupNonUniformQuadAllKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef predicate)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpGroupNonUniformQuadAllKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupNonUniformQuadAllKHR, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, predicate);
+		}
+
+		constexpr void OpGroupNonUniformQuadAnyKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef predicate)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpGroupNonUniformQuadAnyKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupNonUniformQuadAnyKHR, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, predicate);
+		}
+
+		constexpr void OpGroupNonUniformRotateKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope execution,
+			IdRef value,
+			IdRef delta,
+			std::optional<IdRef> clusterSize = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpGroupNonUniformRotateKHR);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, clusterSize);
+
+			generator.writeInstruction(spv::Op::OpGroupNonUniformRotateKHR, wordCount, idResultType, idResult, execution, value, delta, clusterSize);
+		}
+
+		constexpr void OpIgnoreIntersectionKHR()
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpIgnoreIntersectionKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpIgnoreIntersectionKHR, 1);
+			generator.writeFixedInstruction(header);
+		}
+
+		constexpr void OpRayQueryConfirmIntersectionKHR(IdRef rayQuery)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryConfirmIntersectionKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryConfirmIntersectionKHR, 2);
+			generator.writeFixedInstruction(header, rayQuery);
+		}
+
+		constexpr void OpRayQueryGenerateIntersectionKHR(
+			IdRef rayQuery,
+			IdRef hitT)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGenerateIntersectionKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGenerateIntersectionKHR, 3);
+			generator.writeFixedInstruction(header, rayQuery, hitT);
+		}
+
+		constexpr void OpRayQueryGetIntersectionBarycentricsKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery,
+			IdRef intersection)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGetIntersectionBarycentricsKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGetIntersectionBarycentricsKHR, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery, intersection);
+		}
+
+		constexpr void OpRayQueryGetIntersectionCandidateAABBOpaqueKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGetIntersectionCandidateAABBOpaqueKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGetIntersectionCandidateAABBOpaqueKHR, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery);
+		}
+
+		constexpr void OpRayQueryGetIntersectionFrontFaceKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery,
+			IdRef intersection)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGetIntersectionFrontFaceKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGetIntersectionFrontFaceKHR, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery, intersection);
+		}
+
+		constexpr void OpRayQueryGetIntersectionGeometryIndexKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery,
+			IdRef intersection)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGetIntersectionGeometryIndexKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGetIntersectionGeometryIndexKHR, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery, intersection);
+		}
+
+		constexpr void OpRayQueryGetIntersectionInstanceCustomIndexKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery,
+			IdRef intersection)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGetIntersectionInstanceCustomIndexKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGetIntersectionInstanceCustomIndexKHR, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery, intersection);
+		}
+
+		constexpr void OpRayQueryGetIntersectionInstanceIdKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery,
+			IdRef intersection)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGetIntersectionInstanceIdKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGetIntersectionInstanceIdKHR, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery, intersection);
+		}
+
+		constexpr void OpRayQueryGetIntersectionInstanceShaderBindingTableRecordOffsetKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery,
+			IdRef intersection)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGetIntersectionInstanceShaderBindingTableRecordOffsetKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGetIntersectionInstanceShaderBindingTableRecordOffsetKHR, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery, intersection);
+		}
+
+		constexpr void OpRayQueryGetIntersectionObjectRayDirectionKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery,
+			IdRef intersection)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGetIntersectionObjectRayDirectionKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGetIntersectionObjectRayDirectionKHR, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery, intersection);
+		}
+
+		constexpr void OpRayQueryGetIntersectionObjectRayOriginKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery,
+			IdRef intersection)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGetIntersectionObjectRayOriginKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGetIntersectionObjectRayOriginKHR, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery, intersection);
+		}
+
+		constexpr void OpRayQueryGetIntersectionObjectToWorldKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery,
+			IdRef intersection)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGetIntersectionObjectToWorldKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGetIntersectionObjectToWorldKHR, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery, intersection);
+		}
+
+		constexpr void OpRayQueryGetIntersectionPrimitiveIndexKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery,
+			IdRef intersection)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGetIntersectionPrimitiveIndexKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGetIntersectionPrimitiveIndexKHR, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery, intersection);
+		}
+
+		constexpr void OpRayQueryGetIntersectionTKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery,
+			IdRef intersection)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGetIntersectionTKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGetIntersectionTKHR, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery, intersection);
+		}
+
+		constexpr void OpRayQueryGetIntersectionTriangleVertexPositionsKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery,
+			IdRef intersection)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGetIntersectionTriangleVertexPositionsKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGetIntersectionTriangleVertexPositionsKHR, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery, intersection);
+		}
+
+		constexpr void OpRayQueryGetIntersectionTypeKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery,
+			IdRef intersection)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGetIntersectionTypeKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGetIntersectionTypeKHR, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery, intersection);
+		}
+
+		constexpr void OpRayQueryGetIntersectionWorldToObjectKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery,
+			IdRef intersection)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGetIntersectionWorldToObjectKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGetIntersectionWorldToObjectKHR, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery, intersection);
+		}
+
+		constexpr void OpRayQueryGetRayFlagsKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGetRayFlagsKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGetRayFlagsKHR, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery);
+		}
+
+		constexpr void OpRayQueryGetRayTMinKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGetRayTMinKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGetRayTMinKHR, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery);
+		}
+
+		constexpr void OpRayQueryGetWorldRayDirectionKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGetWorldRayDirectionKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGetWorldRayDirectionKHR, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery);
+		}
+
+		constexpr void OpRayQueryGetWorldRayOriginKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGetWorldRayOriginKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGetWorldRayOriginKHR, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery);
+		}
+
+		constexpr void OpRayQueryInitializeKHR(
+			IdRef rayQuery,
+			IdRef accel,
+			IdRef rayFlags,
+			IdRef cullMask,
+			IdRef rayOrigin,
+			IdRef rayTMin,
+			IdRef rayDirection,
+			IdRef rayTMax)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryInitializeKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryInitializeKHR, 9);
+			generator.writeFixedInstruction(header, rayQuery, accel, rayFlags, cullMask, rayOrigin, rayTMin, rayDirection, rayTMax);
+		}
+
+		constexpr void OpRayQueryProceedKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryProceedKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryProceedKHR, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery);
+		}
+
+		constexpr void OpRayQueryTerminateKHR(IdRef rayQuery)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryTerminateKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryTerminateKHR, 2);
+			generator.writeFixedInstruction(header, rayQuery);
+		}
+
+		constexpr void OpReadClockKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdScope scope)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpReadClockKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpReadClockKHR, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, scope);
+		}
+
+		constexpr void OpReportIntersectionKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hit,
+			IdRef hitKind)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpReportIntersectionKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpReportIntersectionKHR, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, hit, hitKind);
+		}
+
+		constexpr void OpSubgroupAllEqualKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef predicate)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAllEqualKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAllEqualKHR, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, predicate);
+		}
+
+		constexpr void OpSubgroupAllKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef predicate)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAllKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAllKHR, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, predicate);
+		}
+
+		constexpr void OpSubgroupAnyKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef predicate)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupAnyKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupAnyKHR, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, predicate);
+		}
+
+		constexpr void OpSubgroupBallotKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef predicate)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupBallotKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupBallotKHR, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, predicate);
+		}
+
+		constexpr void OpSubgroupFirstInvocationKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef value)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupFirstInvocationKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupFirstInvocationKHR, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, value);
+		}
+
+		constexpr void OpSubgroupReadInvocationKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef value,
+			IdRef index)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSubgroupReadInvocationKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSubgroupReadInvocationKHR, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, value, index);
+		}
+
+		constexpr void OpTerminateRayKHR()
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTerminateRayKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTerminateRayKHR, 1);
+			generator.writeFixedInstruction(header);
+		}
+
+		constexpr void OpTraceRayKHR(
+			IdRef accel,
+			IdRef rayFlags,
+			IdRef cullMask,
+			IdRef sBTOffset,
+			IdRef sBTStride,
+			IdRef missIndex,
+			IdRef rayOrigin,
+			IdRef rayTmin,
+			IdRef rayDirection,
+			IdRef rayTmax,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTraceRayKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTraceRayKHR, 12);
+			generator.writeFixedInstruction(header, accel, rayFlags, cullMask, sBTOffset, sBTStride, missIndex, rayOrigin, rayTmin, rayDirection, rayTmax, payload);
+		}
+
+		constexpr void OpTypeAccelerationStructureKHR(IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeAccelerationStructureKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeAccelerationStructureKHR, 2);
+			generator.writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpTypeCooperativeMatrixKHR(
+			IdResult idResult,
+			IdRef componentType,
+			IdScope scope,
+			IdRef rows,
+			IdRef columns,
+			IdRef use)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeCooperativeMatrixKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeCooperativeMatrixKHR, 7);
+			generator.writeFixedInstruction(header, idResult, componentType, scope, rows, columns, use);
+		}
+
+		constexpr void OpTypeRayQueryKHR(IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeRayQueryKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeRayQueryKHR, 2);
+			generator.writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpTypeUntypedPointerKHR(
+			IdResult idResult,
+			spv::StorageClass storageClass)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeUntypedPointerKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeUntypedPointerKHR, 3);
+			generator.writeFixedInstruction(header, idResult, static_cast<uint32_t>(storageClass));
+		}
+
+		constexpr void OpUntypedAccessChainKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef baseType,
+			IdRef base,
+			OperandList<IdRef> indexes = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpUntypedAccessChainKHR);
+
+			size_t wordCount = 5;
+			countOperandsWord(wordCount, indexes);
+
+			generator.writeInstruction(spv::Op::OpUntypedAccessChainKHR, wordCount, idResultType, idResult, baseType, base, indexes);
+		}
+
+		constexpr InstructionBuilder<TGenerator, IdRef> beginOpUntypedAccessChainKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef baseType,
+			IdRef base)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			generator.beginInstruction(idResultType, idResult, baseType, base);
+			return {generator, spv::Op::OpUntypedAccessChainKHR};
+		}
+
+		constexpr void OpUntypedArrayLengthKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef structure,
+			IdRef pointer,
+			uint32_t arrayMember)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpUntypedArrayLengthKHR);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpUntypedArrayLengthKHR, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, structure, pointer, arrayMember);
+		}
+
+		constexpr void OpUntypedInBoundsAccessChainKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef baseType,
+			IdRef base,
+			OperandList<IdRef> indexes = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpUntypedInBoundsAccessChainKHR);
+
+			size_t wordCount = 5;
+			countOperandsWord(wordCount, indexes);
+
+			generator.writeInstruction(spv::Op::OpUntypedInBoundsAccessChainKHR, wordCount, idResultType, idResult, baseType, base, indexes);
+		}
+
+		constexpr InstructionBuilder<TGenerator, IdRef> beginOpUntypedInBoundsAccessChainKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef baseType,
+			IdRef base)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			generator.beginInstruction(idResultType, idResult, baseType, base);
+			return {generator, spv::Op::OpUntypedInBoundsAccessChainKHR};
+		}
+
+		constexpr void OpUntypedInBoundsPtrAccessChainKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef baseType,
+			IdRef base,
+			IdRef element,
+			OperandList<IdRef> indexes = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpUntypedInBoundsPtrAccessChainKHR);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, indexes);
+
+			generator.writeInstruction(spv::Op::OpUntypedInBoundsPtrAccessChainKHR, wordCount, idResultType, idResult, baseType, base, element, indexes);
+		}
+
+		constexpr InstructionBuilder<TGenerator, IdRef> beginOpUntypedInBoundsPtrAccessChainKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef baseType,
+			IdRef base,
+			IdRef element)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			generator.beginInstruction(idResultType, idResult, baseType, base, element);
+			return {generator, spv::Op::OpUntypedInBoundsPtrAccessChainKHR};
+		}
+
+		constexpr void OpUntypedPrefetchKHR(
+			IdRef pointerType,
+			IdRef numBytes,
+			std::optional<IdRef> RW = {},
+			std::optional<IdRef> locality = {},
+			std::optional<IdRef> cacheType = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpUntypedPrefetchKHR);
+
+			size_t wordCount = 3;
+			countOperandsWord(wordCount, RW, locality, cacheType);
+
+			generator.writeInstruction(spv::Op::OpUntypedPrefetchKHR, wordCount, pointerType, numBytes, RW, locality, cacheType);
+		}
+
+		constexpr void OpUntypedPtrAccessChainKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef baseType,
+			IdRef base,
+			IdRef element,
+			OperandList<IdRef> indexes = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpUntypedPtrAccessChainKHR);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, indexes);
+
+			generator.writeInstruction(spv::Op::OpUntypedPtrAccessChainKHR, wordCount, idResultType, idResult, baseType, base, element, indexes);
+		}
+
+		constexpr InstructionBuilder<TGenerator, IdRef> beginOpUntypedPtrAccessChainKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef baseType,
+			IdRef base,
+			IdRef element)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			generator.beginInstruction(idResultType, idResult, baseType, base, element);
+			return {generator, spv::Op::OpUntypedPtrAccessChainKHR};
+		}
+
+		constexpr void OpUntypedVariableKHR(
+			IdResultType idResultType,
+			IdResult idResult,
+			spv::StorageClass storageClass,
+			std::optional<IdRef> dataType = {},
+			std::optional<IdRef> initializer = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpUntypedVariableKHR);
+
+			size_t wordCount = 4;
+			countOperandsWord(wordCount, dataType, initializer);
+
+			generator.writeInstruction(spv::Op::OpUntypedVariableKHR, wordCount, idResultType, idResult, storageClass, dataType, initializer);
+		}
+	};
+} // namespace dynspv
\ No newline at end of file
@@ -0,0 +1,1555 @@
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include <dynspv_base.hpp>
+
+namespace dynspv
+{
+	// Instructions with the NV suffix, mixed into generators listing it in their InstructionSets
+	template<typename TGenerator>
+	class NvInstructions
+	{
+	  public:
+		constexpr void OpConvertImageToUNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpConvertImageToUNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpConvertImageToUNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, operand);
+		}
+
+		constexpr void OpConvertSampledImageToUNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpConvertSampledImageToUNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpConvertSampledImageToUNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, operand);
+		}
+
+		constexpr void OpConvertSamplerToUNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpConvertSamplerToUNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpConvertSamplerToUNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, operand);
+		}
+
+		constexpr void OpConvertUToImageNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpConvertUToImageNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpConvertUToImageNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, operand);
+		}
+
+		constexpr void OpConvertUToSampledImageNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpConvertUToSampledImageNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpConvertUToSampledImageNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, operand);
+		}
+
+		constexpr void OpConvertUToSamplerNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef operand)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpConvertUToSamplerNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpConvertUToSamplerNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, operand);
+		}
+
+		constexpr void OpCooperativeMatrixConvertNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef matrix)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpCooperativeMatrixConvertNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpCooperativeMatrixConvertNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, matrix);
+		}
+
+		constexpr void OpCooperativeMatrixLengthNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef type)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpCooperativeMatrixLengthNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpCooperativeMatrixLengthNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, type);
+		}
+
+		constexpr void OpCooperativeMatrixLoadNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer,
+			IdRef stride,
+			IdRef columnMajor,
+			std::optional<spv::MemoryAccessMask> memoryAccess = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpCooperativeMatrixLoadNV);
+
+			size_t wordCount = 6;
+			countOperandsWord(wordCount, memoryAccess);
+
+			generator.writeInstruction(spv::Op::OpCooperativeMatrixLoadNV, wordCount, idResultType, idResult, pointer, stride, columnMajor, memoryAccess);
+		}
+
+		constexpr void OpCooperativeMatrixLoadTensorNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer,
+			IdRef object,
+			IdRef tensorLayout,
+			spv::MemoryAccessMask memoryOperand,
+			spv::TensorAddressingOperandsMask tensorAddressingOperands)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpCooperativeMatrixLoadTensorNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpCooperativeMatrixLoadTensorNV, 8);
+			generator.writeFixedInstruction(header, idResultType, idResult, pointer, object, tensorLayout, static_cast<uint32_t>(memoryOperand), static_cast<uint32_t>(tensorAddressingOperands));
+		}
+
+		constexpr void OpCooperativeMatrixMulAddNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef A,
+			IdRef B,
+			IdRef C)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpCooperativeMatrixMulAddNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpCooperativeMatrixMulAddNV, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, A, B, C);
+		}
+
+		constexpr void OpCooperativeMatrixPerElementOpNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef matrix,
+			IdRef func,
+			OperandList<IdRef> operands = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpCooperativeMatrixPerElementOpNV);
+
+			size_t wordCount = 5;
+			countOperandsWord(wordCount, operands);
+
+			generator.writeInstruction(spv::Op::OpCooperativeMatrixPerElementOpNV, wordCount, idResultType, idResult, matrix, func, operands);
+		}
+
+		constexpr InstructionBuilder<TGenerator, IdRef> beginOpCooperativeMatrixPerElementOpNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef matrix,
+			IdRef func)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			generator.beginInstruction(idResultType, idResult, matrix, func);
+			return {generator, spv::Op::OpCooperativeMatrixPerElementOpNV};
+		}
+
+		constexpr void OpCooperativeMatrixReduceNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef matrix,
+			spv::CooperativeMatrixReduceMask reduce,
+			IdRef combineFunc)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpCooperativeMatrixReduceNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpCooperativeMatrixReduceNV, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, matrix, static_cast<uint32_t>(reduce), combineFunc);
+		}
+
+		constexpr void OpCooperativeMatrixStoreNV(
+			IdRef pointer,
+			IdRef object,
+			IdRef stride,
+			IdRef columnMajor,
+			std::optional<spv::MemoryAccessMask> memoryAccess = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpCooperativeMatrixStoreNV);
+
+			size_t wordCount = 5;
+			countOperandsWord(wordCount, memoryAccess);
+
+			generator.writeInstruction(spv::Op::OpCooperativeMatrixStoreNV, wordCount, pointer, object, stride, columnMajor, memoryAccess);
+		}
+
+		constexpr void OpCooperativeMatrixStoreTensorNV(
+			IdRef pointer,
+			IdRef object,
+			IdRef tensorLayout,
+			spv::MemoryAccessMask memoryOperand,
+			spv::TensorAddressingOperandsMask tensorAddressingOperands)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpCooperativeMatrixStoreTensorNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpCooperativeMatrixStoreTensorNV, 6);
+			generator.writeFixedInstruction(header, pointer, object, tensorLayout, static_cast<uint32_t>(memoryOperand), static_cast<uint32_t>(tensorAddressingOperands));
+		}
+
+		constexpr void OpCooperativeMatrixTransposeNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef matrix)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpCooperativeMatrixTransposeNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpCooperativeMatrixTransposeNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, matrix);
+		}
+
+		constexpr void OpCooperativeVectorLoadNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef pointer,
+			IdRef offset,
+			std::optional<spv::MemoryAccessMask> memoryAccess = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpCooperativeVectorLoadNV);
+
+			size_t wordCount = 5;
+			countOperandsWord(wordCount, memoryAccess);
+
+			generator.writeInstruction(spv::Op::OpCooperativeVectorLoadNV, wordCount, idResultType, idResult, pointer, offset, memoryAccess);
+		}
+
+		constexpr void OpCooperativeVectorMatrixMulAddNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef input,
+			IdRef inputInterpretation,
+			IdRef matrix,
+			IdRef matrixOffset,
+			IdRef matrixInterpretation,
+			IdRef bias,
+			IdRef biasOffset,
+			IdRef biasInterpretation,
+			IdRef M,
+			IdRef K,
+			IdRef memoryLayout,
+			IdRef transpose,
+			std::optional<IdRef> matrixStride = {},
+			std::optional<spv::CooperativeMatrixOperandsMask> cooperativeMatrixOperands = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpCooperativeVectorMatrixMulAddNV);
+
+			size_t wordCount = 15;
+			countOperandsWord(wordCount, matrixStride, cooperativeMatrixOperands);
+
+			generator.writeInstruction(spv::Op::OpCooperativeVectorMatrixMulAddNV, wordCount, idResultType, idResult, input, inputInterpretation, matrix, matrixOffset, matrixInterpretation, bias, biasOffset, biasInterpretation, M, K, memoryLayout, transpose, matrixStride, cooperativeMatrixOperands);
+		}
+
+		constexpr void OpCooperativeVectorMatrixMulNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef input,
+			IdRef inputInterpretation,
+			IdRef matrix,
+			IdRef matrixOffset,
+			IdRef matrixInterpretation,
+			IdRef M,
+			IdRef K,
+			IdRef memoryLayout,
+			IdRef transpose,
+			std::optional<IdRef> matrixStride = {},
+			std::optional<spv::CooperativeMatrixOperandsMask> cooperativeMatrixOperands = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpCooperativeVectorMatrixMulNV);
+
+			size_t wordCount = 12;
+			countOperandsWord(wordCount, matrixStride, cooperativeMatrixOperands);
+
+			generator.writeInstruction(spv::Op::OpCooperativeVectorMatrixMulNV, wordCount, idResultType, idResult, input, inputInterpretation, matrix, matrixOffset, matrixInterpretation, M, K, memoryLayout, transpose, matrixStride, cooperativeMatrixOperands);
+		}
+
+		constexpr void OpCooperativeVectorOuterProductAccumulateNV(
+			IdRef pointer,
+			IdRef offset,
+			IdRef A,
+			IdRef B,
+			IdRef memoryLayout,
+			IdRef matrixInterpretation,
+			std::optional<IdRef> matrixStride = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpCooperativeVectorOuterProductAccumulateNV);
+
+			size_t wordCount = 7;
+			countOperandsWord(wordCount, matrixStride);
+
+			generator.writeInstruction(spv::Op::OpCooperativeVectorOuterProductAccumulateNV, wordCount, pointer, offset, A, B, memoryLayout, matrixInterpretation, matrixStride);
+		}
+
+		constexpr void OpCooperativeVectorReduceSumAccumulateNV(
+			IdRef pointer,
+			IdRef offset,
+			IdRef V)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpCooperativeVectorReduceSumAccumulateNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpCooperativeVectorReduceSumAccumulateNV, 4);
+			generator.writeFixedInstruction(header, pointer, offset, V);
+		}
+
+		constexpr void OpCooperativeVectorStoreNV(
+			IdRef pointer,
+			IdRef offset,
+			IdRef object,
+			std::optional<spv::MemoryAccessMask> memoryAccess = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpCooperativeVectorStoreNV);
+
+			size_t wordCount = 4;
+			countOperandsWord(wordCount, memoryAccess);
+
+			generator.writeInstruction(spv::Op::OpCooperativeVectorStoreNV, wordCount, pointer, offset, object, memoryAccess);
+		}
+
+		constexpr void OpCreateTensorLayoutNV(
+			IdResultType idResultType,
+			IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpCreateTensorLayoutNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpCreateTensorLayoutNV, 3);
+			generator.writeFixedInstruction(header, idResultType, idResult);
+		}
+
+		constexpr void OpCreateTensorViewNV(
+			IdResultType idResultType,
+			IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpCreateTensorViewNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpCreateTensorViewNV, 3);
+			generator.writeFixedInstruction(header, idResultType, idResult);
+		}
+
+		constexpr void OpExecuteCallableNV(
+			IdRef sBTIndex,
+			IdRef callableDataId)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpExecuteCallableNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpExecuteCallableNV, 3);
+			generator.writeFixedInstruction(header, sBTIndex, callableDataId);
+		}
+
+		constexpr void OpFetchMicroTriangleVertexBarycentricNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef accel,
+			IdRef instanceId,
+			IdRef geometryIndex,
+			IdRef primitiveIndex,
+			IdRef barycentric)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpFetchMicroTriangleVertexBarycentricNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFetchMicroTriangleVertexBarycentricNV, 8);
+			generator.writeFixedInstruction(header, idResultType, idResult, accel, instanceId, geometryIndex, primitiveIndex, barycentric);
+		}
+
+		constexpr void OpFetchMicroTriangleVertexPositionNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef accel,
+			IdRef instanceId,
+			IdRef geometryIndex,
+			IdRef primitiveIndex,
+			IdRef barycentric)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpFetchMicroTriangleVertexPositionNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpFetchMicroTriangleVertexPositionNV, 8);
+			generator.writeFixedInstruction(header, idResultType, idResult, accel, instanceId, geometryIndex, primitiveIndex, barycentric);
+		}
+
+		constexpr void OpGroupNonUniformPartitionNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef value)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpGroupNonUniformPartitionNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpGroupNonUniformPartitionNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, value);
+		}
+
+		constexpr void OpHitObjectExecuteShaderNV(
+			IdRef hitObject,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectExecuteShaderNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectExecuteShaderNV, 3);
+			generator.writeFixedInstruction(header, hitObject, payload);
+		}
+
+		constexpr void OpHitObjectGetAttributesNV(
+			IdRef hitObject,
+			IdRef hitObjectAttribute)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectGetAttributesNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectGetAttributesNV, 3);
+			generator.writeFixedInstruction(header, hitObject, hitObjectAttribute);
+		}
+
+		constexpr void OpHitObjectGetClusterIdNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectGetClusterIdNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectGetClusterIdNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectGetCurrentTimeNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectGetCurrentTimeNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectGetCurrentTimeNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectGetGeometryIndexNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectGetGeometryIndexNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectGetGeometryIndexNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectGetHitKindNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectGetHitKindNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectGetHitKindNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectGetInstanceCustomIndexNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectGetInstanceCustomIndexNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectGetInstanceCustomIndexNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectGetInstanceIdNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectGetInstanceIdNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectGetInstanceIdNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectGetLSSPositionsNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectGetLSSPositionsNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectGetLSSPositionsNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectGetLSSRadiiNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectGetLSSRadiiNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectGetLSSRadiiNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectGetObjectRayDirectionNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectGetObjectRayDirectionNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectGetObjectRayDirectionNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectGetObjectRayOriginNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectGetObjectRayOriginNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectGetObjectRayOriginNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectGetObjectToWorldNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectGetObjectToWorldNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectGetObjectToWorldNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectGetPrimitiveIndexNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectGetPrimitiveIndexNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectGetPrimitiveIndexNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectGetRayTMaxNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectGetRayTMaxNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectGetRayTMaxNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectGetRayTMinNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectGetRayTMinNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectGetRayTMinNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectGetShaderBindingTableRecordIndexNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectGetShaderBindingTableRecordIndexNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectGetShaderBindingTableRecordIndexNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectGetShaderRecordBufferHandleNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectGetShaderRecordBufferHandleNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectGetShaderRecordBufferHandleNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectGetSpherePositionNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectGetSpherePositionNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectGetSpherePositionNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectGetSphereRadiusNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectGetSphereRadiusNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectGetSphereRadiusNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectGetWorldRayDirectionNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectGetWorldRayDirectionNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectGetWorldRayDirectionNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectGetWorldRayOriginNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectGetWorldRayOriginNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectGetWorldRayOriginNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectGetWorldToObjectNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectGetWorldToObjectNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectGetWorldToObjectNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectIsEmptyNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectIsEmptyNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectIsEmptyNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectIsHitNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectIsHitNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectIsHitNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectIsLSSHitNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectIsLSSHitNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectIsLSSHitNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectIsMissNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectIsMissNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectIsMissNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectIsSphereHitNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectIsSphereHitNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectIsSphereHitNV, 4);
+			generator.writeFixedInstruction(header, idResultType, idResult, hitObject);
+		}
+
+		constexpr void OpHitObjectRecordEmptyNV(IdRef hitObject)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectRecordEmptyNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectRecordEmptyNV, 2);
+			generator.writeFixedInstruction(header, hitObject);
+		}
+
+		constexpr void OpHitObjectRecordHitMotionNV(
+			IdRef hitObject,
+			IdRef accelerationStructure,
+			IdRef instanceId,
+			IdRef primitiveId,
+			IdRef geometryIndex,
+			IdRef hitKind,
+			IdRef sBTRecordOffset,
+			IdRef sBTRecordStride,
+			IdRef origin,
+			IdRef tMin,
+			IdRef direction,
+			IdRef tMax,
+			IdRef currentTime,
+			IdRef hitObjectAttributes)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectRecordHitMotionNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectRecordHitMotionNV, 15);
+			generator.writeFixedInstruction(header, hitObject, accelerationStructure, instanceId, primitiveId, geometryIndex, hitKind, sBTRecordOffset, sBTRecordStride, origin, tMin, direction, tMax, currentTime, hitObjectAttributes);
+		}
+
+		constexpr void OpHitObjectRecordHitNV(
+			IdRef hitObject,
+			IdRef accelerationStructure,
+			IdRef instanceId,
+			IdRef primitiveId,
+			IdRef geometryIndex,
+			IdRef hitKind,
+			IdRef sBTRecordOffset,
+			IdRef sBTRecordStride,
+			IdRef origin,
+			IdRef tMin,
+			IdRef direction,
+			IdRef tMax,
+			IdRef hitObjectAttributes)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectRecordHitNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectRecordHitNV, 14);
+			generator.writeFixedInstruction(header, hitObject, accelerationStructure, instanceId, primitiveId, geometryIndex, hitKind, sBTRecordOffset, sBTRecordStride, origin, tMin, direction, tMax, hitObjectAttributes);
+		}
+
+		constexpr void OpHitObjectRecordHitWithIndexMotionNV(
+			IdRef hitObject,
+			IdRef accelerationStructure,
+			IdRef instanceId,
+			IdRef primitiveId,
+			IdRef geometryIndex,
+			IdRef hitKind,
+			IdRef sBTRecordIndex,
+			IdRef origin,
+			IdRef tMin,
+			IdRef direction,
+			IdRef tMax,
+			IdRef currentTime,
+			IdRef hitObjectAttributes)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectRecordHitWithIndexMotionNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectRecordHitWithIndexMotionNV, 14);
+			generator.writeFixedInstruction(header, hitObject, accelerationStructure, instanceId, primitiveId, geometryIndex, hitKind, sBTRecordIndex, origin, tMin, direction, tMax, currentTime, hitObjectAttributes);
+		}
+
+		constexpr void OpHitObjectRecordHitWithIndexNV(
+			IdRef hitObject,
+			IdRef accelerationStructure,
+			IdRef instanceId,
+			IdRef primitiveId,
+			IdRef geometryIndex,
+			IdRef hitKind,
+			IdRef sBTRecordIndex,
+			IdRef origin,
+			IdRef tMin,
+			IdRef direction,
+			IdRef tMax,
+			IdRef hitObjectAttributes)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectRecordHitWithIndexNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectRecordHitWithIndexNV, 13);
+			generator.writeFixedInstruction(header, hitObject, accelerationStructure, instanceId, primitiveId, geometryIndex, hitKind, sBTRecordIndex, origin, tMin, direction, tMax, hitObjectAttributes);
+		}
+
+		constexpr void OpHitObjectRecordMissMotionNV(
+			IdRef hitObject,
+			IdRef sBTIndex,
+			IdRef origin,
+			IdRef tMin,
+			IdRef direction,
+			IdRef tMax,
+			IdRef currentTime)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectRecordMissMotionNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectRecordMissMotionNV, 8);
+			generator.writeFixedInstruction(header, hitObject, sBTIndex, origin, tMin, direction, tMax, currentTime);
+		}
+
+		constexpr void OpHitObjectRecordMissNV(
+			IdRef hitObject,
+			IdRef sBTIndex,
+			IdRef origin,
+			IdRef tMin,
+			IdRef direction,
+			IdRef tMax)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectRecordMissNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectRecordMissNV, 7);
+			generator.writeFixedInstruction(header, hitObject, sBTIndex, origin, tMin, direction, tMax);
+		}
+
+		constexpr void OpHitObjectTraceRayMotionNV(
+			IdRef hitObject,
+			IdRef accelerationStructure,
+			IdRef rayFlags,
+			IdRef cullmask,
+			IdRef sBTRecordOffset,
+			IdRef sBTRecordStride,
+			IdRef missIndex,
+			IdRef origin,
+			IdRef tMin,
+			IdRef direction,
+			IdRef tMax,
+			IdRef time,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectTraceRayMotionNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectTraceRayMotionNV, 14);
+			generator.writeFixedInstruction(header, hitObject, accelerationStructure, rayFlags, cullmask, sBTRecordOffset, sBTRecordStride, missIndex, origin, tMin, direction, tMax, time, payload);
+		}
+
+		constexpr void OpHitObjectTraceRayNV(
+			IdRef hitObject,
+			IdRef accelerationStructure,
+			IdRef rayFlags,
+			IdRef cullmask,
+			IdRef sBTRecordOffset,
+			IdRef sBTRecordStride,
+			IdRef missIndex,
+			IdRef origin,
+			IdRef tMin,
+			IdRef direction,
+			IdRef tMax,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpHitObjectTraceRayNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpHitObjectTraceRayNV, 13);
+			generator.writeFixedInstruction(header, hitObject, accelerationStructure, rayFlags, cullmask, sBTRecordOffset, sBTRecordStride, missIndex, origin, tMin, direction, tMax, payload);
+		}
+
+		constexpr void OpIgnoreIntersectionNV()
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpIgnoreIntersectionNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpIgnoreIntersectionNV, 1);
+			generator.writeFixedInstruction(header);
+		}
+
+		constexpr void OpImageSampleFootprintNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef sampledImage,
+			IdRef coordinate,
+			IdRef granularity,
+			IdRef coarse,
+			std::optional<spv::ImageOperandsMask> imageOperands = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpImageSampleFootprintNV);
+
+			size_t wordCount = 7;
+			countOperandsWord(wordCount, imageOperands);
+
+			generator.writeInstruction(spv::Op::OpImageSampleFootprintNV, wordCount, idResultType, idResult, sampledImage, coordinate, granularity, coarse, imageOperands);
+		}
+
+		constexpr void OpRawAccessChainNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef base,
+			IdRef byteStride,
+			IdRef elementIndex,
+			IdRef byteOffset,
+			std::optional<spv::RawAccessChainOperandsMask> rawAccessChainOperands = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRawAccessChainNV);
+
+			size_t wordCount = 7;
+			countOperandsWord(wordCount, rawAccessChainOperands);
+
+			generator.writeInstruction(spv::Op::OpRawAccessChainNV, wordCount, idResultType, idResult, base, byteStride, elementIndex, byteOffset, rawAccessChainOperands);
+		}
+
+		constexpr void OpRayQueryGetClusterIdNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery,
+			IdRef intersection)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGetClusterIdNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGetClusterIdNV, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery, intersection);
+		}
+
+		constexpr void OpRayQueryGetIntersectionLSSHitValueNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery,
+			IdRef intersection)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGetIntersectionLSSHitValueNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGetIntersectionLSSHitValueNV, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery, intersection);
+		}
+
+		constexpr void OpRayQueryGetIntersectionLSSPositionsNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery,
+			IdRef intersection)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGetIntersectionLSSPositionsNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGetIntersectionLSSPositionsNV, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery, intersection);
+		}
+
+		constexpr void OpRayQueryGetIntersectionLSSRadiiNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery,
+			IdRef intersection)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGetIntersectionLSSRadiiNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGetIntersectionLSSRadiiNV, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery, intersection);
+		}
+
+		constexpr void OpRayQueryGetIntersectionSpherePositionNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery,
+			IdRef intersection)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGetIntersectionSpherePositionNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGetIntersectionSpherePositionNV, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery, intersection);
+		}
+
+		constexpr void OpRayQueryGetIntersectionSphereRadiusNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery,
+			IdRef intersection)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryGetIntersectionSphereRadiusNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryGetIntersectionSphereRadiusNV, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery, intersection);
+		}
+
+		constexpr void OpRayQueryIsLSSHitNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery,
+			IdRef intersection)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryIsLSSHitNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryIsLSSHitNV, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery, intersection);
+		}
+
+		constexpr void OpRayQueryIsSphereHitNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef rayQuery,
+			IdRef intersection)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpRayQueryIsSphereHitNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpRayQueryIsSphereHitNV, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, rayQuery, intersection);
+		}
+
+		constexpr void OpReorderThreadWithHintNV(
+			IdRef hint,
+			IdRef bits)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpReorderThreadWithHintNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpReorderThreadWithHintNV, 3);
+			generator.writeFixedInstruction(header, hint, bits);
+		}
+
+		constexpr void OpReorderThreadWithHitObjectNV(
+			IdRef hitObject,
+			std::optional<IdRef> hint = {},
+			std::optional<IdRef> bits = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpReorderThreadWithHitObjectNV);
+
+			size_t wordCount = 2;
+			countOperandsWord(wordCount, hint, bits);
+
+			generator.writeInstruction(spv::Op::OpReorderThreadWithHitObjectNV, wordCount, hitObject, hint, bits);
+		}
+
+		constexpr void OpSamplerImageAddressingModeNV(uint32_t bitWidth)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpSamplerImageAddressingModeNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpSamplerImageAddressingModeNV, 2);
+			generator.writeFixedInstruction(header, bitWidth);
+		}
+
+		constexpr void OpTensorLayoutSetBlockSizeNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef tensorLayout,
+			OperandList<IdRef> blockSize = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTensorLayoutSetBlockSizeNV);
+
+			size_t wordCount = 4;
+			countOperandsWord(wordCount, blockSize);
+
+			generator.writeInstruction(spv::Op::OpTensorLayoutSetBlockSizeNV, wordCount, idResultType, idResult, tensorLayout, blockSize);
+		}
+
+		constexpr InstructionBuilder<TGenerator, IdRef> beginOpTensorLayoutSetBlockSizeNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef tensorLayout)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			generator.beginInstruction(idResultType, idResult, tensorLayout);
+			return {generator, spv::Op::OpTensorLayoutSetBlockSizeNV};
+		}
+
+		constexpr void OpTensorLayoutSetClampValueNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef tensorLayout,
+			IdRef value)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTensorLayoutSetClampValueNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTensorLayoutSetClampValueNV, 5);
+			generator.writeFixedInstruction(header, idResultType, idResult, tensorLayout, value);
+		}
+
+		constexpr void OpTensorLayoutSetDimensionNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef tensorLayout,
+			OperandList<IdRef> dim = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTensorLayoutSetDimensionNV);
+
+			size_t wordCount = 4;
+			countOperandsWord(wordCount, dim);
+
+			generator.writeInstruction(spv::Op::OpTensorLayoutSetDimensionNV, wordCount, idResultType, idResult, tensorLayout, dim);
+		}
+
+		constexpr InstructionBuilder<TGenerator, IdRef> beginOpTensorLayoutSetDimensionNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef tensorLayout)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			generator.beginInstruction(idResultType, idResult, tensorLayout);
+			return {generator, spv::Op::OpTensorLayoutSetDimensionNV};
+		}
+
+		constexpr void OpTensorLayoutSetStrideNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef tensorLayout,
+			OperandList<IdRef> stride = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTensorLayoutSetStrideNV);
+
+			size_t wordCount = 4;
+			countOperandsWord(wordCount, stride);
+
+			generator.writeInstruction(spv::Op::OpTensorLayoutSetStrideNV, wordCount, idResultType, idResult, tensorLayout, stride);
+		}
+
+		constexpr InstructionBuilder<TGenerator, IdRef> beginOpTensorLayoutSetStrideNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef tensorLayout)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			generator.beginInstruction(idResultType, idResult, tensorLayout);
+			return {generator, spv::Op::OpTensorLayoutSetStrideNV};
+		}
+
+		constexpr void OpTensorLayoutSliceNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef tensorLayout,
+			OperandList<IdRef> operands = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTensorLayoutSliceNV);
+
+			size_t wordCount = 4;
+			countOperandsWord(wordCount, operands);
+
+			generator.writeInstruction(spv::Op::OpTensorLayoutSliceNV, wordCount, idResultType, idResult, tensorLayout, operands);
+		}
+
+		constexpr InstructionBuilder<TGenerator, IdRef> beginOpTensorLayoutSliceNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef tensorLayout)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			generator.beginInstruction(idResultType, idResult, tensorLayout);
+			return {generator, spv::Op::OpTensorLayoutSliceNV};
+		}
+
+		constexpr void OpTensorViewSetClipNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef tensorView,
+			IdRef clipRowOffset,
+			IdRef clipRowSpan,
+			IdRef clipColOffset,
+			IdRef clipColSpan)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTensorViewSetClipNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTensorViewSetClipNV, 8);
+			generator.writeFixedInstruction(header, idResultType, idResult, tensorView, clipRowOffset, clipRowSpan, clipColOffset, clipColSpan);
+		}
+
+		constexpr void OpTensorViewSetDimensionNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef tensorView,
+			OperandList<IdRef> dim = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTensorViewSetDimensionNV);
+
+			size_t wordCount = 4;
+			countOperandsWord(wordCount, dim);
+
+			generator.writeInstruction(spv::Op::OpTensorViewSetDimensionNV, wordCount, idResultType, idResult, tensorView, dim);
+		}
+
+		constexpr InstructionBuilder<TGenerator, IdRef> beginOpTensorViewSetDimensionNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef tensorView)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			generator.beginInstruction(idResultType, idResult, tensorView);
+			return {generator, spv::Op::OpTensorViewSetDimensionNV};
+		}
+
+		constexpr void OpTensorViewSetStrideNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef tensorView,
+			OperandList<IdRef> stride = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTensorViewSetStrideNV);
+
+			size_t wordCount = 4;
+			countOperandsWord(wordCount, stride);
+
+			generator.writeInstruction(spv::Op::OpTensorViewSetStrideNV, wordCount, idResultType, idResult, tensorView, stride);
+		}
+
+		constexpr InstructionBuilder<TGenerator, IdRef> beginOpTensorViewSetStrideNV(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef tensorView)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			generator.beginInstruction(idResultType, idResult, tensorView);
+			return {generator, spv::Op::OpTensorViewSetStrideNV};
+		}
+
+		constexpr void OpTerminateRayNV()
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTerminateRayNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTerminateRayNV, 1);
+			generator.writeFixedInstruction(header);
+		}
+
+		constexpr void OpTraceMotionNV(
+			IdRef accel,
+			IdRef rayFlags,
+			IdRef cullMask,
+			IdRef sBTOffset,
+			IdRef sBTStride,
+			IdRef missIndex,
+			IdRef rayOrigin,
+			IdRef rayTmin,
+			IdRef rayDirection,
+			IdRef rayTmax,
+			IdRef time,
+			IdRef payloadId)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTraceMotionNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTraceMotionNV, 13);
+			generator.writeFixedInstruction(header, accel, rayFlags, cullMask, sBTOffset, sBTStride, missIndex, rayOrigin, rayTmin, rayDirection, rayTmax, time, payloadId);
+		}
+
+		constexpr void OpTraceNV(
+			IdRef accel,
+			IdRef rayFlags,
+			IdRef cullMask,
+			IdRef sBTOffset,
+			IdRef sBTStride,
+			IdRef missIndex,
+			IdRef rayOrigin,
+			IdRef rayTmin,
+			IdRef rayDirection,
+			IdRef rayTmax,
+			IdRef payloadId)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTraceNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTraceNV, 12);
+			generator.writeFixedInstruction(header, accel, rayFlags, cullMask, sBTOffset, sBTStride, missIndex, rayOrigin, rayTmin, rayDirection, rayTmax, payloadId);
+		}
+
+		constexpr void OpTraceRayMotionNV(
+			IdRef accel,
+			IdRef rayFlags,
+			IdRef cullMask,
+			IdRef sBTOffset,
+			IdRef sBTStride,
+			IdRef missIndex,
+			IdRef rayOrigin,
+			IdRef rayTmin,
+			IdRef rayDirection,
+			IdRef rayTmax,
+			IdRef time,
+			IdRef payload)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTraceRayMotionNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTraceRayMotionNV, 13);
+			generator.writeFixedInstruction(header, accel, rayFlags, cullMask, sBTOffset, sBTStride, missIndex, rayOrigin, rayTmin, rayDirection, rayTmax, time, payload);
+		}
+
+		constexpr void OpTypeCooperativeMatrixNV(
+			IdResult idResult,
+			IdRef componentType,
+			IdScope execution,
+			IdRef rows,
+			IdRef columns)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeCooperativeMatrixNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeCooperativeMatrixNV, 6);
+			generator.writeFixedInstruction(header, idResult, componentType, execution, rows, columns);
+		}
+
+		constexpr void OpTypeCooperativeVectorNV(
+			IdResult idResult,
+			IdRef componentType,
+			IdRef componentCount)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeCooperativeVectorNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeCooperativeVectorNV, 4);
+			generator.writeFixedInstruction(header, idResult, componentType, componentCount);
+		}
+
+		constexpr void OpTypeHitObjectNV(IdResult idResult)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeHitObjectNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeHitObjectNV, 2);
+			generator.writeFixedInstruction(header, idResult);
+		}
+
+		constexpr void OpTypeTensorLayoutNV(
+			IdResult idResult,
+			IdRef dim,
+			IdRef clampMode)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeTensorLayoutNV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpTypeTensorLayoutNV, 4);
+			generator.writeFixedInstruction(header, idResult, dim, clampMode);
+		}
+
+		constexpr void OpTypeTensorViewNV(
+			IdResult idResult,
+			IdRef dim,
+			IdRef hasDimensions,
+			OperandList<IdRef> p = {})
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpTypeTensorViewNV);
+
+			size_t wordCount = 4;
+			countOperandsWord(wordCount, p);
+
+			generator.writeInstruction(spv::Op::OpTypeTensorViewNV, wordCount, idResult, dim, hasDimensions, p);
+		}
+
+		constexpr InstructionBuilder<TGenerator, IdRef> beginOpTypeTensorViewNV(
+			IdResult idResult,
+			IdRef dim,
+			IdRef hasDimensions)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			generator.beginInstruction(idResult, dim, hasDimensions);
+			return {generator, spv::Op::OpTypeTensorViewNV};
+		}
+
+		constexpr void OpWritePackedPrimitiveIndices4x8NV(
+			IdRef indexOffset,
+			IdRef packedIndices)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpWritePackedPrimitiveIndices4x8NV);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpWritePackedPrimitiveIndices4x8NV, 3);
+			generator.writeFixedInstruction(header, indexOffset, packedIndices);
+		}
+	};
+} // namespace dynspv
\ No newline at end of file
@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include <dynspv_base.hpp>
+
+namespace dynspv
+{
+	// Instructions with the QCOM suffix, mixed into generators listing it in their InstructionSets
+	template<typename TGenerator>
+	class QcomInstructions
+	{
+	  public:
+		constexpr void OpImageBlockMatchGatherSADQCOM(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef targetSampledImage,
+			IdRef targetCoordinates,
+			IdRef referenceSampledImage,
+			IdRef referenceCoordinates,
+			IdRef blockSize)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpImageBlockMatchGatherSADQCOM);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImageBlockMatchGatherSADQCOM, 8);
+			generator.writeFixedInstruction(header, idResultType, idResult, targetSampledImage, targetCoordinates, referenceSampledImage, referenceCoordinates, blockSize);
+		}
+
+		constexpr void OpImageBlockMatchGatherSSDQCOM(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef targetSampledImage,
+			IdRef targetCoordinates,
+			IdRef referenceSampledImage,
+			IdRef referenceCoordinates,
+			IdRef blockSize)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpImageBlockMatchGatherSSDQCOM);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImageBlockMatchGatherSSDQCOM, 8);
+			generator.writeFixedInstruction(header, idResultType, idResult, targetSampledImage, targetCoordinates, referenceSampledImage, referenceCoordinates, blockSize);
+		}
+
+		constexpr void OpImageBlockMatchSADQCOM(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef target,
+			IdRef targetCoordinates,
+			IdRef reference,
+			IdRef referenceCoordinates,
+			IdRef blockSize)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpImageBlockMatchSADQCOM);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImageBlockMatchSADQCOM, 8);
+			generator.writeFixedInstruction(header, idResultType, idResult, target, targetCoordinates, reference, referenceCoordinates, blockSize);
+		}
+
+		constexpr void OpImageBlockMatchSSDQCOM(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef target,
+			IdRef targetCoordinates,
+			IdRef reference,
+			IdRef referenceCoordinates,
+			IdRef blockSize)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpImageBlockMatchSSDQCOM);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImageBlockMatchSSDQCOM, 8);
+			generator.writeFixedInstruction(header, idResultType, idResult, target, targetCoordinates, reference, referenceCoordinates, blockSize);
+		}
+
+		constexpr void OpImageBlockMatchWindowSADQCOM(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef targetSampledImage,
+			IdRef targetCoordinates,
+			IdRef referenceSampledImage,
+			IdRef referenceCoordinates,
+			IdRef blockSize)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpImageBlockMatchWindowSADQCOM);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImageBlockMatchWindowSADQCOM, 8);
+			generator.writeFixedInstruction(header, idResultType, idResult, targetSampledImage, targetCoordinates, referenceSampledImage, referenceCoordinates, blockSize);
+		}
+
+		constexpr void OpImageBlockMatchWindowSSDQCOM(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef targetSampledImage,
+			IdRef targetCoordinates,
+			IdRef referenceSampledImage,
+			IdRef referenceCoordinates,
+			IdRef blockSize)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpImageBlockMatchWindowSSDQCOM);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImageBlockMatchWindowSSDQCOM, 8);
+			generator.writeFixedInstruction(header, idResultType, idResult, targetSampledImage, targetCoordinates, referenceSampledImage, referenceCoordinates, blockSize);
+		}
+
+		constexpr void OpImageBoxFilterQCOM(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef texture,
+			IdRef coordinates,
+			IdRef boxSize)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpImageBoxFilterQCOM);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImageBoxFilterQCOM, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, texture, coordinates, boxSize);
+		}
+
+		constexpr void OpImageSampleWeightedQCOM(
+			IdResultType idResultType,
+			IdResult idResult,
+			IdRef texture,
+			IdRef coordinates,
+			IdRef weights)
+		{
+			TGenerator& generator = static_cast<TGenerator&>(*this);
+
+			DYNSPV_INSTRUMENT(generator, spv::Op::OpImageSampleWeightedQCOM);
+
+			constexpr uint32_t header = makeInstructionHeader(spv::Op::OpImageSampleWeightedQCOM, 6);
+			generator.writeFixedInstruction(header, idResultType, idResult, texture, coordinates, weights);
+		}
+	};
+} // namespace dynspv
\ No newline at end of file
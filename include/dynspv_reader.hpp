@@ -0,0 +1,7403 @@
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include <dynspv_core.hpp>
+
+namespace dynspv
+{
+	enum class OperandKind : uint8_t
+	{
+		ImageOperands,
+		FPFastMathMode,
+		SelectionControl,
+		LoopControl,
+		FunctionControl,
+		MemorySemantics,
+		MemoryAccess,
+		KernelProfilingInfo,
+		RayFlags,
+		FragmentShadingRate,
+		RawAccessChainOperands,
+		SourceLanguage,
+		ExecutionModel,
+		AddressingModel,
+		MemoryModel,
+		ExecutionMode,
+		StorageClass,
+		Dim,
+		SamplerAddressingMode,
+		SamplerFilterMode,
+		ImageFormat,
+		ImageChannelOrder,
+		ImageChannelDataType,
+		FPRoundingMode,
+		FPDenormMode,
+		QuantizationModes,
+		FPOperationMode,
+		OverflowModes,
+		LinkageType,
+		AccessQualifier,
+		HostAccessQualifier,
+		FunctionParameterAttribute,
+		Decoration,
+		BuiltIn,
+		Scope,
+		GroupOperation,
+		KernelEnqueueFlags,
+		Capability,
+		RayQueryIntersection,
+		RayQueryCommittedIntersectionType,
+		RayQueryCandidateIntersectionType,
+		PackedVectorFormat,
+		CooperativeMatrixOperands,
+		CooperativeMatrixLayout,
+		CooperativeMatrixUse,
+		CooperativeMatrixReduce,
+		TensorClampMode,
+		TensorAddressingOperands,
+		InitializationModeQualifier,
+		LoadCacheControl,
+		StoreCacheControl,
+		NamedMaximumNumberOfRegisters,
+		MatrixMultiplyAccumulateOperands,
+		FPEncoding,
+		CooperativeVectorMatrixLayout,
+		ComponentType,
+		IdResultType,
+		IdResult,
+		IdMemorySemantics,
+		IdScope,
+		IdRef,
+		LiteralInteger,
+		LiteralString,
+		LiteralFloat,
+		LiteralContextDependentNumber,
+		LiteralExtInstInteger,
+		LiteralSpecConstantOpInteger,
+		PairLiteralIntegerIdRef,
+		PairIdRefLiteralInteger,
+		PairIdRefIdRef,
+	};
+
+	enum class OperandCategory : uint8_t
+	{
+		Id,
+		Literal,
+		ValueEnum,
+		BitEnum,
+		Composite,
+	};
+
+	enum class OperandQuantifier : uint8_t
+	{
+		One,
+		Optional,
+		Variadic,
+	};
+
+	struct OperandDescription
+	{
+		OperandKind kind;
+		OperandQuantifier quantifier;
+	};
+
+	constexpr OperandCategory getOperandCategory(OperandKind kind)
+	{
+		switch (kind)
+		{
+		case OperandKind::ImageOperands:
+			return OperandCategory::BitEnum;
+		case OperandKind::FPFastMathMode:
+			return OperandCategory::BitEnum;
+		case OperandKind::SelectionControl:
+			return OperandCategory::BitEnum;
+		case OperandKind::LoopControl:
+			return OperandCategory::BitEnum;
+		case OperandKind::FunctionControl:
+			return OperandCategory::BitEnum;
+		case OperandKind::MemorySemantics:
+			return OperandCategory::BitEnum;
+		case OperandKind::MemoryAccess:
+			return OperandCategory::BitEnum;
+		case OperandKind::KernelProfilingInfo:
+			return OperandCategory::BitEnum;
+		case OperandKind::RayFlags:
+			return OperandCategory::BitEnum;
+		case OperandKind::FragmentShadingRate:
+			return OperandCategory::BitEnum;
+		case OperandKind::RawAccessChainOperands:
+			return OperandCategory::BitEnum;
+		case OperandKind::SourceLanguage:
+			return OperandCategory::ValueEnum;
+		case OperandKind::ExecutionModel:
+			return OperandCategory::ValueEnum;
+		case OperandKind::AddressingModel:
+			return OperandCategory::ValueEnum;
+		case OperandKind::MemoryModel:
+			return OperandCategory::ValueEnum;
+		case OperandKind::ExecutionMode:
+			return OperandCategory::ValueEnum;
+		case OperandKind::StorageClass:
+			return OperandCategory::ValueEnum;
+		case OperandKind::Dim:
+			return OperandCategory::ValueEnum;
+		case OperandKind::SamplerAddressingMode:
+			return OperandCategory::ValueEnum;
+		case OperandKind::SamplerFilterMode:
+			return OperandCategory::ValueEnum;
+		case OperandKind::ImageFormat:
+			return OperandCategory::ValueEnum;
+		case OperandKind::ImageChannelOrder:
+			return OperandCategory::ValueEnum;
+		case OperandKind::ImageChannelDataType:
+			return OperandCategory::ValueEnum;
+		case OperandKind::FPRoundingMode:
+			return OperandCategory::ValueEnum;
+		case OperandKind::FPDenormMode:
+			return OperandCategory::ValueEnum;
+		case OperandKind::QuantizationModes:
+			return OperandCategory::ValueEnum;
+		case OperandKind::FPOperationMode:
+			return OperandCategory::ValueEnum;
+		case OperandKind::OverflowModes:
+			return OperandCategory::ValueEnum;
+		case OperandKind::LinkageType:
+			return OperandCategory::ValueEnum;
+		case OperandKind::AccessQualifier:
+			return OperandCategory::ValueEnum;
+		case OperandKind::HostAccessQualifier:
+			return OperandCategory::ValueEnum;
+		case OperandKind::FunctionParameterAttribute:
+			return OperandCategory::ValueEnum;
+		case OperandKind::Decoration:
+			return OperandCategory::ValueEnum;
+		case OperandKind::BuiltIn:
+			return OperandCategory::ValueEnum;
+		case OperandKind::Scope:
+			return OperandCategory::ValueEnum;
+		case OperandKind::GroupOperation:
+			return OperandCategory::ValueEnum;
+		case OperandKind::KernelEnqueueFlags:
+			return OperandCategory::ValueEnum;
+		case OperandKind::Capability:
+			return OperandCategory::ValueEnum;
+		case OperandKind::RayQueryIntersection:
+			return OperandCategory::ValueEnum;
+		case OperandKind::RayQueryCommittedIntersectionType:
+			return OperandCategory::ValueEnum;
+		case OperandKind::RayQueryCandidateIntersectionType:
+			return OperandCategory::ValueEnum;
+		case OperandKind::PackedVectorFormat:
+			return OperandCategory::ValueEnum;
+		case OperandKind::CooperativeMatrixOperands:
+			return OperandCategory::BitEnum;
+		case OperandKind::CooperativeMatrixLayout:
+			return OperandCategory::ValueEnum;
+		case OperandKind::CooperativeMatrixUse:
+			return OperandCategory::ValueEnum;
+		case OperandKind::CooperativeMatrixReduce:
+			return OperandCategory::BitEnum;
+		case OperandKind::TensorClampMode:
+			return OperandCategory::ValueEnum;
+		case OperandKind::TensorAddressingOperands:
+			return OperandCategory::BitEnum;
+		case OperandKind::InitializationModeQualifier:
+			return OperandCategory::ValueEnum;
+		case OperandKind::LoadCacheControl:
+			return OperandCategory::ValueEnum;
+		case OperandKind::StoreCacheControl:
+			return OperandCategory::ValueEnum;
+		case OperandKind::NamedMaximumNumberOfRegisters:
+			return OperandCategory::ValueEnum;
+		case OperandKind::MatrixMultiplyAccumulateOperands:
+			return OperandCategory::BitEnum;
+		case OperandKind::FPEncoding:
+			return OperandCategory::ValueEnum;
+		case OperandKind::CooperativeVectorMatrixLayout:
+			return OperandCategory::ValueEnum;
+		case OperandKind::ComponentType:
+			return OperandCategory::ValueEnum;
+		case OperandKind::IdResultType:
+			return OperandCategory::Id;
+		case OperandKind::IdResult:
+			return OperandCategory::Id;
+		case OperandKind::IdMemorySemantics:
+			return OperandCategory::Id;
+		case OperandKind::IdScope:
+			return OperandCategory::Id;
+		case OperandKind::IdRef:
+			return OperandCategory::Id;
+		case OperandKind::LiteralInteger:
+			return OperandCategory::Literal;
+		case OperandKind::LiteralString:
+			return OperandCategory::Literal;
+		case OperandKind::LiteralFloat:
+			return OperandCategory::Literal;
+		case OperandKind::LiteralContextDependentNumber:
+			return OperandCategory::Literal;
+		case OperandKind::LiteralExtInstInteger:
+			return OperandCategory::Literal;
+		case OperandKind::LiteralSpecConstantOpInteger:
+			return OperandCategory::Literal;
+		case OperandKind::PairLiteralIntegerIdRef:
+			return OperandCategory::Composite;
+		case OperandKind::PairIdRefLiteralInteger:
+			return OperandCategory::Composite;
+		case OperandKind::PairIdRefIdRef:
+			return OperandCategory::Composite;
+		}
+		return OperandCategory::Literal;
+	}
+
+	inline constexpr OperandDescription OPERAND_DESCRIPTIONS[] = {
+		// ImageOperands Bias
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// ImageOperands Lod
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// ImageOperands Grad
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// ImageOperands ConstOffset
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// ImageOperands Offset
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// ImageOperands ConstOffsets
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// ImageOperands Sample
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// ImageOperands MinLod
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// ImageOperands MakeTexelAvailable
+		{OperandKind::IdScope, OperandQuantifier::One},
+		// ImageOperands MakeTexelVisible
+		{OperandKind::IdScope, OperandQuantifier::One},
+		// ImageOperands Offsets
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// LoopControl DependencyLength
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// LoopControl MinIterations
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// LoopControl MaxIterations
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// LoopControl IterationMultiple
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// LoopControl PeelCount
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// LoopControl PartialCount
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// LoopControl InitiationIntervalINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// LoopControl MaxConcurrencyINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// LoopControl DependencyArrayINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// LoopControl PipelineEnableINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// LoopControl LoopCoalesceINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// LoopControl MaxInterleavingINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// LoopControl SpeculatedIterationsINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// LoopControl LoopCountINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// LoopControl MaxReinvocationDelayINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// MemoryAccess Aligned
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// MemoryAccess MakePointerAvailable
+		{OperandKind::IdScope, OperandQuantifier::One},
+		// MemoryAccess MakePointerVisible
+		{OperandKind::IdScope, OperandQuantifier::One},
+		// MemoryAccess AliasScopeINTELMask
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// MemoryAccess NoAliasINTELMask
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// ExecutionMode Invocations
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode LocalSize
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode LocalSizeHint
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode OutputVertices
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode VecTypeHint
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode SubgroupSize
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode SubgroupsPerWorkgroup
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode SubgroupsPerWorkgroupId
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// ExecutionMode LocalSizeId
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// ExecutionMode LocalSizeHintId
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// ExecutionMode DenormPreserve
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode DenormFlushToZero
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode SignedZeroInfNanPreserve
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode RoundingModeRTE
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode RoundingModeRTZ
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode TileShadingRateQCOM
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode IsApiEntryAMDX
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// ExecutionMode MaxNodeRecursionAMDX
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// ExecutionMode StaticNumWorkgroupsAMDX
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// ExecutionMode ShaderIndexAMDX
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// ExecutionMode MaxNumWorkgroupsAMDX
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// ExecutionMode SharesInputWithAMDX
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// ExecutionMode OutputPrimitivesEXT
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode SharedLocalMemorySizeINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode RoundingModeRTPINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode RoundingModeRTNINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode FloatingPointModeALTINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode FloatingPointModeIEEEINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode MaxWorkgroupSizeINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode MaxWorkDimINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode NumSIMDWorkitemsINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode SchedulerTargetFmaxMhzINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode FPFastMathDefault
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// ExecutionMode StreamingInterfaceINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode RegisterMapInterfaceINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode NamedBarrierCountINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode MaximumRegistersINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// ExecutionMode MaximumRegistersIdINTEL
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// ExecutionMode NamedMaximumRegistersINTEL
+		{OperandKind::NamedMaximumNumberOfRegisters, OperandQuantifier::One},
+		// Decoration SpecId
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration ArrayStride
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration MatrixStride
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration BuiltIn
+		{OperandKind::BuiltIn, OperandQuantifier::One},
+		// Decoration UniformId
+		{OperandKind::IdScope, OperandQuantifier::One},
+		// Decoration Stream
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration Location
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration Component
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration Index
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration Binding
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration DescriptorSet
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration Offset
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration XfbBuffer
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration XfbStride
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration FuncParamAttr
+		{OperandKind::FunctionParameterAttribute, OperandQuantifier::One},
+		// Decoration FPRoundingMode
+		{OperandKind::FPRoundingMode, OperandQuantifier::One},
+		// Decoration FPFastMathMode
+		{OperandKind::FPFastMathMode, OperandQuantifier::One},
+		// Decoration LinkageAttributes
+		{OperandKind::LiteralString, OperandQuantifier::One},
+		{OperandKind::LinkageType, OperandQuantifier::One},
+		// Decoration InputAttachmentIndex
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration Alignment
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration MaxByteOffset
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration AlignmentId
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// Decoration MaxByteOffsetId
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// Decoration NodeSharesPayloadLimitsWithAMDX
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// Decoration NodeMaxPayloadsAMDX
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// Decoration PayloadNodeNameAMDX
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// Decoration PayloadNodeBaseIndexAMDX
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// Decoration PayloadNodeArraySizeAMDX
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// Decoration SecondaryViewportRelativeNV
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration SIMTCallINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration ClobberINTEL
+		{OperandKind::LiteralString, OperandQuantifier::One},
+		// Decoration FuncParamIOKindINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration GlobalVariableOffsetINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration CounterBuffer
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// Decoration UserSemantic
+		{OperandKind::LiteralString, OperandQuantifier::One},
+		// Decoration UserTypeGOOGLE
+		{OperandKind::LiteralString, OperandQuantifier::One},
+		// Decoration FunctionRoundingModeINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::FPRoundingMode, OperandQuantifier::One},
+		// Decoration FunctionDenormModeINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::FPDenormMode, OperandQuantifier::One},
+		// Decoration MemoryINTEL
+		{OperandKind::LiteralString, OperandQuantifier::One},
+		// Decoration NumbanksINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration BankwidthINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration MaxPrivateCopiesINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration MaxReplicatesINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration MergeINTEL
+		{OperandKind::LiteralString, OperandQuantifier::One},
+		{OperandKind::LiteralString, OperandQuantifier::One},
+		// Decoration BankBitsINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::Variadic},
+		// Decoration ForcePow2DepthINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration StridesizeINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration WordsizeINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration CacheSizeINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration PrefetchINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration MathOpDSPModeINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration AliasScopeINTEL
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// Decoration NoAliasINTEL
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// Decoration InitiationIntervalINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration MaxConcurrencyINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration PipelineEnableINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration BufferLocationINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration IOPipeStorageINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration FunctionFloatingPointModeINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::FPOperationMode, OperandQuantifier::One},
+		// Decoration FPMaxErrorDecorationINTEL
+		{OperandKind::LiteralFloat, OperandQuantifier::One},
+		// Decoration LatencyControlLabelINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration LatencyControlConstraintINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration MMHostInterfaceAddressWidthINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration MMHostInterfaceDataWidthINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration MMHostInterfaceLatencyINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration MMHostInterfaceReadWriteModeINTEL
+		{OperandKind::AccessQualifier, OperandQuantifier::One},
+		// Decoration MMHostInterfaceMaxBurstINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration MMHostInterfaceWaitRequestINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration HostAccessINTEL
+		{OperandKind::HostAccessQualifier, OperandQuantifier::One},
+		{OperandKind::LiteralString, OperandQuantifier::One},
+		// Decoration InitModeINTEL
+		{OperandKind::InitializationModeQualifier, OperandQuantifier::One},
+		// Decoration ImplementInRegisterMapINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// Decoration CacheControlLoadINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LoadCacheControl, OperandQuantifier::One},
+		// Decoration CacheControlStoreINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::StoreCacheControl, OperandQuantifier::One},
+		// TensorAddressingOperands TensorView
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// TensorAddressingOperands DecodeFunc
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// PairLiteralIntegerIdRef
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// PairIdRefLiteralInteger
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// PairIdRefIdRef
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpUndef
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpSourceContinued
+		{OperandKind::LiteralString, OperandQuantifier::One},
+		// OpSource
+		{OperandKind::SourceLanguage, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		{OperandKind::LiteralString, OperandQuantifier::Optional},
+		// OpSourceExtension
+		{OperandKind::LiteralString, OperandQuantifier::One},
+		// OpName
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralString, OperandQuantifier::One},
+		// OpMemberName
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralString, OperandQuantifier::One},
+		// OpString
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::LiteralString, OperandQuantifier::One},
+		// OpLine
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpExtension
+		{OperandKind::LiteralString, OperandQuantifier::One},
+		// OpExtInstImport
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::LiteralString, OperandQuantifier::One},
+		// OpExtInst
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralExtInstInteger, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpMemoryModel
+		{OperandKind::AddressingModel, OperandQuantifier::One},
+		{OperandKind::MemoryModel, OperandQuantifier::One},
+		// OpEntryPoint
+		{OperandKind::ExecutionModel, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralString, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpExecutionMode
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ExecutionMode, OperandQuantifier::One},
+		// OpCapability
+		{OperandKind::Capability, OperandQuantifier::One},
+		// OpTypeVoid
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpTypeBool
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpTypeInt
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpTypeFloat
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::FPEncoding, OperandQuantifier::Optional},
+		// OpTypeVector
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpTypeMatrix
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpTypeImage
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::Dim, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::ImageFormat, OperandQuantifier::One},
+		{OperandKind::AccessQualifier, OperandQuantifier::Optional},
+		// OpTypeSampler
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpTypeSampledImage
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpTypeArray
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpTypeRuntimeArray
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpTypeStruct
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpTypeOpaque
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::LiteralString, OperandQuantifier::One},
+		// OpTypePointer
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::StorageClass, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpTypeFunction
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpTypeEvent
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpTypeDeviceEvent
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpTypeReserveId
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpTypeQueue
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpTypePipe
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::AccessQualifier, OperandQuantifier::One},
+		// OpTypeForwardPointer
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::StorageClass, OperandQuantifier::One},
+		// OpConstantTrue
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpConstantFalse
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpConstant
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::LiteralContextDependentNumber, OperandQuantifier::One},
+		// OpConstantComposite
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpConstantSampler
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::SamplerAddressingMode, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::SamplerFilterMode, OperandQuantifier::One},
+		// OpConstantNull
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpSpecConstantTrue
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpSpecConstantFalse
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpSpecConstant
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::LiteralContextDependentNumber, OperandQuantifier::One},
+		// OpSpecConstantComposite
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpSpecConstantOp
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::LiteralSpecConstantOpInteger, OperandQuantifier::One},
+		// OpFunction
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::FunctionControl, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFunctionParameter
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpFunctionCall
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpVariable
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::StorageClass, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpImageTexelPointer
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpLoad
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::MemoryAccess, OperandQuantifier::Optional},
+		// OpStore
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::MemoryAccess, OperandQuantifier::Optional},
+		// OpCopyMemory
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::MemoryAccess, OperandQuantifier::Optional},
+		{OperandKind::MemoryAccess, OperandQuantifier::Optional},
+		// OpCopyMemorySized
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::MemoryAccess, OperandQuantifier::Optional},
+		{OperandKind::MemoryAccess, OperandQuantifier::Optional},
+		// OpAccessChain
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpInBoundsAccessChain
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpPtrAccessChain
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpArrayLength
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpGenericPtrMemSemantics
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpInBoundsPtrAccessChain
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpDecorate
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::Decoration, OperandQuantifier::One},
+		// OpMemberDecorate
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::Decoration, OperandQuantifier::One},
+		// OpDecorationGroup
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpGroupDecorate
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpGroupMemberDecorate
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::PairIdRefLiteralInteger, OperandQuantifier::Variadic},
+		// OpVectorExtractDynamic
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpVectorInsertDynamic
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpVectorShuffle
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::Variadic},
+		// OpCompositeConstruct
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpCompositeExtract
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::Variadic},
+		// OpCompositeInsert
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::Variadic},
+		// OpCopyObject
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpTranspose
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSampledImage
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpImageSampleImplicitLod
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::Optional},
+		// OpImageSampleExplicitLod
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::One},
+		// OpImageSampleDrefImplicitLod
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::Optional},
+		// OpImageSampleDrefExplicitLod
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::One},
+		// OpImageSampleProjImplicitLod
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::Optional},
+		// OpImageSampleProjExplicitLod
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::One},
+		// OpImageSampleProjDrefImplicitLod
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::Optional},
+		// OpImageSampleProjDrefExplicitLod
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::One},
+		// OpImageFetch
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::Optional},
+		// OpImageGather
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::Optional},
+		// OpImageDrefGather
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::Optional},
+		// OpImageRead
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::Optional},
+		// OpImageWrite
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::Optional},
+		// OpImage
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpImageQueryFormat
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpImageQueryOrder
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpImageQuerySizeLod
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpImageQuerySize
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpImageQueryLod
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpImageQueryLevels
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpImageQuerySamples
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpConvertFToU
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpConvertFToS
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpConvertSToF
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpConvertUToF
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpUConvert
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSConvert
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFConvert
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpQuantizeToF16
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpConvertPtrToU
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSatConvertSToU
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSatConvertUToS
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpConvertUToPtr
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpPtrCastToGeneric
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGenericCastToPtr
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGenericCastToPtrExplicit
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::StorageClass, OperandQuantifier::One},
+		// OpBitcast
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSNegate
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFNegate
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpIAdd
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFAdd
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpISub
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFSub
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpIMul
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFMul
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpUDiv
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSDiv
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFDiv
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpUMod
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSRem
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSMod
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFRem
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFMod
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpVectorTimesScalar
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpMatrixTimesScalar
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpVectorTimesMatrix
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpMatrixTimesVector
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpMatrixTimesMatrix
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpOuterProduct
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpDot
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpIAddCarry
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpISubBorrow
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpUMulExtended
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSMulExtended
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpAny
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpAll
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpIsNan
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpIsInf
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpIsFinite
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpIsNormal
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSignBitSet
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpLessOrGreater
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpOrdered
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpUnordered
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpLogicalEqual
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpLogicalNotEqual
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpLogicalOr
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpLogicalAnd
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpLogicalNot
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSelect
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpIEqual
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpINotEqual
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpUGreaterThan
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSGreaterThan
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpUGreaterThanEqual
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSGreaterThanEqual
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpULessThan
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSLessThan
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpULessThanEqual
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSLessThanEqual
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFOrdEqual
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFUnordEqual
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFOrdNotEqual
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFUnordNotEqual
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFOrdLessThan
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFUnordLessThan
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFOrdGreaterThan
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFUnordGreaterThan
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFOrdLessThanEqual
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFUnordLessThanEqual
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFOrdGreaterThanEqual
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFUnordGreaterThanEqual
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpShiftRightLogical
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpShiftRightArithmetic
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpShiftLeftLogical
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpBitwiseOr
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpBitwiseXor
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpBitwiseAnd
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpNot
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpBitFieldInsert
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpBitFieldSExtract
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpBitFieldUExtract
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpBitReverse
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpBitCount
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpDPdx
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpDPdy
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFwidth
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpDPdxFine
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpDPdyFine
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFwidthFine
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpDPdxCoarse
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpDPdyCoarse
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFwidthCoarse
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpEmitStreamVertex
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpEndStreamPrimitive
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpControlBarrier
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		// OpMemoryBarrier
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		// OpAtomicLoad
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		// OpAtomicStore
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpAtomicExchange
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpAtomicCompareExchange
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpAtomicCompareExchangeWeak
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpAtomicIIncrement
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		// OpAtomicIDecrement
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		// OpAtomicIAdd
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpAtomicISub
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpAtomicSMin
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpAtomicUMin
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpAtomicSMax
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpAtomicUMax
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpAtomicAnd
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpAtomicOr
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpAtomicXor
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpPhi
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::PairIdRefIdRef, OperandQuantifier::Variadic},
+		// OpLoopMerge
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LoopControl, OperandQuantifier::One},
+		// OpSelectionMerge
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::SelectionControl, OperandQuantifier::One},
+		// OpLabel
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpBranch
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpBranchConditional
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::Variadic},
+		// OpSwitch
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::PairLiteralIntegerIdRef, OperandQuantifier::Variadic},
+		// OpReturnValue
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpLifetimeStart
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpLifetimeStop
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpGroupAsyncCopy
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupWaitEvents
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupAll
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupAny
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupBroadcast
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupIAdd
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupFAdd
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupFMin
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupUMin
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupSMin
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupFMax
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupUMax
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupSMax
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpReadPipe
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpWritePipe
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpReservedReadPipe
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpReservedWritePipe
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpReserveReadPipePackets
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpReserveWritePipePackets
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpCommitReadPipe
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpCommitWritePipe
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpIsValidReserveId
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGetNumPipePackets
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGetMaxPipePackets
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupReserveReadPipePackets
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupReserveWritePipePackets
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupCommitReadPipe
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupCommitWritePipe
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpEnqueueMarker
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpEnqueueKernel
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpGetKernelNDrangeSubGroupCount
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGetKernelNDrangeMaxSubGroupSize
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGetKernelWorkGroupSize
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGetKernelPreferredWorkGroupSizeMultiple
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRetainEvent
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpReleaseEvent
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpCreateUserEvent
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpIsValidEvent
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSetUserEventStatus
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpCaptureEventProfilingInfo
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGetDefaultQueue
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpBuildNDRange
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpImageSparseSampleImplicitLod
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::Optional},
+		// OpImageSparseSampleExplicitLod
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::One},
+		// OpImageSparseSampleDrefImplicitLod
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::Optional},
+		// OpImageSparseSampleDrefExplicitLod
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::One},
+		// OpImageSparseSampleProjImplicitLod
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::Optional},
+		// OpImageSparseSampleProjExplicitLod
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::One},
+		// OpImageSparseSampleProjDrefImplicitLod
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::Optional},
+		// OpImageSparseSampleProjDrefExplicitLod
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::One},
+		// OpImageSparseFetch
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::Optional},
+		// OpImageSparseGather
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::Optional},
+		// OpImageSparseDrefGather
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::Optional},
+		// OpImageSparseTexelsResident
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpAtomicFlagTestAndSet
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		// OpAtomicFlagClear
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		// OpImageSparseRead
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::Optional},
+		// OpSizeOf
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpTypePipeStorage
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpConstantPipeStorage
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpCreatePipeFromPipeStorage
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGetKernelLocalSizeForSubgroupCount
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGetKernelMaxNumSubgroups
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpTypeNamedBarrier
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpNamedBarrierInitialize
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpMemoryNamedBarrier
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		// OpModuleProcessed
+		{OperandKind::LiteralString, OperandQuantifier::One},
+		// OpExecutionModeId
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ExecutionMode, OperandQuantifier::One},
+		// OpDecorateId
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::Decoration, OperandQuantifier::One},
+		// OpGroupNonUniformElect
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		// OpGroupNonUniformAll
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupNonUniformAny
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupNonUniformAllEqual
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupNonUniformBroadcast
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupNonUniformBroadcastFirst
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupNonUniformBallot
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupNonUniformInverseBallot
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupNonUniformBallotBitExtract
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupNonUniformBallotBitCount
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupNonUniformBallotFindLSB
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupNonUniformBallotFindMSB
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupNonUniformShuffle
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupNonUniformShuffleXor
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupNonUniformShuffleUp
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupNonUniformShuffleDown
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupNonUniformIAdd
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpGroupNonUniformFAdd
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpGroupNonUniformIMul
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpGroupNonUniformFMul
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpGroupNonUniformSMin
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpGroupNonUniformUMin
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpGroupNonUniformFMin
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpGroupNonUniformSMax
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpGroupNonUniformUMax
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpGroupNonUniformFMax
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpGroupNonUniformBitwiseAnd
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpGroupNonUniformBitwiseOr
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpGroupNonUniformBitwiseXor
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpGroupNonUniformLogicalAnd
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpGroupNonUniformLogicalOr
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpGroupNonUniformLogicalXor
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpGroupNonUniformQuadBroadcast
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupNonUniformQuadSwap
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpCopyLogical
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpPtrEqual
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpPtrNotEqual
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpPtrDiff
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpColorAttachmentReadEXT
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpDepthAttachmentReadEXT
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpStencilAttachmentReadEXT
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpTypeUntypedPointerKHR
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::StorageClass, OperandQuantifier::One},
+		// OpUntypedVariableKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::StorageClass, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpUntypedAccessChainKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpUntypedInBoundsAccessChainKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpSubgroupBallotKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupFirstInvocationKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpUntypedPtrAccessChainKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpUntypedInBoundsPtrAccessChainKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpUntypedArrayLengthKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpUntypedPrefetchKHR
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpSubgroupAllKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAnyKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAllEqualKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupNonUniformRotateKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpSubgroupReadInvocationKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpExtInstWithForwardRefsKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralExtInstInteger, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpTraceRayKHR
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpExecuteCallableKHR
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpConvertUToAccelerationStructureKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSDot
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::PackedVectorFormat, OperandQuantifier::Optional},
+		// OpUDot
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::PackedVectorFormat, OperandQuantifier::Optional},
+		// OpSUDot
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::PackedVectorFormat, OperandQuantifier::Optional},
+		// OpSDotAccSat
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::PackedVectorFormat, OperandQuantifier::Optional},
+		// OpUDotAccSat
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::PackedVectorFormat, OperandQuantifier::Optional},
+		// OpSUDotAccSat
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::PackedVectorFormat, OperandQuantifier::Optional},
+		// OpTypeCooperativeMatrixKHR
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpCooperativeMatrixLoadKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		{OperandKind::MemoryAccess, OperandQuantifier::Optional},
+		// OpCooperativeMatrixStoreKHR
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		{OperandKind::MemoryAccess, OperandQuantifier::Optional},
+		// OpCooperativeMatrixMulAddKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::CooperativeMatrixOperands, OperandQuantifier::Optional},
+		// OpCooperativeMatrixLengthKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpConstantCompositeReplicateEXT
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSpecConstantCompositeReplicateEXT
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpCompositeConstructReplicateEXT
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpTypeRayQueryKHR
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpRayQueryInitializeKHR
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryTerminateKHR
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryGenerateIntersectionKHR
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryConfirmIntersectionKHR
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryProceedKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryGetIntersectionTypeKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpImageSampleWeightedQCOM
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpImageBoxFilterQCOM
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpImageBlockMatchSSDQCOM
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpImageBlockMatchSADQCOM
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpImageBlockMatchWindowSSDQCOM
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpImageBlockMatchWindowSADQCOM
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpImageBlockMatchGatherSSDQCOM
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpImageBlockMatchGatherSADQCOM
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupIAddNonUniformAMD
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupFAddNonUniformAMD
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupFMinNonUniformAMD
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupUMinNonUniformAMD
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupSMinNonUniformAMD
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupFMaxNonUniformAMD
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupUMaxNonUniformAMD
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupSMaxNonUniformAMD
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFragmentMaskFetchAMD
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFragmentFetchAMD
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpReadClockKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		// OpAllocateNodePayloadsAMDX
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpEnqueueNodePayloadsAMDX
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpTypeNodePayloadArrayAMDX
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFinishWritingNodePayloadAMDX
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpNodePayloadArrayLengthAMDX
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpIsNodePayloadValidAMDX
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpConstantStringAMDX
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::LiteralString, OperandQuantifier::One},
+		// OpSpecConstantStringAMDX
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::LiteralString, OperandQuantifier::One},
+		// OpGroupNonUniformQuadAllKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupNonUniformQuadAnyKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectRecordHitMotionNV
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectRecordHitWithIndexMotionNV
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectRecordMissMotionNV
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectGetWorldToObjectNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectGetObjectToWorldNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectGetObjectRayDirectionNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectGetObjectRayOriginNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectTraceRayMotionNV
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectGetShaderRecordBufferHandleNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectGetShaderBindingTableRecordIndexNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectRecordEmptyNV
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectTraceRayNV
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectRecordHitNV
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectRecordHitWithIndexNV
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectRecordMissNV
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectExecuteShaderNV
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectGetCurrentTimeNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectGetAttributesNV
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectGetHitKindNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectGetPrimitiveIndexNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectGetGeometryIndexNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectGetInstanceIdNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectGetInstanceCustomIndexNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectGetWorldRayDirectionNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectGetWorldRayOriginNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectGetRayTMaxNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectGetRayTMinNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectIsEmptyNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectIsHitNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectIsMissNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpReorderThreadWithHitObjectNV
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpReorderThreadWithHintNV
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpTypeHitObjectNV
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpImageSampleFootprintNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::ImageOperands, OperandQuantifier::Optional},
+		// OpTypeCooperativeVectorNV
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpCooperativeVectorMatrixMulNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		{OperandKind::CooperativeMatrixOperands, OperandQuantifier::Optional},
+		// OpCooperativeVectorOuterProductAccumulateNV
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpCooperativeVectorReduceSumAccumulateNV
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpCooperativeVectorMatrixMulAddNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		{OperandKind::CooperativeMatrixOperands, OperandQuantifier::Optional},
+		// OpCooperativeMatrixConvertNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpEmitMeshTasksEXT
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpSetMeshOutputsEXT
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupNonUniformPartitionNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpWritePackedPrimitiveIndices4x8NV
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFetchMicroTriangleVertexPositionNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFetchMicroTriangleVertexBarycentricNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpCooperativeVectorLoadNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::MemoryAccess, OperandQuantifier::Optional},
+		// OpCooperativeVectorStoreNV
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::MemoryAccess, OperandQuantifier::Optional},
+		// OpReportIntersectionKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpTraceNV
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpTraceMotionNV
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpTraceRayMotionNV
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryGetIntersectionTriangleVertexPositionsKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpTypeAccelerationStructureKHR
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpExecuteCallableNV
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryGetClusterIdNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectGetClusterIdNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpTypeCooperativeMatrixNV
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpCooperativeMatrixLoadNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::MemoryAccess, OperandQuantifier::Optional},
+		// OpCooperativeMatrixStoreNV
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::MemoryAccess, OperandQuantifier::Optional},
+		// OpCooperativeMatrixMulAddNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpCooperativeMatrixLengthNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpCooperativeMatrixReduceNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::CooperativeMatrixReduce, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpCooperativeMatrixLoadTensorNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::MemoryAccess, OperandQuantifier::One},
+		{OperandKind::TensorAddressingOperands, OperandQuantifier::One},
+		// OpCooperativeMatrixStoreTensorNV
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::MemoryAccess, OperandQuantifier::One},
+		{OperandKind::TensorAddressingOperands, OperandQuantifier::One},
+		// OpCooperativeMatrixPerElementOpNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpTypeTensorLayoutNV
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpTypeTensorViewNV
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpCreateTensorLayoutNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpTensorLayoutSetDimensionNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpTensorLayoutSetStrideNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpTensorLayoutSliceNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpTensorLayoutSetClampValueNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpCreateTensorViewNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpTensorViewSetDimensionNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpTensorViewSetStrideNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpIsHelperInvocationEXT
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpTensorViewSetClipNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpTensorLayoutSetBlockSizeNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpCooperativeMatrixTransposeNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpConvertUToImageNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpConvertUToSamplerNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpConvertImageToUNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpConvertSamplerToUNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpConvertUToSampledImageNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpConvertSampledImageToUNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSamplerImageAddressingModeNV
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpRawAccessChainNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::RawAccessChainOperands, OperandQuantifier::Optional},
+		// OpRayQueryGetIntersectionSpherePositionNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryGetIntersectionSphereRadiusNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryGetIntersectionLSSPositionsNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryGetIntersectionLSSRadiiNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryGetIntersectionLSSHitValueNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectGetSpherePositionNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectGetSphereRadiusNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectGetLSSPositionsNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectGetLSSRadiiNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectIsSphereHitNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpHitObjectIsLSSHitNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryIsSphereHitNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryIsLSSHitNV
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupShuffleINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupShuffleDownINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupShuffleUpINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupShuffleXorINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupBlockReadINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupBlockWriteINTEL
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupImageBlockReadINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupImageBlockWriteINTEL
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupImageMediaBlockReadINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupImageMediaBlockWriteINTEL
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpUCountLeadingZerosINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpUCountTrailingZerosINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpAbsISubINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpAbsUSubINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpIAddSatINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpUAddSatINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpIAverageINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpUAverageINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpIAverageRoundedINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpUAverageRoundedINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpISubSatINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpUSubSatINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpIMul32x16INTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpUMul32x16INTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpConstantFunctionPointerINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFunctionPointerCallINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpAsmTargetINTEL
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::LiteralString, OperandQuantifier::One},
+		// OpAsmINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralString, OperandQuantifier::One},
+		{OperandKind::LiteralString, OperandQuantifier::One},
+		// OpAsmCallINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpAtomicFMinEXT
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpAtomicFMaxEXT
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpAssumeTrueKHR
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpExpectKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpDecorateString
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::Decoration, OperandQuantifier::One},
+		// OpMemberDecorateString
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::Decoration, OperandQuantifier::One},
+		// OpVmeImageINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpTypeVmeImageINTEL
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpTypeAvcImePayloadINTEL
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpTypeAvcRefPayloadINTEL
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpTypeAvcSicPayloadINTEL
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpTypeAvcMcePayloadINTEL
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpTypeAvcMceResultINTEL
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpTypeAvcImeResultINTEL
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpTypeAvcImeResultSingleReferenceStreamoutINTEL
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpTypeAvcImeResultDualReferenceStreamoutINTEL
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpTypeAvcImeSingleReferenceStreaminINTEL
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpTypeAvcImeDualReferenceStreaminINTEL
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpTypeAvcRefResultINTEL
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpTypeAvcSicResultINTEL
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpSubgroupAvcMceGetDefaultInterBaseMultiReferencePenaltyINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceSetInterBaseMultiReferencePenaltyINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceGetDefaultInterShapePenaltyINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceSetInterShapePenaltyINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceGetDefaultInterDirectionPenaltyINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceSetInterDirectionPenaltyINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceGetDefaultIntraLumaShapePenaltyINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceGetDefaultInterMotionVectorCostTableINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceGetDefaultHighPenaltyCostTableINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpSubgroupAvcMceGetDefaultMediumPenaltyCostTableINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpSubgroupAvcMceGetDefaultLowPenaltyCostTableINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpSubgroupAvcMceSetMotionVectorCostFunctionINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceGetDefaultIntraLumaModePenaltyINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceGetDefaultNonDcLumaIntraPenaltyINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpSubgroupAvcMceGetDefaultIntraChromaModeBasePenaltyINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpSubgroupAvcMceSetAcOnlyHaarINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceSetSourceInterlacedFieldPolarityINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceSetSingleReferenceInterlacedFieldPolarityINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceSetDualReferenceInterlacedFieldPolaritiesINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceConvertToImePayloadINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceConvertToImeResultINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceConvertToRefPayloadINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceConvertToRefResultINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceConvertToSicPayloadINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceConvertToSicResultINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceGetMotionVectorsINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceGetInterDistortionsINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceGetBestInterDistortionsINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceGetInterMajorShapeINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceGetInterMinorShapeINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceGetInterDirectionsINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceGetInterMotionVectorCountINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceGetInterReferenceIdsINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcMceGetInterReferenceInterlacedFieldPolaritiesINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeInitializeINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeSetSingleReferenceINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeSetDualReferenceINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeRefWindowSizeINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeAdjustRefOffsetINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeConvertToMcePayloadINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeSetMaxMotionVectorCountINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeSetUnidirectionalMixDisableINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeSetEarlySearchTerminationThresholdINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeSetWeightedSadINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeEvaluateWithSingleReferenceINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeEvaluateWithDualReferenceINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeEvaluateWithSingleReferenceStreaminINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeEvaluateWithDualReferenceStreaminINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeEvaluateWithSingleReferenceStreamoutINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeEvaluateWithDualReferenceStreamoutINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeEvaluateWithSingleReferenceStreaminoutINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeEvaluateWithDualReferenceStreaminoutINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeConvertToMceResultINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeGetSingleReferenceStreaminINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeGetDualReferenceStreaminINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeStripSingleReferenceStreamoutINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeStripDualReferenceStreamoutINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeGetStreamoutSingleReferenceMajorShapeMotionVectorsINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeGetStreamoutSingleReferenceMajorShapeDistortionsINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeGetStreamoutSingleReferenceMajorShapeReferenceIdsINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeGetStreamoutDualReferenceMajorShapeMotionVectorsINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeGetStreamoutDualReferenceMajorShapeDistortionsINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeGetStreamoutDualReferenceMajorShapeReferenceIdsINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeGetBorderReachedINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeGetTruncatedSearchIndicationINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeGetUnidirectionalEarlySearchTerminationINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeGetWeightingPatternMinimumMotionVectorINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcImeGetWeightingPatternMinimumDistortionINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcFmeInitializeINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcBmeInitializeINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcRefConvertToMcePayloadINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcRefSetBidirectionalMixDisableINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcRefSetBilinearFilterEnableINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcRefEvaluateWithSingleReferenceINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcRefEvaluateWithDualReferenceINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcRefEvaluateWithMultiReferenceINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcRefEvaluateWithMultiReferenceInterlacedINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcRefConvertToMceResultINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicInitializeINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicConfigureSkcINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicConfigureIpeLumaINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicConfigureIpeLumaChromaINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicGetMotionVectorMaskINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicConvertToMcePayloadINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicSetIntraLumaShapePenaltyINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicSetIntraLumaModeCostFunctionINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicSetIntraChromaModeCostFunctionINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicSetBilinearFilterEnableINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicSetSkcForwardTransformEnableINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicSetBlockBasedRawSkipSadINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicEvaluateIpeINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicEvaluateWithSingleReferenceINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicEvaluateWithDualReferenceINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicEvaluateWithMultiReferenceINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicEvaluateWithMultiReferenceInterlacedINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicConvertToMceResultINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicGetIpeLumaShapeINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicGetBestIpeLumaDistortionINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicGetBestIpeChromaDistortionINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicGetPackedIpeLumaModesINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicGetIpeChromaModeINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicGetPackedSkcLumaCountThresholdINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicGetPackedSkcLumaSumThresholdINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupAvcSicGetInterRawSadsINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpVariableLengthArrayINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSaveMemoryINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpRestoreMemoryINTEL
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpArbitraryFloatSinCosPiINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatCastINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatCastFromIntINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatCastToIntINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatAddINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatSubINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatMulINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatDivINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatGTINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatGEINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatLTINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatLEINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatEQINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatRecipINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatRSqrtINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatCbrtINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatHypotINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatSqrtINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatLogINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatLog2INTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatLog10INTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatLog1pINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatExpINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatExp2INTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatExp10INTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatExpm1INTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatSinINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatCosINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatSinCosINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatSinPiINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatCosPiINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatASinINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatASinPiINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatACosINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatACosPiINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatATanINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatATanPiINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatATan2INTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatPowINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatPowRINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpArbitraryFloatPowNINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpLoopControlINTEL
+		{OperandKind::LiteralInteger, OperandQuantifier::Variadic},
+		// OpAliasDomainDeclINTEL
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpAliasScopeDeclINTEL
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Optional},
+		// OpAliasScopeListDeclINTEL
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpFixedSqrtINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpFixedRecipINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpFixedRsqrtINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpFixedSinINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpFixedCosINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpFixedSinCosINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpFixedSinPiINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpFixedCosPiINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpFixedSinCosPiINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpFixedLogINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpFixedExpINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpPtrCastToCrossWorkgroupINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpCrossWorkgroupCastToPtrINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpReadPipeBlockingINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpWritePipeBlockingINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpFPGARegINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryGetRayTMinKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryGetRayFlagsKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryGetIntersectionTKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryGetIntersectionInstanceCustomIndexKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryGetIntersectionInstanceIdKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryGetIntersectionInstanceShaderBindingTableRecordOffsetKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryGetIntersectionGeometryIndexKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryGetIntersectionPrimitiveIndexKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryGetIntersectionBarycentricsKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryGetIntersectionFrontFaceKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryGetIntersectionCandidateAABBOpaqueKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryGetIntersectionObjectRayDirectionKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryGetIntersectionObjectRayOriginKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryGetWorldRayDirectionKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryGetWorldRayOriginKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryGetIntersectionObjectToWorldKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRayQueryGetIntersectionWorldToObjectKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpAtomicFAddEXT
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpTypeBufferSurfaceINTEL
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::AccessQualifier, OperandQuantifier::One},
+		// OpTypeStructContinuedINTEL
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpConstantCompositeContinuedINTEL
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpSpecConstantCompositeContinuedINTEL
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpCompositeConstructContinuedINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpConvertFToBF16INTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpConvertBF16ToFINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpControlBarrierArriveINTEL
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		// OpControlBarrierWaitINTEL
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::IdMemorySemantics, OperandQuantifier::One},
+		// OpArithmeticFenceEXT
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpTaskSequenceCreateINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		// OpTaskSequenceAsyncINTEL
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::Variadic},
+		// OpTaskSequenceGetINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpTaskSequenceReleaseINTEL
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpTypeTaskSequenceINTEL
+		{OperandKind::IdResult, OperandQuantifier::One},
+		// OpSubgroupBlockPrefetchINTEL
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::MemoryAccess, OperandQuantifier::Optional},
+		// OpSubgroup2DBlockLoadINTEL
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroup2DBlockLoadTransformINTEL
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroup2DBlockLoadTransposeINTEL
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroup2DBlockPrefetchINTEL
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroup2DBlockStoreINTEL
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpSubgroupMatrixMultiplyAccumulateINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::MatrixMultiplyAccumulateOperands, OperandQuantifier::Optional},
+		// OpBitwiseFunctionINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupIMulKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupFMulKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupBitwiseAndKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupBitwiseOrKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupBitwiseXorKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupLogicalAndKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupLogicalOrKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpGroupLogicalXorKHR
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdScope, OperandQuantifier::One},
+		{OperandKind::GroupOperation, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpRoundFToTF32INTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpMaskedGatherINTEL
+		{OperandKind::IdResultType, OperandQuantifier::One},
+		{OperandKind::IdResult, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		// OpMaskedScatterINTEL
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+		{OperandKind::LiteralInteger, OperandQuantifier::One},
+		{OperandKind::IdRef, OperandQuantifier::One},
+	};
+
+	// Members of a composite operand kind
+	constexpr std::span<const OperandDescription> getCompositeBases(OperandKind kind)
+	{
+		switch (kind)
+		{
+		case OperandKind::PairLiteralIntegerIdRef:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(175, 2);
+		case OperandKind::PairIdRefLiteralInteger:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(177, 2);
+		case OperandKind::PairIdRefIdRef:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(179, 2);
+		default:
+			return {};
+		}
+	}
+
+	// Operands following an enumerant, for BitEnum kinds value must be a single bit
+	constexpr std::span<const OperandDescription> getEnumerantParameters(OperandKind kind, uint32_t value)
+	{
+		switch (kind)
+		{
+		case OperandKind::ImageOperands:
+			switch (value)
+			{
+			case 1:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(0, 1);
+			case 2:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(1, 1);
+			case 4:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(2, 2);
+			case 8:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(4, 1);
+			case 16:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(5, 1);
+			case 32:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(6, 1);
+			case 64:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(7, 1);
+			case 128:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(8, 1);
+			case 256:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(9, 1);
+			case 512:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(10, 1);
+			case 65536:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(11, 1);
+			}
+			break;
+		case OperandKind::LoopControl:
+			switch (value)
+			{
+			case 8:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(12, 1);
+			case 16:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(13, 1);
+			case 32:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(14, 1);
+			case 64:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(15, 1);
+			case 128:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(16, 1);
+			case 256:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(17, 1);
+			case 65536:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(18, 1);
+			case 131072:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(19, 1);
+			case 262144:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(20, 1);
+			case 524288:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(21, 1);
+			case 1048576:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(22, 1);
+			case 2097152:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(23, 1);
+			case 4194304:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(24, 1);
+			case 16777216:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(25, 1);
+			case 33554432:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(26, 1);
+			}
+			break;
+		case OperandKind::MemoryAccess:
+			switch (value)
+			{
+			case 2:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(27, 1);
+			case 8:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(28, 1);
+			case 16:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(29, 1);
+			case 65536:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(30, 1);
+			case 131072:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(31, 1);
+			}
+			break;
+		case OperandKind::ExecutionMode:
+			switch (value)
+			{
+			case 0:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(32, 1);
+			case 17:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(33, 3);
+			case 18:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(36, 3);
+			case 26:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(39, 1);
+			case 30:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(40, 1);
+			case 35:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(41, 1);
+			case 36:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(42, 1);
+			case 37:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(43, 1);
+			case 38:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(44, 3);
+			case 39:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(47, 3);
+			case 4459:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(50, 1);
+			case 4460:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(51, 1);
+			case 4461:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(52, 1);
+			case 4462:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(53, 1);
+			case 4463:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(54, 1);
+			case 4490:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(55, 3);
+			case 5070:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(58, 1);
+			case 5071:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(59, 1);
+			case 5072:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(60, 3);
+			case 5073:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(63, 1);
+			case 5077:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(64, 3);
+			case 5102:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(67, 2);
+			case 5270:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(69, 1);
+			case 5618:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(70, 1);
+			case 5620:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(71, 1);
+			case 5621:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(72, 1);
+			case 5622:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(73, 1);
+			case 5623:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(74, 1);
+			case 5893:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(75, 3);
+			case 5894:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(78, 1);
+			case 5896:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(79, 1);
+			case 5903:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(80, 1);
+			case 6028:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(81, 2);
+			case 6154:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(83, 1);
+			case 6160:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(84, 1);
+			case 6417:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(85, 1);
+			case 6461:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(86, 1);
+			case 6462:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(87, 1);
+			case 6463:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(88, 1);
+			}
+			break;
+		case OperandKind::Decoration:
+			switch (value)
+			{
+			case 1:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(89, 1);
+			case 6:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(90, 1);
+			case 7:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(91, 1);
+			case 11:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(92, 1);
+			case 27:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(93, 1);
+			case 29:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(94, 1);
+			case 30:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(95, 1);
+			case 31:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(96, 1);
+			case 32:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(97, 1);
+			case 33:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(98, 1);
+			case 34:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(99, 1);
+			case 35:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(100, 1);
+			case 36:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(101, 1);
+			case 37:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(102, 1);
+			case 38:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(103, 1);
+			case 39:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(104, 1);
+			case 40:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(105, 1);
+			case 41:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(106, 2);
+			case 43:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(108, 1);
+			case 44:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(109, 1);
+			case 45:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(110, 1);
+			case 46:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(111, 1);
+			case 47:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(112, 1);
+			case 5019:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(113, 1);
+			case 5020:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(114, 1);
+			case 5091:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(115, 1);
+			case 5098:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(116, 1);
+			case 5100:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(117, 1);
+			case 5256:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(118, 1);
+			case 5599:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(119, 1);
+			case 5607:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(120, 1);
+			case 5625:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(121, 1);
+			case 5628:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(122, 1);
+			case 5634:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(123, 1);
+			case 5635:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(124, 1);
+			case 5636:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(125, 1);
+			case 5822:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(126, 2);
+			case 5823:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(128, 2);
+			case 5826:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(130, 1);
+			case 5827:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(131, 1);
+			case 5828:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(132, 1);
+			case 5829:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(133, 1);
+			case 5832:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(134, 1);
+			case 5834:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(135, 2);
+			case 5835:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(137, 1);
+			case 5836:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(138, 1);
+			case 5883:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(139, 1);
+			case 5884:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(140, 1);
+			case 5900:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(141, 1);
+			case 5902:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(142, 1);
+			case 5909:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(143, 2);
+			case 5914:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(145, 1);
+			case 5915:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(146, 1);
+			case 5917:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(147, 1);
+			case 5918:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(148, 1);
+			case 5919:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(149, 1);
+			case 5921:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(150, 1);
+			case 5944:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(151, 1);
+			case 6080:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(152, 2);
+			case 6170:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(154, 1);
+			case 6172:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(155, 1);
+			case 6173:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(156, 3);
+			case 6177:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(159, 1);
+			case 6178:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(160, 1);
+			case 6179:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(161, 1);
+			case 6180:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(162, 1);
+			case 6181:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(163, 1);
+			case 6182:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(164, 1);
+			case 6188:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(165, 2);
+			case 6190:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(167, 1);
+			case 6191:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(168, 1);
+			case 6442:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(169, 2);
+			case 6443:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(171, 2);
+			}
+			break;
+		case OperandKind::TensorAddressingOperands:
+			switch (value)
+			{
+			case 1:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(173, 1);
+			case 2:
+				return std::span{OPERAND_DESCRIPTIONS}.subspan(174, 1);
+			}
+			break;
+		default:
+			break;
+		}
+		return {};
+	}
+
+	// Logical operands of an instruction, the header word is not included
+	constexpr std::span<const OperandDescription> getInstructionOperands(spv::Op opcode)
+	{
+		switch (opcode)
+		{
+		case spv::Op::OpUndef:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(181, 2);
+		case spv::Op::OpSourceContinued:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(183, 1);
+		case spv::Op::OpSource:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(184, 4);
+		case spv::Op::OpSourceExtension:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(188, 1);
+		case spv::Op::OpName:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(189, 2);
+		case spv::Op::OpMemberName:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(191, 3);
+		case spv::Op::OpString:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(194, 2);
+		case spv::Op::OpLine:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(196, 3);
+		case spv::Op::OpExtension:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(199, 1);
+		case spv::Op::OpExtInstImport:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(200, 2);
+		case spv::Op::OpExtInst:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(202, 5);
+		case spv::Op::OpMemoryModel:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(207, 2);
+		case spv::Op::OpEntryPoint:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(209, 4);
+		case spv::Op::OpExecutionMode:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(213, 2);
+		case spv::Op::OpCapability:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(215, 1);
+		case spv::Op::OpTypeVoid:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(216, 1);
+		case spv::Op::OpTypeBool:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(217, 1);
+		case spv::Op::OpTypeInt:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(218, 3);
+		case spv::Op::OpTypeFloat:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(221, 3);
+		case spv::Op::OpTypeVector:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(224, 3);
+		case spv::Op::OpTypeMatrix:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(227, 3);
+		case spv::Op::OpTypeImage:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(230, 9);
+		case spv::Op::OpTypeSampler:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(239, 1);
+		case spv::Op::OpTypeSampledImage:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(240, 2);
+		case spv::Op::OpTypeArray:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(242, 3);
+		case spv::Op::OpTypeRuntimeArray:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(245, 2);
+		case spv::Op::OpTypeStruct:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(247, 2);
+		case spv::Op::OpTypeOpaque:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(249, 2);
+		case spv::Op::OpTypePointer:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(251, 3);
+		case spv::Op::OpTypeFunction:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(254, 3);
+		case spv::Op::OpTypeEvent:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(257, 1);
+		case spv::Op::OpTypeDeviceEvent:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(258, 1);
+		case spv::Op::OpTypeReserveId:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(259, 1);
+		case spv::Op::OpTypeQueue:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(260, 1);
+		case spv::Op::OpTypePipe:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(261, 2);
+		case spv::Op::OpTypeForwardPointer:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(263, 2);
+		case spv::Op::OpConstantTrue:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(265, 2);
+		case spv::Op::OpConstantFalse:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(267, 2);
+		case spv::Op::OpConstant:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(269, 3);
+		case spv::Op::OpConstantComposite:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(272, 3);
+		case spv::Op::OpConstantSampler:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(275, 5);
+		case spv::Op::OpConstantNull:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(280, 2);
+		case spv::Op::OpSpecConstantTrue:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(282, 2);
+		case spv::Op::OpSpecConstantFalse:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(284, 2);
+		case spv::Op::OpSpecConstant:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(286, 3);
+		case spv::Op::OpSpecConstantComposite:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(289, 3);
+		case spv::Op::OpSpecConstantOp:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(292, 3);
+		case spv::Op::OpFunction:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(295, 4);
+		case spv::Op::OpFunctionParameter:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(299, 2);
+		case spv::Op::OpFunctionCall:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(301, 4);
+		case spv::Op::OpVariable:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(305, 4);
+		case spv::Op::OpImageTexelPointer:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(309, 5);
+		case spv::Op::OpLoad:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(314, 4);
+		case spv::Op::OpStore:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(318, 3);
+		case spv::Op::OpCopyMemory:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(321, 4);
+		case spv::Op::OpCopyMemorySized:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(325, 5);
+		case spv::Op::OpAccessChain:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(330, 4);
+		case spv::Op::OpInBoundsAccessChain:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(334, 4);
+		case spv::Op::OpPtrAccessChain:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(338, 5);
+		case spv::Op::OpArrayLength:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(343, 4);
+		case spv::Op::OpGenericPtrMemSemantics:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(347, 3);
+		case spv::Op::OpInBoundsPtrAccessChain:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(350, 5);
+		case spv::Op::OpDecorate:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(355, 2);
+		case spv::Op::OpMemberDecorate:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(357, 3);
+		case spv::Op::OpDecorationGroup:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(360, 1);
+		case spv::Op::OpGroupDecorate:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(361, 2);
+		case spv::Op::OpGroupMemberDecorate:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(363, 2);
+		case spv::Op::OpVectorExtractDynamic:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(365, 4);
+		case spv::Op::OpVectorInsertDynamic:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(369, 5);
+		case spv::Op::OpVectorShuffle:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(374, 5);
+		case spv::Op::OpCompositeConstruct:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(379, 3);
+		case spv::Op::OpCompositeExtract:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(382, 4);
+		case spv::Op::OpCompositeInsert:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(386, 5);
+		case spv::Op::OpCopyObject:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(391, 3);
+		case spv::Op::OpTranspose:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(394, 3);
+		case spv::Op::OpSampledImage:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(397, 4);
+		case spv::Op::OpImageSampleImplicitLod:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(401, 5);
+		case spv::Op::OpImageSampleExplicitLod:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(406, 5);
+		case spv::Op::OpImageSampleDrefImplicitLod:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(411, 6);
+		case spv::Op::OpImageSampleDrefExplicitLod:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(417, 6);
+		case spv::Op::OpImageSampleProjImplicitLod:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(423, 5);
+		case spv::Op::OpImageSampleProjExplicitLod:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(428, 5);
+		case spv::Op::OpImageSampleProjDrefImplicitLod:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(433, 6);
+		case spv::Op::OpImageSampleProjDrefExplicitLod:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(439, 6);
+		case spv::Op::OpImageFetch:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(445, 5);
+		case spv::Op::OpImageGather:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(450, 6);
+		case spv::Op::OpImageDrefGather:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(456, 6);
+		case spv::Op::OpImageRead:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(462, 5);
+		case spv::Op::OpImageWrite:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(467, 4);
+		case spv::Op::OpImage:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(471, 3);
+		case spv::Op::OpImageQueryFormat:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(474, 3);
+		case spv::Op::OpImageQueryOrder:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(477, 3);
+		case spv::Op::OpImageQuerySizeLod:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(480, 4);
+		case spv::Op::OpImageQuerySize:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(484, 3);
+		case spv::Op::OpImageQueryLod:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(487, 4);
+		case spv::Op::OpImageQueryLevels:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(491, 3);
+		case spv::Op::OpImageQuerySamples:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(494, 3);
+		case spv::Op::OpConvertFToU:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(497, 3);
+		case spv::Op::OpConvertFToS:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(500, 3);
+		case spv::Op::OpConvertSToF:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(503, 3);
+		case spv::Op::OpConvertUToF:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(506, 3);
+		case spv::Op::OpUConvert:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(509, 3);
+		case spv::Op::OpSConvert:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(512, 3);
+		case spv::Op::OpFConvert:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(515, 3);
+		case spv::Op::OpQuantizeToF16:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(518, 3);
+		case spv::Op::OpConvertPtrToU:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(521, 3);
+		case spv::Op::OpSatConvertSToU:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(524, 3);
+		case spv::Op::OpSatConvertUToS:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(527, 3);
+		case spv::Op::OpConvertUToPtr:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(530, 3);
+		case spv::Op::OpPtrCastToGeneric:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(533, 3);
+		case spv::Op::OpGenericCastToPtr:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(536, 3);
+		case spv::Op::OpGenericCastToPtrExplicit:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(539, 4);
+		case spv::Op::OpBitcast:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(543, 3);
+		case spv::Op::OpSNegate:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(546, 3);
+		case spv::Op::OpFNegate:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(549, 3);
+		case spv::Op::OpIAdd:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(552, 4);
+		case spv::Op::OpFAdd:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(556, 4);
+		case spv::Op::OpISub:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(560, 4);
+		case spv::Op::OpFSub:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(564, 4);
+		case spv::Op::OpIMul:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(568, 4);
+		case spv::Op::OpFMul:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(572, 4);
+		case spv::Op::OpUDiv:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(576, 4);
+		case spv::Op::OpSDiv:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(580, 4);
+		case spv::Op::OpFDiv:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(584, 4);
+		case spv::Op::OpUMod:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(588, 4);
+		case spv::Op::OpSRem:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(592, 4);
+		case spv::Op::OpSMod:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(596, 4);
+		case spv::Op::OpFRem:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(600, 4);
+		case spv::Op::OpFMod:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(604, 4);
+		case spv::Op::OpVectorTimesScalar:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(608, 4);
+		case spv::Op::OpMatrixTimesScalar:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(612, 4);
+		case spv::Op::OpVectorTimesMatrix:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(616, 4);
+		case spv::Op::OpMatrixTimesVector:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(620, 4);
+		case spv::Op::OpMatrixTimesMatrix:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(624, 4);
+		case spv::Op::OpOuterProduct:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(628, 4);
+		case spv::Op::OpDot:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(632, 4);
+		case spv::Op::OpIAddCarry:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(636, 4);
+		case spv::Op::OpISubBorrow:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(640, 4);
+		case spv::Op::OpUMulExtended:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(644, 4);
+		case spv::Op::OpSMulExtended:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(648, 4);
+		case spv::Op::OpAny:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(652, 3);
+		case spv::Op::OpAll:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(655, 3);
+		case spv::Op::OpIsNan:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(658, 3);
+		case spv::Op::OpIsInf:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(661, 3);
+		case spv::Op::OpIsFinite:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(664, 3);
+		case spv::Op::OpIsNormal:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(667, 3);
+		case spv::Op::OpSignBitSet:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(670, 3);
+		case spv::Op::OpLessOrGreater:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(673, 4);
+		case spv::Op::OpOrdered:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(677, 4);
+		case spv::Op::OpUnordered:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(681, 4);
+		case spv::Op::OpLogicalEqual:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(685, 4);
+		case spv::Op::OpLogicalNotEqual:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(689, 4);
+		case spv::Op::OpLogicalOr:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(693, 4);
+		case spv::Op::OpLogicalAnd:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(697, 4);
+		case spv::Op::OpLogicalNot:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(701, 3);
+		case spv::Op::OpSelect:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(704, 5);
+		case spv::Op::OpIEqual:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(709, 4);
+		case spv::Op::OpINotEqual:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(713, 4);
+		case spv::Op::OpUGreaterThan:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(717, 4);
+		case spv::Op::OpSGreaterThan:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(721, 4);
+		case spv::Op::OpUGreaterThanEqual:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(725, 4);
+		case spv::Op::OpSGreaterThanEqual:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(729, 4);
+		case spv::Op::OpULessThan:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(733, 4);
+		case spv::Op::OpSLessThan:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(737, 4);
+		case spv::Op::OpULessThanEqual:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(741, 4);
+		case spv::Op::OpSLessThanEqual:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(745, 4);
+		case spv::Op::OpFOrdEqual:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(749, 4);
+		case spv::Op::OpFUnordEqual:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(753, 4);
+		case spv::Op::OpFOrdNotEqual:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(757, 4);
+		case spv::Op::OpFUnordNotEqual:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(761, 4);
+		case spv::Op::OpFOrdLessThan:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(765, 4);
+		case spv::Op::OpFUnordLessThan:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(769, 4);
+		case spv::Op::OpFOrdGreaterThan:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(773, 4);
+		case spv::Op::OpFUnordGreaterThan:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(777, 4);
+		case spv::Op::OpFOrdLessThanEqual:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(781, 4);
+		case spv::Op::OpFUnordLessThanEqual:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(785, 4);
+		case spv::Op::OpFOrdGreaterThanEqual:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(789, 4);
+		case spv::Op::OpFUnordGreaterThanEqual:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(793, 4);
+		case spv::Op::OpShiftRightLogical:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(797, 4);
+		case spv::Op::OpShiftRightArithmetic:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(801, 4);
+		case spv::Op::OpShiftLeftLogical:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(805, 4);
+		case spv::Op::OpBitwiseOr:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(809, 4);
+		case spv::Op::OpBitwiseXor:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(813, 4);
+		case spv::Op::OpBitwiseAnd:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(817, 4);
+		case spv::Op::OpNot:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(821, 3);
+		case spv::Op::OpBitFieldInsert:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(824, 6);
+		case spv::Op::OpBitFieldSExtract:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(830, 5);
+		case spv::Op::OpBitFieldUExtract:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(835, 5);
+		case spv::Op::OpBitReverse:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(840, 3);
+		case spv::Op::OpBitCount:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(843, 3);
+		case spv::Op::OpDPdx:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(846, 3);
+		case spv::Op::OpDPdy:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(849, 3);
+		case spv::Op::OpFwidth:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(852, 3);
+		case spv::Op::OpDPdxFine:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(855, 3);
+		case spv::Op::OpDPdyFine:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(858, 3);
+		case spv::Op::OpFwidthFine:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(861, 3);
+		case spv::Op::OpDPdxCoarse:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(864, 3);
+		case spv::Op::OpDPdyCoarse:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(867, 3);
+		case spv::Op::OpFwidthCoarse:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(870, 3);
+		case spv::Op::OpEmitStreamVertex:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(873, 1);
+		case spv::Op::OpEndStreamPrimitive:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(874, 1);
+		case spv::Op::OpControlBarrier:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(875, 3);
+		case spv::Op::OpMemoryBarrier:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(878, 2);
+		case spv::Op::OpAtomicLoad:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(880, 5);
+		case spv::Op::OpAtomicStore:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(885, 4);
+		case spv::Op::OpAtomicExchange:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(889, 6);
+		case spv::Op::OpAtomicCompareExchange:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(895, 8);
+		case spv::Op::OpAtomicCompareExchangeWeak:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(903, 8);
+		case spv::Op::OpAtomicIIncrement:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(911, 5);
+		case spv::Op::OpAtomicIDecrement:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(916, 5);
+		case spv::Op::OpAtomicIAdd:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(921, 6);
+		case spv::Op::OpAtomicISub:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(927, 6);
+		case spv::Op::OpAtomicSMin:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(933, 6);
+		case spv::Op::OpAtomicUMin:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(939, 6);
+		case spv::Op::OpAtomicSMax:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(945, 6);
+		case spv::Op::OpAtomicUMax:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(951, 6);
+		case spv::Op::OpAtomicAnd:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(957, 6);
+		case spv::Op::OpAtomicOr:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(963, 6);
+		case spv::Op::OpAtomicXor:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(969, 6);
+		case spv::Op::OpPhi:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(975, 3);
+		case spv::Op::OpLoopMerge:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(978, 3);
+		case spv::Op::OpSelectionMerge:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(981, 2);
+		case spv::Op::OpLabel:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(983, 1);
+		case spv::Op::OpBranch:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(984, 1);
+		case spv::Op::OpBranchConditional:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(985, 4);
+		case spv::Op::OpSwitch:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(989, 3);
+		case spv::Op::OpReturnValue:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(992, 1);
+		case spv::Op::OpLifetimeStart:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(993, 2);
+		case spv::Op::OpLifetimeStop:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(995, 2);
+		case spv::Op::OpGroupAsyncCopy:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(997, 8);
+		case spv::Op::OpGroupWaitEvents:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1005, 3);
+		case spv::Op::OpGroupAll:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1008, 4);
+		case spv::Op::OpGroupAny:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1012, 4);
+		case spv::Op::OpGroupBroadcast:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1016, 5);
+		case spv::Op::OpGroupIAdd:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1021, 5);
+		case spv::Op::OpGroupFAdd:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1026, 5);
+		case spv::Op::OpGroupFMin:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1031, 5);
+		case spv::Op::OpGroupUMin:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1036, 5);
+		case spv::Op::OpGroupSMin:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1041, 5);
+		case spv::Op::OpGroupFMax:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1046, 5);
+		case spv::Op::OpGroupUMax:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1051, 5);
+		case spv::Op::OpGroupSMax:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1056, 5);
+		case spv::Op::OpReadPipe:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1061, 6);
+		case spv::Op::OpWritePipe:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1067, 6);
+		case spv::Op::OpReservedReadPipe:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1073, 8);
+		case spv::Op::OpReservedWritePipe:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1081, 8);
+		case spv::Op::OpReserveReadPipePackets:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1089, 6);
+		case spv::Op::OpReserveWritePipePackets:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1095, 6);
+		case spv::Op::OpCommitReadPipe:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1101, 4);
+		case spv::Op::OpCommitWritePipe:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1105, 4);
+		case spv::Op::OpIsValidReserveId:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1109, 3);
+		case spv::Op::OpGetNumPipePackets:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1112, 5);
+		case spv::Op::OpGetMaxPipePackets:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1117, 5);
+		case spv::Op::OpGroupReserveReadPipePackets:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1122, 7);
+		case spv::Op::OpGroupReserveWritePipePackets:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1129, 7);
+		case spv::Op::OpGroupCommitReadPipe:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1136, 5);
+		case spv::Op::OpGroupCommitWritePipe:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1141, 5);
+		case spv::Op::OpEnqueueMarker:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1146, 6);
+		case spv::Op::OpEnqueueKernel:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1152, 13);
+		case spv::Op::OpGetKernelNDrangeSubGroupCount:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1165, 7);
+		case spv::Op::OpGetKernelNDrangeMaxSubGroupSize:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1172, 7);
+		case spv::Op::OpGetKernelWorkGroupSize:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1179, 6);
+		case spv::Op::OpGetKernelPreferredWorkGroupSizeMultiple:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1185, 6);
+		case spv::Op::OpRetainEvent:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1191, 1);
+		case spv::Op::OpReleaseEvent:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1192, 1);
+		case spv::Op::OpCreateUserEvent:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1193, 2);
+		case spv::Op::OpIsValidEvent:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1195, 3);
+		case spv::Op::OpSetUserEventStatus:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1198, 2);
+		case spv::Op::OpCaptureEventProfilingInfo:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1200, 3);
+		case spv::Op::OpGetDefaultQueue:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1203, 2);
+		case spv::Op::OpBuildNDRange:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1205, 5);
+		case spv::Op::OpImageSparseSampleImplicitLod:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1210, 5);
+		case spv::Op::OpImageSparseSampleExplicitLod:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1215, 5);
+		case spv::Op::OpImageSparseSampleDrefImplicitLod:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1220, 6);
+		case spv::Op::OpImageSparseSampleDrefExplicitLod:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1226, 6);
+		case spv::Op::OpImageSparseSampleProjImplicitLod:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1232, 5);
+		case spv::Op::OpImageSparseSampleProjExplicitLod:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1237, 5);
+		case spv::Op::OpImageSparseSampleProjDrefImplicitLod:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1242, 6);
+		case spv::Op::OpImageSparseSampleProjDrefExplicitLod:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1248, 6);
+		case spv::Op::OpImageSparseFetch:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1254, 5);
+		case spv::Op::OpImageSparseGather:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1259, 6);
+		case spv::Op::OpImageSparseDrefGather:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1265, 6);
+		case spv::Op::OpImageSparseTexelsResident:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1271, 3);
+		case spv::Op::OpAtomicFlagTestAndSet:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1274, 5);
+		case spv::Op::OpAtomicFlagClear:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1279, 3);
+		case spv::Op::OpImageSparseRead:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1282, 5);
+		case spv::Op::OpSizeOf:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1287, 3);
+		case spv::Op::OpTypePipeStorage:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1290, 1);
+		case spv::Op::OpConstantPipeStorage:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1291, 5);
+		case spv::Op::OpCreatePipeFromPipeStorage:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1296, 3);
+		case spv::Op::OpGetKernelLocalSizeForSubgroupCount:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1299, 7);
+		case spv::Op::OpGetKernelMaxNumSubgroups:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1306, 6);
+		case spv::Op::OpTypeNamedBarrier:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1312, 1);
+		case spv::Op::OpNamedBarrierInitialize:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1313, 3);
+		case spv::Op::OpMemoryNamedBarrier:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1316, 3);
+		case spv::Op::OpModuleProcessed:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1319, 1);
+		case spv::Op::OpExecutionModeId:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1320, 2);
+		case spv::Op::OpDecorateId:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1322, 2);
+		case spv::Op::OpGroupNonUniformElect:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1324, 3);
+		case spv::Op::OpGroupNonUniformAll:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1327, 4);
+		case spv::Op::OpGroupNonUniformAny:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1331, 4);
+		case spv::Op::OpGroupNonUniformAllEqual:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1335, 4);
+		case spv::Op::OpGroupNonUniformBroadcast:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1339, 5);
+		case spv::Op::OpGroupNonUniformBroadcastFirst:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1344, 4);
+		case spv::Op::OpGroupNonUniformBallot:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1348, 4);
+		case spv::Op::OpGroupNonUniformInverseBallot:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1352, 4);
+		case spv::Op::OpGroupNonUniformBallotBitExtract:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1356, 5);
+		case spv::Op::OpGroupNonUniformBallotBitCount:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1361, 5);
+		case spv::Op::OpGroupNonUniformBallotFindLSB:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1366, 4);
+		case spv::Op::OpGroupNonUniformBallotFindMSB:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1370, 4);
+		case spv::Op::OpGroupNonUniformShuffle:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1374, 5);
+		case spv::Op::OpGroupNonUniformShuffleXor:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1379, 5);
+		case spv::Op::OpGroupNonUniformShuffleUp:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1384, 5);
+		case spv::Op::OpGroupNonUniformShuffleDown:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1389, 5);
+		case spv::Op::OpGroupNonUniformIAdd:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1394, 6);
+		case spv::Op::OpGroupNonUniformFAdd:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1400, 6);
+		case spv::Op::OpGroupNonUniformIMul:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1406, 6);
+		case spv::Op::OpGroupNonUniformFMul:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1412, 6);
+		case spv::Op::OpGroupNonUniformSMin:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1418, 6);
+		case spv::Op::OpGroupNonUniformUMin:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1424, 6);
+		case spv::Op::OpGroupNonUniformFMin:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1430, 6);
+		case spv::Op::OpGroupNonUniformSMax:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1436, 6);
+		case spv::Op::OpGroupNonUniformUMax:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1442, 6);
+		case spv::Op::OpGroupNonUniformFMax:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1448, 6);
+		case spv::Op::OpGroupNonUniformBitwiseAnd:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1454, 6);
+		case spv::Op::OpGroupNonUniformBitwiseOr:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1460, 6);
+		case spv::Op::OpGroupNonUniformBitwiseXor:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1466, 6);
+		case spv::Op::OpGroupNonUniformLogicalAnd:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1472, 6);
+		case spv::Op::OpGroupNonUniformLogicalOr:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1478, 6);
+		case spv::Op::OpGroupNonUniformLogicalXor:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1484, 6);
+		case spv::Op::OpGroupNonUniformQuadBroadcast:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1490, 5);
+		case spv::Op::OpGroupNonUniformQuadSwap:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1495, 5);
+		case spv::Op::OpCopyLogical:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1500, 3);
+		case spv::Op::OpPtrEqual:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1503, 4);
+		case spv::Op::OpPtrNotEqual:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1507, 4);
+		case spv::Op::OpPtrDiff:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1511, 4);
+		case spv::Op::OpColorAttachmentReadEXT:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1515, 4);
+		case spv::Op::OpDepthAttachmentReadEXT:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1519, 3);
+		case spv::Op::OpStencilAttachmentReadEXT:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1522, 3);
+		case spv::Op::OpTypeUntypedPointerKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1525, 2);
+		case spv::Op::OpUntypedVariableKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1527, 5);
+		case spv::Op::OpUntypedAccessChainKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1532, 5);
+		case spv::Op::OpUntypedInBoundsAccessChainKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1537, 5);
+		case spv::Op::OpSubgroupBallotKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1542, 3);
+		case spv::Op::OpSubgroupFirstInvocationKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1545, 3);
+		case spv::Op::OpUntypedPtrAccessChainKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1548, 6);
+		case spv::Op::OpUntypedInBoundsPtrAccessChainKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1554, 6);
+		case spv::Op::OpUntypedArrayLengthKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1560, 5);
+		case spv::Op::OpUntypedPrefetchKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1565, 5);
+		case spv::Op::OpSubgroupAllKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1570, 3);
+		case spv::Op::OpSubgroupAnyKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1573, 3);
+		case spv::Op::OpSubgroupAllEqualKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1576, 3);
+		case spv::Op::OpGroupNonUniformRotateKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1579, 6);
+		case spv::Op::OpSubgroupReadInvocationKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1585, 4);
+		case spv::Op::OpExtInstWithForwardRefsKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1589, 5);
+		case spv::Op::OpTraceRayKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1594, 11);
+		case spv::Op::OpExecuteCallableKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1605, 2);
+		case spv::Op::OpConvertUToAccelerationStructureKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1607, 3);
+		case spv::Op::OpSDot:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1610, 5);
+		case spv::Op::OpUDot:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1615, 5);
+		case spv::Op::OpSUDot:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1620, 5);
+		case spv::Op::OpSDotAccSat:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1625, 6);
+		case spv::Op::OpUDotAccSat:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1631, 6);
+		case spv::Op::OpSUDotAccSat:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1637, 6);
+		case spv::Op::OpTypeCooperativeMatrixKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1643, 6);
+		case spv::Op::OpCooperativeMatrixLoadKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1649, 6);
+		case spv::Op::OpCooperativeMatrixStoreKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1655, 5);
+		case spv::Op::OpCooperativeMatrixMulAddKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1660, 6);
+		case spv::Op::OpCooperativeMatrixLengthKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1666, 3);
+		case spv::Op::OpConstantCompositeReplicateEXT:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1669, 3);
+		case spv::Op::OpSpecConstantCompositeReplicateEXT:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1672, 3);
+		case spv::Op::OpCompositeConstructReplicateEXT:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1675, 3);
+		case spv::Op::OpTypeRayQueryKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1678, 1);
+		case spv::Op::OpRayQueryInitializeKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1679, 8);
+		case spv::Op::OpRayQueryTerminateKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1687, 1);
+		case spv::Op::OpRayQueryGenerateIntersectionKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1688, 2);
+		case spv::Op::OpRayQueryConfirmIntersectionKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1690, 1);
+		case spv::Op::OpRayQueryProceedKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1691, 3);
+		case spv::Op::OpRayQueryGetIntersectionTypeKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1694, 4);
+		case spv::Op::OpImageSampleWeightedQCOM:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1698, 5);
+		case spv::Op::OpImageBoxFilterQCOM:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1703, 5);
+		case spv::Op::OpImageBlockMatchSSDQCOM:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1708, 7);
+		case spv::Op::OpImageBlockMatchSADQCOM:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1715, 7);
+		case spv::Op::OpImageBlockMatchWindowSSDQCOM:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1722, 7);
+		case spv::Op::OpImageBlockMatchWindowSADQCOM:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1729, 7);
+		case spv::Op::OpImageBlockMatchGatherSSDQCOM:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1736, 7);
+		case spv::Op::OpImageBlockMatchGatherSADQCOM:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1743, 7);
+		case spv::Op::OpGroupIAddNonUniformAMD:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1750, 5);
+		case spv::Op::OpGroupFAddNonUniformAMD:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1755, 5);
+		case spv::Op::OpGroupFMinNonUniformAMD:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1760, 5);
+		case spv::Op::OpGroupUMinNonUniformAMD:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1765, 5);
+		case spv::Op::OpGroupSMinNonUniformAMD:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1770, 5);
+		case spv::Op::OpGroupFMaxNonUniformAMD:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1775, 5);
+		case spv::Op::OpGroupUMaxNonUniformAMD:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1780, 5);
+		case spv::Op::OpGroupSMaxNonUniformAMD:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1785, 5);
+		case spv::Op::OpFragmentMaskFetchAMD:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1790, 4);
+		case spv::Op::OpFragmentFetchAMD:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1794, 5);
+		case spv::Op::OpReadClockKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1799, 3);
+		case spv::Op::OpAllocateNodePayloadsAMDX:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1802, 5);
+		case spv::Op::OpEnqueueNodePayloadsAMDX:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1807, 1);
+		case spv::Op::OpTypeNodePayloadArrayAMDX:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1808, 2);
+		case spv::Op::OpFinishWritingNodePayloadAMDX:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1810, 3);
+		case spv::Op::OpNodePayloadArrayLengthAMDX:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1813, 3);
+		case spv::Op::OpIsNodePayloadValidAMDX:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1816, 4);
+		case spv::Op::OpConstantStringAMDX:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1820, 2);
+		case spv::Op::OpSpecConstantStringAMDX:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1822, 2);
+		case spv::Op::OpGroupNonUniformQuadAllKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1824, 3);
+		case spv::Op::OpGroupNonUniformQuadAnyKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1827, 3);
+		case spv::Op::OpHitObjectRecordHitMotionNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1830, 14);
+		case spv::Op::OpHitObjectRecordHitWithIndexMotionNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1844, 13);
+		case spv::Op::OpHitObjectRecordMissMotionNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1857, 7);
+		case spv::Op::OpHitObjectGetWorldToObjectNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1864, 3);
+		case spv::Op::OpHitObjectGetObjectToWorldNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1867, 3);
+		case spv::Op::OpHitObjectGetObjectRayDirectionNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1870, 3);
+		case spv::Op::OpHitObjectGetObjectRayOriginNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1873, 3);
+		case spv::Op::OpHitObjectTraceRayMotionNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1876, 13);
+		case spv::Op::OpHitObjectGetShaderRecordBufferHandleNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1889, 3);
+		case spv::Op::OpHitObjectGetShaderBindingTableRecordIndexNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1892, 3);
+		case spv::Op::OpHitObjectRecordEmptyNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1895, 1);
+		case spv::Op::OpHitObjectTraceRayNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1896, 12);
+		case spv::Op::OpHitObjectRecordHitNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1908, 13);
+		case spv::Op::OpHitObjectRecordHitWithIndexNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1921, 12);
+		case spv::Op::OpHitObjectRecordMissNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1933, 6);
+		case spv::Op::OpHitObjectExecuteShaderNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1939, 2);
+		case spv::Op::OpHitObjectGetCurrentTimeNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1941, 3);
+		case spv::Op::OpHitObjectGetAttributesNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1944, 2);
+		case spv::Op::OpHitObjectGetHitKindNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1946, 3);
+		case spv::Op::OpHitObjectGetPrimitiveIndexNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1949, 3);
+		case spv::Op::OpHitObjectGetGeometryIndexNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1952, 3);
+		case spv::Op::OpHitObjectGetInstanceIdNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1955, 3);
+		case spv::Op::OpHitObjectGetInstanceCustomIndexNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1958, 3);
+		case spv::Op::OpHitObjectGetWorldRayDirectionNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1961, 3);
+		case spv::Op::OpHitObjectGetWorldRayOriginNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1964, 3);
+		case spv::Op::OpHitObjectGetRayTMaxNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1967, 3);
+		case spv::Op::OpHitObjectGetRayTMinNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1970, 3);
+		case spv::Op::OpHitObjectIsEmptyNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1973, 3);
+		case spv::Op::OpHitObjectIsHitNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1976, 3);
+		case spv::Op::OpHitObjectIsMissNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1979, 3);
+		case spv::Op::OpReorderThreadWithHitObjectNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1982, 3);
+		case spv::Op::OpReorderThreadWithHintNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1985, 2);
+		case spv::Op::OpTypeHitObjectNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1987, 1);
+		case spv::Op::OpImageSampleFootprintNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1988, 7);
+		case spv::Op::OpTypeCooperativeVectorNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1995, 3);
+		case spv::Op::OpCooperativeVectorMatrixMulNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(1998, 13);
+		case spv::Op::OpCooperativeVectorOuterProductAccumulateNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2011, 7);
+		case spv::Op::OpCooperativeVectorReduceSumAccumulateNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2018, 3);
+		case spv::Op::OpCooperativeVectorMatrixMulAddNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2021, 16);
+		case spv::Op::OpCooperativeMatrixConvertNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2037, 3);
+		case spv::Op::OpEmitMeshTasksEXT:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2040, 4);
+		case spv::Op::OpSetMeshOutputsEXT:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2044, 2);
+		case spv::Op::OpGroupNonUniformPartitionNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2046, 3);
+		case spv::Op::OpWritePackedPrimitiveIndices4x8NV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2049, 2);
+		case spv::Op::OpFetchMicroTriangleVertexPositionNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2051, 7);
+		case spv::Op::OpFetchMicroTriangleVertexBarycentricNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2058, 7);
+		case spv::Op::OpCooperativeVectorLoadNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2065, 5);
+		case spv::Op::OpCooperativeVectorStoreNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2070, 4);
+		case spv::Op::OpReportIntersectionKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2074, 4);
+		case spv::Op::OpTraceNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2078, 11);
+		case spv::Op::OpTraceMotionNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2089, 12);
+		case spv::Op::OpTraceRayMotionNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2101, 12);
+		case spv::Op::OpRayQueryGetIntersectionTriangleVertexPositionsKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2113, 4);
+		case spv::Op::OpTypeAccelerationStructureKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2117, 1);
+		case spv::Op::OpExecuteCallableNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2118, 2);
+		case spv::Op::OpRayQueryGetClusterIdNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2120, 4);
+		case spv::Op::OpHitObjectGetClusterIdNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2124, 3);
+		case spv::Op::OpTypeCooperativeMatrixNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2127, 5);
+		case spv::Op::OpCooperativeMatrixLoadNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2132, 6);
+		case spv::Op::OpCooperativeMatrixStoreNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2138, 5);
+		case spv::Op::OpCooperativeMatrixMulAddNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2143, 5);
+		case spv::Op::OpCooperativeMatrixLengthNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2148, 3);
+		case spv::Op::OpCooperativeMatrixReduceNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2151, 5);
+		case spv::Op::OpCooperativeMatrixLoadTensorNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2156, 7);
+		case spv::Op::OpCooperativeMatrixStoreTensorNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2163, 5);
+		case spv::Op::OpCooperativeMatrixPerElementOpNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2168, 5);
+		case spv::Op::OpTypeTensorLayoutNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2173, 3);
+		case spv::Op::OpTypeTensorViewNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2176, 4);
+		case spv::Op::OpCreateTensorLayoutNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2180, 2);
+		case spv::Op::OpTensorLayoutSetDimensionNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2182, 4);
+		case spv::Op::OpTensorLayoutSetStrideNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2186, 4);
+		case spv::Op::OpTensorLayoutSliceNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2190, 4);
+		case spv::Op::OpTensorLayoutSetClampValueNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2194, 4);
+		case spv::Op::OpCreateTensorViewNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2198, 2);
+		case spv::Op::OpTensorViewSetDimensionNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2200, 4);
+		case spv::Op::OpTensorViewSetStrideNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2204, 4);
+		case spv::Op::OpIsHelperInvocationEXT:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2208, 2);
+		case spv::Op::OpTensorViewSetClipNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2210, 7);
+		case spv::Op::OpTensorLayoutSetBlockSizeNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2217, 4);
+		case spv::Op::OpCooperativeMatrixTransposeNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2221, 3);
+		case spv::Op::OpConvertUToImageNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2224, 3);
+		case spv::Op::OpConvertUToSamplerNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2227, 3);
+		case spv::Op::OpConvertImageToUNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2230, 3);
+		case spv::Op::OpConvertSamplerToUNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2233, 3);
+		case spv::Op::OpConvertUToSampledImageNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2236, 3);
+		case spv::Op::OpConvertSampledImageToUNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2239, 3);
+		case spv::Op::OpSamplerImageAddressingModeNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2242, 1);
+		case spv::Op::OpRawAccessChainNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2243, 7);
+		case spv::Op::OpRayQueryGetIntersectionSpherePositionNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2250, 4);
+		case spv::Op::OpRayQueryGetIntersectionSphereRadiusNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2254, 4);
+		case spv::Op::OpRayQueryGetIntersectionLSSPositionsNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2258, 4);
+		case spv::Op::OpRayQueryGetIntersectionLSSRadiiNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2262, 4);
+		case spv::Op::OpRayQueryGetIntersectionLSSHitValueNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2266, 4);
+		case spv::Op::OpHitObjectGetSpherePositionNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2270, 3);
+		case spv::Op::OpHitObjectGetSphereRadiusNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2273, 3);
+		case spv::Op::OpHitObjectGetLSSPositionsNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2276, 3);
+		case spv::Op::OpHitObjectGetLSSRadiiNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2279, 3);
+		case spv::Op::OpHitObjectIsSphereHitNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2282, 3);
+		case spv::Op::OpHitObjectIsLSSHitNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2285, 3);
+		case spv::Op::OpRayQueryIsSphereHitNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2288, 4);
+		case spv::Op::OpRayQueryIsLSSHitNV:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2292, 4);
+		case spv::Op::OpSubgroupShuffleINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2296, 4);
+		case spv::Op::OpSubgroupShuffleDownINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2300, 5);
+		case spv::Op::OpSubgroupShuffleUpINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2305, 5);
+		case spv::Op::OpSubgroupShuffleXorINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2310, 4);
+		case spv::Op::OpSubgroupBlockReadINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2314, 3);
+		case spv::Op::OpSubgroupBlockWriteINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2317, 2);
+		case spv::Op::OpSubgroupImageBlockReadINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2319, 4);
+		case spv::Op::OpSubgroupImageBlockWriteINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2323, 3);
+		case spv::Op::OpSubgroupImageMediaBlockReadINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2326, 6);
+		case spv::Op::OpSubgroupImageMediaBlockWriteINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2332, 5);
+		case spv::Op::OpUCountLeadingZerosINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2337, 3);
+		case spv::Op::OpUCountTrailingZerosINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2340, 3);
+		case spv::Op::OpAbsISubINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2343, 4);
+		case spv::Op::OpAbsUSubINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2347, 4);
+		case spv::Op::OpIAddSatINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2351, 4);
+		case spv::Op::OpUAddSatINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2355, 4);
+		case spv::Op::OpIAverageINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2359, 4);
+		case spv::Op::OpUAverageINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2363, 4);
+		case spv::Op::OpIAverageRoundedINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2367, 4);
+		case spv::Op::OpUAverageRoundedINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2371, 4);
+		case spv::Op::OpISubSatINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2375, 4);
+		case spv::Op::OpUSubSatINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2379, 4);
+		case spv::Op::OpIMul32x16INTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2383, 4);
+		case spv::Op::OpUMul32x16INTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2387, 4);
+		case spv::Op::OpConstantFunctionPointerINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2391, 3);
+		case spv::Op::OpFunctionPointerCallINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2394, 3);
+		case spv::Op::OpAsmTargetINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2397, 2);
+		case spv::Op::OpAsmINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2399, 6);
+		case spv::Op::OpAsmCallINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2405, 4);
+		case spv::Op::OpAtomicFMinEXT:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2409, 6);
+		case spv::Op::OpAtomicFMaxEXT:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2415, 6);
+		case spv::Op::OpAssumeTrueKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2421, 1);
+		case spv::Op::OpExpectKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2422, 4);
+		case spv::Op::OpDecorateString:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2426, 2);
+		case spv::Op::OpMemberDecorateString:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2428, 3);
+		case spv::Op::OpVmeImageINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2431, 4);
+		case spv::Op::OpTypeVmeImageINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2435, 2);
+		case spv::Op::OpTypeAvcImePayloadINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2437, 1);
+		case spv::Op::OpTypeAvcRefPayloadINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2438, 1);
+		case spv::Op::OpTypeAvcSicPayloadINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2439, 1);
+		case spv::Op::OpTypeAvcMcePayloadINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2440, 1);
+		case spv::Op::OpTypeAvcMceResultINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2441, 1);
+		case spv::Op::OpTypeAvcImeResultINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2442, 1);
+		case spv::Op::OpTypeAvcImeResultSingleReferenceStreamoutINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2443, 1);
+		case spv::Op::OpTypeAvcImeResultDualReferenceStreamoutINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2444, 1);
+		case spv::Op::OpTypeAvcImeSingleReferenceStreaminINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2445, 1);
+		case spv::Op::OpTypeAvcImeDualReferenceStreaminINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2446, 1);
+		case spv::Op::OpTypeAvcRefResultINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2447, 1);
+		case spv::Op::OpTypeAvcSicResultINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2448, 1);
+		case spv::Op::OpSubgroupAvcMceGetDefaultInterBaseMultiReferencePenaltyINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2449, 4);
+		case spv::Op::OpSubgroupAvcMceSetInterBaseMultiReferencePenaltyINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2453, 4);
+		case spv::Op::OpSubgroupAvcMceGetDefaultInterShapePenaltyINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2457, 4);
+		case spv::Op::OpSubgroupAvcMceSetInterShapePenaltyINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2461, 4);
+		case spv::Op::OpSubgroupAvcMceGetDefaultInterDirectionPenaltyINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2465, 4);
+		case spv::Op::OpSubgroupAvcMceSetInterDirectionPenaltyINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2469, 4);
+		case spv::Op::OpSubgroupAvcMceGetDefaultIntraLumaShapePenaltyINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2473, 4);
+		case spv::Op::OpSubgroupAvcMceGetDefaultInterMotionVectorCostTableINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2477, 4);
+		case spv::Op::OpSubgroupAvcMceGetDefaultHighPenaltyCostTableINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2481, 2);
+		case spv::Op::OpSubgroupAvcMceGetDefaultMediumPenaltyCostTableINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2483, 2);
+		case spv::Op::OpSubgroupAvcMceGetDefaultLowPenaltyCostTableINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2485, 2);
+		case spv::Op::OpSubgroupAvcMceSetMotionVectorCostFunctionINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2487, 6);
+		case spv::Op::OpSubgroupAvcMceGetDefaultIntraLumaModePenaltyINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2493, 4);
+		case spv::Op::OpSubgroupAvcMceGetDefaultNonDcLumaIntraPenaltyINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2497, 2);
+		case spv::Op::OpSubgroupAvcMceGetDefaultIntraChromaModeBasePenaltyINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2499, 2);
+		case spv::Op::OpSubgroupAvcMceSetAcOnlyHaarINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2501, 3);
+		case spv::Op::OpSubgroupAvcMceSetSourceInterlacedFieldPolarityINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2504, 4);
+		case spv::Op::OpSubgroupAvcMceSetSingleReferenceInterlacedFieldPolarityINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2508, 4);
+		case spv::Op::OpSubgroupAvcMceSetDualReferenceInterlacedFieldPolaritiesINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2512, 5);
+		case spv::Op::OpSubgroupAvcMceConvertToImePayloadINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2517, 3);
+		case spv::Op::OpSubgroupAvcMceConvertToImeResultINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2520, 3);
+		case spv::Op::OpSubgroupAvcMceConvertToRefPayloadINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2523, 3);
+		case spv::Op::OpSubgroupAvcMceConvertToRefResultINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2526, 3);
+		case spv::Op::OpSubgroupAvcMceConvertToSicPayloadINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2529, 3);
+		case spv::Op::OpSubgroupAvcMceConvertToSicResultINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2532, 3);
+		case spv::Op::OpSubgroupAvcMceGetMotionVectorsINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2535, 3);
+		case spv::Op::OpSubgroupAvcMceGetInterDistortionsINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2538, 3);
+		case spv::Op::OpSubgroupAvcMceGetBestInterDistortionsINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2541, 3);
+		case spv::Op::OpSubgroupAvcMceGetInterMajorShapeINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2544, 3);
+		case spv::Op::OpSubgroupAvcMceGetInterMinorShapeINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2547, 3);
+		case spv::Op::OpSubgroupAvcMceGetInterDirectionsINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2550, 3);
+		case spv::Op::OpSubgroupAvcMceGetInterMotionVectorCountINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2553, 3);
+		case spv::Op::OpSubgroupAvcMceGetInterReferenceIdsINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2556, 3);
+		case spv::Op::OpSubgroupAvcMceGetInterReferenceInterlacedFieldPolaritiesINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2559, 5);
+		case spv::Op::OpSubgroupAvcImeInitializeINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2564, 5);
+		case spv::Op::OpSubgroupAvcImeSetSingleReferenceINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2569, 5);
+		case spv::Op::OpSubgroupAvcImeSetDualReferenceINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2574, 6);
+		case spv::Op::OpSubgroupAvcImeRefWindowSizeINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2580, 4);
+		case spv::Op::OpSubgroupAvcImeAdjustRefOffsetINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2584, 6);
+		case spv::Op::OpSubgroupAvcImeConvertToMcePayloadINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2590, 3);
+		case spv::Op::OpSubgroupAvcImeSetMaxMotionVectorCountINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2593, 4);
+		case spv::Op::OpSubgroupAvcImeSetUnidirectionalMixDisableINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2597, 3);
+		case spv::Op::OpSubgroupAvcImeSetEarlySearchTerminationThresholdINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2600, 4);
+		case spv::Op::OpSubgroupAvcImeSetWeightedSadINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2604, 4);
+		case spv::Op::OpSubgroupAvcImeEvaluateWithSingleReferenceINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2608, 5);
+		case spv::Op::OpSubgroupAvcImeEvaluateWithDualReferenceINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2613, 6);
+		case spv::Op::OpSubgroupAvcImeEvaluateWithSingleReferenceStreaminINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2619, 6);
+		case spv::Op::OpSubgroupAvcImeEvaluateWithDualReferenceStreaminINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2625, 7);
+		case spv::Op::OpSubgroupAvcImeEvaluateWithSingleReferenceStreamoutINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2632, 5);
+		case spv::Op::OpSubgroupAvcImeEvaluateWithDualReferenceStreamoutINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2637, 6);
+		case spv::Op::OpSubgroupAvcImeEvaluateWithSingleReferenceStreaminoutINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2643, 6);
+		case spv::Op::OpSubgroupAvcImeEvaluateWithDualReferenceStreaminoutINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2649, 7);
+		case spv::Op::OpSubgroupAvcImeConvertToMceResultINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2656, 3);
+		case spv::Op::OpSubgroupAvcImeGetSingleReferenceStreaminINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2659, 3);
+		case spv::Op::OpSubgroupAvcImeGetDualReferenceStreaminINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2662, 3);
+		case spv::Op::OpSubgroupAvcImeStripSingleReferenceStreamoutINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2665, 3);
+		case spv::Op::OpSubgroupAvcImeStripDualReferenceStreamoutINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2668, 3);
+		case spv::Op::OpSubgroupAvcImeGetStreamoutSingleReferenceMajorShapeMotionVectorsINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2671, 4);
+		case spv::Op::OpSubgroupAvcImeGetStreamoutSingleReferenceMajorShapeDistortionsINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2675, 4);
+		case spv::Op::OpSubgroupAvcImeGetStreamoutSingleReferenceMajorShapeReferenceIdsINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2679, 4);
+		case spv::Op::OpSubgroupAvcImeGetStreamoutDualReferenceMajorShapeMotionVectorsINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2683, 5);
+		case spv::Op::OpSubgroupAvcImeGetStreamoutDualReferenceMajorShapeDistortionsINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2688, 5);
+		case spv::Op::OpSubgroupAvcImeGetStreamoutDualReferenceMajorShapeReferenceIdsINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2693, 5);
+		case spv::Op::OpSubgroupAvcImeGetBorderReachedINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2698, 4);
+		case spv::Op::OpSubgroupAvcImeGetTruncatedSearchIndicationINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2702, 3);
+		case spv::Op::OpSubgroupAvcImeGetUnidirectionalEarlySearchTerminationINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2705, 3);
+		case spv::Op::OpSubgroupAvcImeGetWeightingPatternMinimumMotionVectorINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2708, 3);
+		case spv::Op::OpSubgroupAvcImeGetWeightingPatternMinimumDistortionINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2711, 3);
+		case spv::Op::OpSubgroupAvcFmeInitializeINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2714, 9);
+		case spv::Op::OpSubgroupAvcBmeInitializeINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2723, 10);
+		case spv::Op::OpSubgroupAvcRefConvertToMcePayloadINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2733, 3);
+		case spv::Op::OpSubgroupAvcRefSetBidirectionalMixDisableINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2736, 3);
+		case spv::Op::OpSubgroupAvcRefSetBilinearFilterEnableINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2739, 3);
+		case spv::Op::OpSubgroupAvcRefEvaluateWithSingleReferenceINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2742, 5);
+		case spv::Op::OpSubgroupAvcRefEvaluateWithDualReferenceINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2747, 6);
+		case spv::Op::OpSubgroupAvcRefEvaluateWithMultiReferenceINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2753, 5);
+		case spv::Op::OpSubgroupAvcRefEvaluateWithMultiReferenceInterlacedINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2758, 6);
+		case spv::Op::OpSubgroupAvcRefConvertToMceResultINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2764, 3);
+		case spv::Op::OpSubgroupAvcSicInitializeINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2767, 3);
+		case spv::Op::OpSubgroupAvcSicConfigureSkcINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2770, 8);
+		case spv::Op::OpSubgroupAvcSicConfigureIpeLumaINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2778, 10);
+		case spv::Op::OpSubgroupAvcSicConfigureIpeLumaChromaINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2788, 13);
+		case spv::Op::OpSubgroupAvcSicGetMotionVectorMaskINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2801, 4);
+		case spv::Op::OpSubgroupAvcSicConvertToMcePayloadINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2805, 3);
+		case spv::Op::OpSubgroupAvcSicSetIntraLumaShapePenaltyINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2808, 4);
+		case spv::Op::OpSubgroupAvcSicSetIntraLumaModeCostFunctionINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2812, 6);
+		case spv::Op::OpSubgroupAvcSicSetIntraChromaModeCostFunctionINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2818, 4);
+		case spv::Op::OpSubgroupAvcSicSetBilinearFilterEnableINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2822, 3);
+		case spv::Op::OpSubgroupAvcSicSetSkcForwardTransformEnableINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2825, 4);
+		case spv::Op::OpSubgroupAvcSicSetBlockBasedRawSkipSadINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2829, 4);
+		case spv::Op::OpSubgroupAvcSicEvaluateIpeINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2833, 4);
+		case spv::Op::OpSubgroupAvcSicEvaluateWithSingleReferenceINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2837, 5);
+		case spv::Op::OpSubgroupAvcSicEvaluateWithDualReferenceINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2842, 6);
+		case spv::Op::OpSubgroupAvcSicEvaluateWithMultiReferenceINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2848, 5);
+		case spv::Op::OpSubgroupAvcSicEvaluateWithMultiReferenceInterlacedINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2853, 6);
+		case spv::Op::OpSubgroupAvcSicConvertToMceResultINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2859, 3);
+		case spv::Op::OpSubgroupAvcSicGetIpeLumaShapeINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2862, 3);
+		case spv::Op::OpSubgroupAvcSicGetBestIpeLumaDistortionINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2865, 3);
+		case spv::Op::OpSubgroupAvcSicGetBestIpeChromaDistortionINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2868, 3);
+		case spv::Op::OpSubgroupAvcSicGetPackedIpeLumaModesINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2871, 3);
+		case spv::Op::OpSubgroupAvcSicGetIpeChromaModeINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2874, 3);
+		case spv::Op::OpSubgroupAvcSicGetPackedSkcLumaCountThresholdINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2877, 3);
+		case spv::Op::OpSubgroupAvcSicGetPackedSkcLumaSumThresholdINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2880, 3);
+		case spv::Op::OpSubgroupAvcSicGetInterRawSadsINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2883, 3);
+		case spv::Op::OpVariableLengthArrayINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2886, 3);
+		case spv::Op::OpSaveMemoryINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2889, 2);
+		case spv::Op::OpRestoreMemoryINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2891, 1);
+		case spv::Op::OpArbitraryFloatSinCosPiINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2892, 8);
+		case spv::Op::OpArbitraryFloatCastINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2900, 8);
+		case spv::Op::OpArbitraryFloatCastFromIntINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2908, 8);
+		case spv::Op::OpArbitraryFloatCastToIntINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2916, 8);
+		case spv::Op::OpArbitraryFloatAddINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2924, 10);
+		case spv::Op::OpArbitraryFloatSubINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2934, 10);
+		case spv::Op::OpArbitraryFloatMulINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2944, 10);
+		case spv::Op::OpArbitraryFloatDivINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2954, 10);
+		case spv::Op::OpArbitraryFloatGTINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2964, 6);
+		case spv::Op::OpArbitraryFloatGEINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2970, 6);
+		case spv::Op::OpArbitraryFloatLTINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2976, 6);
+		case spv::Op::OpArbitraryFloatLEINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2982, 6);
+		case spv::Op::OpArbitraryFloatEQINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2988, 6);
+		case spv::Op::OpArbitraryFloatRecipINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(2994, 8);
+		case spv::Op::OpArbitraryFloatRSqrtINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3002, 8);
+		case spv::Op::OpArbitraryFloatCbrtINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3010, 8);
+		case spv::Op::OpArbitraryFloatHypotINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3018, 10);
+		case spv::Op::OpArbitraryFloatSqrtINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3028, 8);
+		case spv::Op::OpArbitraryFloatLogINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3036, 8);
+		case spv::Op::OpArbitraryFloatLog2INTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3044, 8);
+		case spv::Op::OpArbitraryFloatLog10INTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3052, 8);
+		case spv::Op::OpArbitraryFloatLog1pINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3060, 8);
+		case spv::Op::OpArbitraryFloatExpINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3068, 8);
+		case spv::Op::OpArbitraryFloatExp2INTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3076, 8);
+		case spv::Op::OpArbitraryFloatExp10INTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3084, 8);
+		case spv::Op::OpArbitraryFloatExpm1INTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3092, 8);
+		case spv::Op::OpArbitraryFloatSinINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3100, 8);
+		case spv::Op::OpArbitraryFloatCosINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3108, 8);
+		case spv::Op::OpArbitraryFloatSinCosINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3116, 8);
+		case spv::Op::OpArbitraryFloatSinPiINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3124, 8);
+		case spv::Op::OpArbitraryFloatCosPiINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3132, 8);
+		case spv::Op::OpArbitraryFloatASinINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3140, 8);
+		case spv::Op::OpArbitraryFloatASinPiINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3148, 8);
+		case spv::Op::OpArbitraryFloatACosINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3156, 8);
+		case spv::Op::OpArbitraryFloatACosPiINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3164, 8);
+		case spv::Op::OpArbitraryFloatATanINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3172, 8);
+		case spv::Op::OpArbitraryFloatATanPiINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3180, 8);
+		case spv::Op::OpArbitraryFloatATan2INTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3188, 10);
+		case spv::Op::OpArbitraryFloatPowINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3198, 10);
+		case spv::Op::OpArbitraryFloatPowRINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3208, 10);
+		case spv::Op::OpArbitraryFloatPowNINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3218, 10);
+		case spv::Op::OpLoopControlINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3228, 1);
+		case spv::Op::OpAliasDomainDeclINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3229, 2);
+		case spv::Op::OpAliasScopeDeclINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3231, 3);
+		case spv::Op::OpAliasScopeListDeclINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3234, 2);
+		case spv::Op::OpFixedSqrtINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3236, 8);
+		case spv::Op::OpFixedRecipINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3244, 8);
+		case spv::Op::OpFixedRsqrtINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3252, 8);
+		case spv::Op::OpFixedSinINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3260, 8);
+		case spv::Op::OpFixedCosINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3268, 8);
+		case spv::Op::OpFixedSinCosINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3276, 8);
+		case spv::Op::OpFixedSinPiINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3284, 8);
+		case spv::Op::OpFixedCosPiINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3292, 8);
+		case spv::Op::OpFixedSinCosPiINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3300, 8);
+		case spv::Op::OpFixedLogINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3308, 8);
+		case spv::Op::OpFixedExpINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3316, 8);
+		case spv::Op::OpPtrCastToCrossWorkgroupINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3324, 3);
+		case spv::Op::OpCrossWorkgroupCastToPtrINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3327, 3);
+		case spv::Op::OpReadPipeBlockingINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3330, 4);
+		case spv::Op::OpWritePipeBlockingINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3334, 4);
+		case spv::Op::OpFPGARegINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3338, 3);
+		case spv::Op::OpRayQueryGetRayTMinKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3341, 3);
+		case spv::Op::OpRayQueryGetRayFlagsKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3344, 3);
+		case spv::Op::OpRayQueryGetIntersectionTKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3347, 4);
+		case spv::Op::OpRayQueryGetIntersectionInstanceCustomIndexKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3351, 4);
+		case spv::Op::OpRayQueryGetIntersectionInstanceIdKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3355, 4);
+		case spv::Op::OpRayQueryGetIntersectionInstanceShaderBindingTableRecordOffsetKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3359, 4);
+		case spv::Op::OpRayQueryGetIntersectionGeometryIndexKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3363, 4);
+		case spv::Op::OpRayQueryGetIntersectionPrimitiveIndexKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3367, 4);
+		case spv::Op::OpRayQueryGetIntersectionBarycentricsKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3371, 4);
+		case spv::Op::OpRayQueryGetIntersectionFrontFaceKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3375, 4);
+		case spv::Op::OpRayQueryGetIntersectionCandidateAABBOpaqueKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3379, 3);
+		case spv::Op::OpRayQueryGetIntersectionObjectRayDirectionKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3382, 4);
+		case spv::Op::OpRayQueryGetIntersectionObjectRayOriginKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3386, 4);
+		case spv::Op::OpRayQueryGetWorldRayDirectionKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3390, 3);
+		case spv::Op::OpRayQueryGetWorldRayOriginKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3393, 3);
+		case spv::Op::OpRayQueryGetIntersectionObjectToWorldKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3396, 4);
+		case spv::Op::OpRayQueryGetIntersectionWorldToObjectKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3400, 4);
+		case spv::Op::OpAtomicFAddEXT:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3404, 6);
+		case spv::Op::OpTypeBufferSurfaceINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3410, 2);
+		case spv::Op::OpTypeStructContinuedINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3412, 1);
+		case spv::Op::OpConstantCompositeContinuedINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3413, 1);
+		case spv::Op::OpSpecConstantCompositeContinuedINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3414, 1);
+		case spv::Op::OpCompositeConstructContinuedINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3415, 3);
+		case spv::Op::OpConvertFToBF16INTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3418, 3);
+		case spv::Op::OpConvertBF16ToFINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3421, 3);
+		case spv::Op::OpControlBarrierArriveINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3424, 3);
+		case spv::Op::OpControlBarrierWaitINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3427, 3);
+		case spv::Op::OpArithmeticFenceEXT:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3430, 3);
+		case spv::Op::OpTaskSequenceCreateINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3433, 7);
+		case spv::Op::OpTaskSequenceAsyncINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3440, 2);
+		case spv::Op::OpTaskSequenceGetINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3442, 3);
+		case spv::Op::OpTaskSequenceReleaseINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3445, 1);
+		case spv::Op::OpTypeTaskSequenceINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3446, 1);
+		case spv::Op::OpSubgroupBlockPrefetchINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3447, 3);
+		case spv::Op::OpSubgroup2DBlockLoadINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3450, 10);
+		case spv::Op::OpSubgroup2DBlockLoadTransformINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3460, 10);
+		case spv::Op::OpSubgroup2DBlockLoadTransposeINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3470, 10);
+		case spv::Op::OpSubgroup2DBlockPrefetchINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3480, 9);
+		case spv::Op::OpSubgroup2DBlockStoreINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3489, 10);
+		case spv::Op::OpSubgroupMatrixMultiplyAccumulateINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3499, 7);
+		case spv::Op::OpBitwiseFunctionINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3506, 6);
+		case spv::Op::OpGroupIMulKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3512, 5);
+		case spv::Op::OpGroupFMulKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3517, 5);
+		case spv::Op::OpGroupBitwiseAndKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3522, 5);
+		case spv::Op::OpGroupBitwiseOrKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3527, 5);
+		case spv::Op::OpGroupBitwiseXorKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3532, 5);
+		case spv::Op::OpGroupLogicalAndKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3537, 5);
+		case spv::Op::OpGroupLogicalOrKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3542, 5);
+		case spv::Op::OpGroupLogicalXorKHR:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3547, 5);
+		case spv::Op::OpRoundFToTF32INTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3552, 3);
+		case spv::Op::OpMaskedGatherINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3555, 6);
+		case spv::Op::OpMaskedScatterINTEL:
+			return std::span{OPERAND_DESCRIPTIONS}.subspan(3561, 4);
+		default:
+			return {};
+		}
+	}
+
+	// Decoded instruction, words includes the header word
+	struct Instruction
+	{
+		spv::Op opcode{};
+		uint16_t wordCount = 0;
+		std::span<const uint32_t> words;
+
+		constexpr std::span<const uint32_t> operands() const
+		{
+			return words.subspan(1);
+		}
+
+		// Returns 0 when the instruction does not define an id
+		constexpr uint32_t getResultId() const
+		{
+			auto descriptions = getInstructionOperands(opcode);
+			for (size_t i = 0; i < descriptions.size() && i < 2; i++)
+			{
+				if (descriptions[i].kind == OperandKind::IdResult)
+				{
+					return i + 1 < words.size() ? words[i + 1] : 0;
+				}
+			}
+			return 0;
+		}
+
+		// Returns 0 when the instruction has no result type
+		constexpr uint32_t getResultType() const
+		{
+			auto descriptions = getInstructionOperands(opcode);
+			if (!descriptions.empty() && descriptions[0].kind == OperandKind::IdResultType && words.size() > 1)
+			{
+				return words[1];
+			}
+			return 0;
+		}
+	};
+
+	// Forward iterator over the instructions of a code span, a malformed word count ends the iteration
+	class InstructionIterator
+	{
+	  protected:
+		std::span<const uint32_t> m_code;
+		size_t m_offset = 0;
+
+		constexpr void skipMalformed()
+		{
+			if (m_offset >= m_code.size())
+			{
+				m_offset = m_code.size();
+				return;
+			}
+
+			const size_t wordCount = m_code[m_offset] >> 16;
+			if (wordCount == 0 || wordCount > m_code.size() - m_offset)
+			{
+				m_offset = m_code.size();
+			}
+		}
+
+	  public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = Instruction;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+		using reference = Instruction;
+
+		constexpr InstructionIterator() = default;
+
+		constexpr InstructionIterator(std::span<const uint32_t> code, size_t offset)
+			: m_code(code), m_offset(offset)
+		{
+			skipMalformed();
+		}
+
+		constexpr Instruction operator*() const
+		{
+			const uint32_t header = m_code[m_offset];
+			const auto wordCount = static_cast<uint16_t>(header >> 16);
+			return {static_cast<spv::Op>(header & 0xffff), wordCount, m_code.subspan(m_offset, wordCount)};
+		}
+
+		constexpr InstructionIterator& operator++()
+		{
+			m_offset += m_code[m_offset] >> 16;
+			skipMalformed();
+			return *this;
+		}
+
+		constexpr InstructionIterator operator++(int)
+		{
+			InstructionIterator it = *this;
+			++*this;
+			return it;
+		}
+
+		constexpr bool operator==(const InstructionIterator& other) const
+		{
+			return m_offset == other.m_offset;
+		}
+
+		// Word offset of the current instruction in the code span
+		constexpr size_t getOffset() const
+		{
+			return m_offset;
+		}
+	};
+
+	// Read-only view over a module, iterates its instructions after the header
+	class ModuleReader
+	{
+	  protected:
+		std::span<const uint32_t> m_code;
+
+	  public:
+		constexpr explicit ModuleReader(std::span<const uint32_t> code)
+			: m_code(code)
+		{
+			if (code.size() < HEADER_SIZE || code[0] != spv::MagicNumber)
+			{
+				throw std::invalid_argument("dynspv: not a SPIR-V module");
+			}
+		}
+
+		constexpr uint32_t getVersion() const
+		{
+			return m_code[1];
+		}
+
+		constexpr uint32_t getBound() const
+		{
+			return m_code[BOUND_INDEX];
+		}
+
+		constexpr InstructionIterator begin() const
+		{
+			return {m_code, HEADER_SIZE};
+		}
+
+		constexpr InstructionIterator end() const
+		{
+			return {m_code, m_code.size()};
+		}
+	};
+
+	template<typename TVisitor>
+	constexpr size_t visitOperands(std::span<const OperandDescription> descriptions, std::span<const uint32_t> words, size_t offset, TVisitor& visitor);
+
+	// Visits the operand of kind at words[offset] followed by its enumerant parameters, returns the offset after them
+	template<typename TVisitor>
+	constexpr size_t visitOperand(OperandKind kind, std::span<const uint32_t> words, size_t offset, TVisitor& visitor)
+	{
+		const OperandCategory category = getOperandCategory(kind);
+		if (category == OperandCategory::Composite)
+		{
+			for (auto&& base : getCompositeBases(kind))
+			{
+				offset = visitOperand(base.kind, words, offset, visitor);
+			}
+			return offset;
+		}
+
+		if (offset >= words.size())
+		{
+			return offset;
+		}
+
+		size_t count = 1;
+		if (kind == OperandKind::LiteralString)
+		{
+			// The string ends with the first word holding a zero byte
+			while (offset + count <= words.size())
+			{
+				const uint32_t word = words[offset + count - 1];
+				if (((word - 0x01010101) & ~word & 0x80808080) != 0)
+				{
+					break;
+				}
+				count++;
+			}
+		}
+		else if (kind == OperandKind::LiteralContextDependentNumber)
+		{
+			// Width depends on the result type, it is always the last operand
+			count = words.size() - offset;
+		}
+		count = std::min(count, words.size() - offset);
+
+		const uint32_t value = words[offset];
+		visitor(kind, words.subspan(offset, count));
+		offset += count;
+
+		if (category == OperandCategory::ValueEnum)
+		{
+			offset = visitOperands(getEnumerantParameters(kind, value), words, offset, visitor);
+		}
+		else if (category == OperandCategory::BitEnum)
+		{
+			// Parameters follow in the order of the bits, lowest first
+			for (uint32_t bits = value; bits != 0; bits &= bits - 1)
+			{
+				offset = visitOperands(getEnumerantParameters(kind, bits & (~bits + 1)), words, offset, visitor);
+			}
+		}
+
+		return offset;
+	}
+
+	template<typename TVisitor>
+	constexpr size_t visitOperands(std::span<const OperandDescription> descriptions, std::span<const uint32_t> words, size_t offset, TVisitor& visitor)
+	{
+		for (auto&& description : descriptions)
+		{
+			switch (description.quantifier)
+			{
+			case OperandQuantifier::One:
+				offset = visitOperand(description.kind, words, offset, visitor);
+				break;
+			case OperandQuantifier::Optional:
+				if (offset < words.size())
+				{
+					offset = visitOperand(description.kind, words, offset, visitor);
+				}
+				break;
+			case OperandQuantifier::Variadic:
+				while (offset < words.size())
+				{
+					offset = visitOperand(description.kind, words, offset, visitor);
+				}
+				break;
+			}
+		}
+		return offset;
+	}
+
+	// OpSwitch literals are as wide as the selector type, a 0 width is taken from the layout when it is unambiguous
+	constexpr size_t getSwitchLiteralWords(const Instruction& instruction, size_t literalWords)
+	{
+		if (literalWords != 0)
+		{
+			return literalWords;
+		}
+
+		const size_t targetWords = instruction.words.size() < 3 ? 0 : instruction.words.size() - 3;
+		if (targetWords % 2 == 0 && (targetWords % 3 != 0 || targetWords == 0))
+		{
+			return 1;
+		}
+		if (targetWords % 3 == 0 && targetWords % 2 != 0)
+		{
+			return 2;
+		}
+		throw std::invalid_argument("dynspv: OpSwitch literal width depends on the selector type");
+	}
+
+	// Calls visitor(OperandKind, std::span<const uint32_t>) for every operand of instruction described by the grammar.
+	// switchLiteralWords is the width of the OpSwitch literals, see ValueTypes. When it is 0 the width is taken from the
+	// layout, std::invalid_argument is thrown if the layout fits both 32 and 64-bit literals.
+	template<typename TVisitor>
+	constexpr void forEachOperand(const Instruction& instruction, TVisitor&& visitor, size_t switchLiteralWords = 0)
+	{
+		const std::span<const uint32_t> words = instruction.words;
+		if (instruction.opcode == spv::Op::OpSwitch)
+		{
+			const size_t literalWords = getSwitchLiteralWords(instruction, switchLiteralWords);
+			for (size_t offset = 1; offset < words.size() && offset < 3; offset++)
+			{
+				visitor(OperandKind::IdRef, words.subspan(offset, 1));
+			}
+			for (size_t offset = 3; offset + literalWords < words.size(); offset += literalWords + 1)
+			{
+				visitor(OperandKind::LiteralInteger, words.subspan(offset, literalWords));
+				visitor(OperandKind::IdRef, words.subspan(offset + literalWords, 1));
+			}
+			return;
+		}
+
+		const size_t offset = visitOperands(getInstructionOperands(instruction.opcode), words, 1, visitor);
+
+		// The operands of the embedded opcode follow, without its result type and result id
+		if (instruction.opcode == spv::Op::OpSpecConstantOp && offset == 4)
+		{
+			auto descriptions = getInstructionOperands(static_cast<spv::Op>(words[3]));
+			while (!descriptions.empty() && (descriptions[0].kind == OperandKind::IdResultType || descriptions[0].kind == OperandKind::IdResult))
+			{
+				descriptions = descriptions.subspan(1);
+			}
+			visitOperands(descriptions, words, offset, visitor);
+		}
+	}
+
+	// Result types of the values of a module, the width of OpSwitch literals depends on the type of the selector.
+	// Fed every instruction in module order, the selector and its type are always declared before the switch.
+	class ValueTypes
+	{
+	  protected:
+		std::vector<uint32_t> m_resultTypes;
+		// Words of the literals of each OpTypeInt id, 0 for other ids
+		std::vector<uint8_t> m_literalWords;
+
+	  public:
+		explicit ValueTypes(uint32_t bound)
+			: m_resultTypes(bound), m_literalWords(bound)
+		{
+		}
+
+		void add(const Instruction& instruction)
+		{
+			if (instruction.opcode == spv::Op::OpTypeInt && instruction.words.size() > 2 && instruction.words[1] < m_literalWords.size())
+			{
+				m_literalWords[instruction.words[1]] = instruction.words[2] > 32 ? 2 : 1;
+			}
+
+			const uint32_t resultType = instruction.getResultType();
+			const uint32_t resultId = instruction.getResultId();
+			if (resultType != 0 && resultId < m_resultTypes.size())
+			{
+				m_resultTypes[resultId] = resultType;
+			}
+		}
+
+		// Returns 0 for anything but an OpSwitch whose selector type is known
+		size_t getSwitchLiteralWords(const Instruction& instruction) const
+		{
+			if (instruction.opcode != spv::Op::OpSwitch || instruction.words.size() < 2 || instruction.words[1] >= m_resultTypes.size())
+			{
+				return 0;
+			}
+
+			const uint32_t type = m_resultTypes[instruction.words[1]];
+			return type < m_literalWords.size() ? m_literalWords[type] : 0;
+		}
+	};
+
+	// Decodes a literal string operand, the words hold its bytes in little-endian order up to the first zero byte
+	constexpr std::string decodeString(std::span<const uint32_t> words)
+	{
+		std::string string;
+		for (uint32_t word : words)
+		{
+			for (size_t i = 0; i < sizeof(uint32_t); i++)
+			{
+				const auto byte = static_cast<char>((word >> (i * 8)) & 0xff);
+				if (byte == '\0')
+				{
+					return string;
+				}
+				string += byte;
+			}
+		}
+		return string;
+	}
+
+	// Extended instruction sets whose instructions only take id operands, the core grammar types every OpExtInst operand
+	// as an IdRef, which is wrong for sets mixing in literals like OpenCL.std
+	constexpr bool hasOnlyIdOperands(std::string_view set)
+	{
+		return set == "GLSL.std.450" || set.starts_with("NonSemantic.");
+	}
+
+	// Id-only extended instruction sets imported by a module, fed every instruction in module order
+	class ExtInstSets
+	{
+	  protected:
+		std::vector<uint32_t> m_idOnlySets;
+
+	  public:
+		void add(const Instruction& instruction)
+		{
+			if (instruction.opcode == spv::Op::OpExtInstImport && instruction.words.size() > 2 &&
+				hasOnlyIdOperands(decodeString(instruction.words.subspan(2))))
+			{
+				m_idOnlySets.push_back(instruction.words[1]);
+			}
+		}
+
+		// Throws std::invalid_argument for an extended instruction whose operands cannot be told apart from literals
+		void checkOperands(const Instruction& instruction) const
+		{
+			if (instruction.opcode != spv::Op::OpExtInst && instruction.opcode != spv::Op::OpExtInstWithForwardRefsKHR)
+			{
+				return;
+			}
+			if (instruction.words.size() < 4 || std::find(m_idOnlySets.begin(), m_idOnlySets.end(), instruction.words[3]) == m_idOnlySets.end())
+			{
+				throw std::invalid_argument("dynspv: extended instruction set with literal operands");
+			}
+		}
+	};
+
+	// Layout section of a module-level instruction, OpLine and OpNoLine belong to the section they appear in
+	constexpr ModuleSection getModuleSection(spv::Op opcode)
+	{
+		switch (opcode)
+		{
+		case spv::Op::OpCapability:
+			return ModuleSection::Capabilities;
+		case spv::Op::OpExtension:
+			return ModuleSection::Extensions;
+		case spv::Op::OpExtInstImport:
+			return ModuleSection::ExtInstImports;
+		case spv::Op::OpMemoryModel:
+			return ModuleSection::MemoryModel;
+		case spv::Op::OpEntryPoint:
+			return ModuleSection::EntryPoints;
+		case spv::Op::OpExecutionMode:
+		case spv::Op::OpExecutionModeId:
+			return ModuleSection::ExecutionModes;
+		case spv::Op::OpString:
+		case spv::Op::OpSource:
+		case spv::Op::OpSourceContinued:
+		case spv::Op::OpSourceExtension:
+			return ModuleSection::DebugStrings;
+		case spv::Op::OpName:
+		case spv::Op::OpMemberName:
+			return ModuleSection::DebugNames;
+		case spv::Op::OpModuleProcessed:
+			return ModuleSection::DebugModuleProcessed;
+		case spv::Op::OpDecorate:
+		case spv::Op::OpMemberDecorate:
+		case spv::Op::OpDecorationGroup:
+		case spv::Op::OpGroupDecorate:
+		case spv::Op::OpGroupMemberDecorate:
+		case spv::Op::OpDecorateId:
+		case spv::Op::OpDecorateString:
+		case spv::Op::OpMemberDecorateString:
+			return ModuleSection::Annotations;
+		default:
+			return ModuleSection::Types;
+		}
+	}
+
+	// Replaces the id at each of the idWords positions of code with remap[id], every id must be smaller than remap.size()
+	inline void remapIdWords(std::span<uint32_t> code, std::span<const uint32_t> idWords, std::span<const uint32_t> remap)
+	{
+		size_t i = 0;
+#if defined(__AVX2__)
+		// Both lookups are gathers, AVX2 has no scatter so the results are stored one at a time
+		for (; i + 8 <= idWords.size(); i += 8)
+		{
+			const __m256i positions = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idWords.data() + i));
+			const __m256i ids = _mm256_i32gather_epi32(reinterpret_cast<const int*>(code.data()), positions, sizeof(uint32_t));
+			const __m256i mappedIds = _mm256_i32gather_epi32(reinterpret_cast<const int*>(remap.data()), ids, sizeof(uint32_t));
+
+			alignas(32) uint32_t mapped[8];
+			_mm256_store_si256(reinterpret_cast<__m256i*>(mapped), mappedIds);
+			for (size_t j = 0; j < 8; j++)
+			{
+				code[idWords[i + j]] = mapped[j];
+			}
+		}
+#endif
+		for (; i < idWords.size(); i++)
+		{
+			uint32_t& word = code[idWords[i]];
+			word = remap[word];
+		}
+	}
+
+	// Links modules emitted by separate generators into one module.
+	// The ids of each module are rebased past the ones of the modules added before it, sections are merged in layout order,
+	// duplicate capabilities, extensions and non-aggregate types are dropped and only the first OpMemoryModel is kept.
+	// Extended instructions are only rebased for the sets hasOnlyIdOperands() accepts, modules using others are rejected.
+	template<typename TGenerator = ModuleGenerator>
+	class ModuleLinker
+	{
+	  protected:
+		struct LinkedSection
+		{
+			std::vector<uint32_t> code;
+			// Positions of the id operands in code
+			std::vector<uint32_t> idWords;
+		};
+
+		std::array<LinkedSection, static_cast<size_t>(ModuleSection::Count)> m_sections;
+		LinkedSection m_functions;
+		// Id each rebased id is replaced with, differs from the identity only for dropped types
+		std::vector<uint32_t> m_remap{0};
+		InstructionCache m_types;
+		uint32_t m_bound = 1;
+
+		// Types that must be unique in a module
+		static constexpr bool isUniqueType(spv::Op opcode)
+		{
+			switch (opcode)
+			{
+			case spv::Op::OpTypeVoid:
+			case spv::Op::OpTypeBool:
+			case spv::Op::OpTypeInt:
+			case spv::Op::OpTypeFloat:
+			case spv::Op::OpTypeVector:
+			case spv::Op::OpTypeMatrix:
+			case spv::Op::OpTypeImage:
+			case spv::Op::OpTypeSampler:
+			case spv::Op::OpTypeSampledImage:
+			case spv::Op::OpTypeFunction:
+				return true;
+			default:
+				return false;
+			}
+		}
+
+		static bool containsInstruction(const LinkedSection& section, std::span<const uint32_t> words)
+		{
+			for (InstructionIterator it{section.code, 0}, end{section.code, section.code.size()}; it != end; ++it)
+			{
+				if (std::ranges::equal((*it).words, words))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		// Copies instruction to the end of section with its ids rebased by offset
+		static void appendInstruction(LinkedSection& section, const Instruction& instruction, uint32_t offset, const ValueTypes& types)
+		{
+			const size_t begin = section.code.size();
+			section.code.insert(section.code.end(), instruction.words.begin(), instruction.words.end());
+			forEachOperand(
+				instruction,
+				[&](OperandKind kind, std::span<const uint32_t> operand) {
+					if (getOperandCategory(kind) == OperandCategory::Id)
+					{
+						const auto index = static_cast<uint32_t>(begin + (operand.data() - instruction.words.data()));
+						section.code[index] += offset;
+						section.idWords.push_back(index);
+					}
+				},
+				types.getSwitchLiteralWords(instruction));
+		}
+
+		// Drops the type appended last to the types section when an identical one was linked before
+		void deduplicateType(size_t begin, size_t idWordsBegin)
+		{
+			LinkedSection& types = m_sections[static_cast<size_t>(ModuleSection::Types)];
+
+			// The operands are types defined earlier, so their final ids are already known
+			for (size_t i = idWordsBegin + 1; i < types.idWords.size(); i++)
+			{
+				uint32_t& word = types.code[types.idWords[i]];
+				word = m_remap[word];
+			}
+
+			const std::span<const uint32_t> words{types.code.data() + begin, types.code.size() - begin};
+			const uint32_t resultId = words[1];
+			uint32_t* key = m_types.prepareKey(words.size() - 1);
+			key[0] = words[0];
+			std::copy(words.begin() + 2, words.end(), key + 1);
+
+			uint32_t& id = m_types.findOrAdd();
+			if (id == 0)
+			{
+				id = resultId;
+				return;
+			}
+
+			m_remap[resultId] = id;
+			types.code.resize(begin);
+			types.idWords.resize(idWordsBegin);
+		}
+
+		// Moves the function at the end of the function section, which has no body, to the declarations section
+		void moveDeclaration(size_t begin, size_t idWordsBegin)
+		{
+			LinkedSection& declarations = m_sections[static_cast<size_t>(ModuleSection::FunctionDeclarations)];
+			const auto delta = static_cast<uint32_t>(declarations.code.size() - begin);
+			declarations.code.insert(declarations.code.end(), m_functions.code.begin() + begin, m_functions.code.end());
+			for (size_t i = idWordsBegin; i < m_functions.idWords.size(); i++)
+			{
+				declarations.idWords.push_back(m_functions.idWords[i] + delta);
+			}
+			m_functions.code.resize(begin);
+			m_functions.idWords.resize(idWordsBegin);
+		}
+
+	  public:
+		// Throws std::invalid_argument and leaves the linker unchanged when an id of code is not below its bound
+		// or cannot be told apart from a literal
+		void addModule(std::span<const uint32_t> code)
+		{
+			const ModuleReader reader{code};
+			const uint32_t bound = reader.getBound();
+			ValueTypes types{bound};
+			ExtInstSets extInstSets;
+			for (auto&& instruction : reader)
+			{
+				types.add(instruction);
+				extInstSets.add(instruction);
+				extInstSets.checkOperands(instruction);
+				forEachOperand(
+					instruction,
+					[bound](OperandKind kind, std::span<const uint32_t> operand) {
+						if (getOperandCategory(kind) == OperandCategory::Id && operand[0] >= bound)
+						{
+							throw std::invalid_argument("dynspv: id is not below the module bound");
+						}
+					},
+					types.getSwitchLiteralWords(instruction));
+			}
+			if (bound > std::numeric_limits<uint32_t>::max() - m_bound)
+			{
+				throw std::invalid_argument("dynspv: linked module bound overflows");
+			}
+
+			const uint32_t offset = m_bound - 1;
+			m_bound = offset + std::max<uint32_t>(reader.getBound(), 1);
+			for (uint32_t id = static_cast<uint32_t>(m_remap.size()); id < m_bound; id++)
+			{
+				m_remap.push_back(id);
+			}
+
+			ModuleSection section = ModuleSection::Capabilities;
+			bool inFunctions = false;
+			bool hasBody = false;
+			size_t functionBegin = 0;
+			size_t functionIdWordsBegin = 0;
+			for (auto&& instruction : reader)
+			{
+				if (instruction.opcode == spv::Op::OpFunction)
+				{
+					inFunctions = true;
+					hasBody = false;
+					functionBegin = m_functions.code.size();
+					functionIdWordsBegin = m_functions.idWords.size();
+				}
+
+				if (inFunctions)
+				{
+					hasBody |= instruction.opcode == spv::Op::OpLabel;
+					appendInstruction(m_functions, instruction, offset, types);
+					if (instruction.opcode == spv::Op::OpFunctionEnd && !hasBody)
+					{
+						moveDeclaration(functionBegin, functionIdWordsBegin);
+					}
+					continue;
+				}
+
+				if (instruction.opcode != spv::Op::OpLine && instruction.opcode != spv::Op::OpNoLine)
+				{
+					section = getModuleSection(instruction.opcode);
+				}
+
+				LinkedSection& linkedSection = m_sections[static_cast<size_t>(section)];
+				if ((section == ModuleSection::Capabilities || section == ModuleSection::Extensions) && containsInstruction(linkedSection, instruction.words))
+				{
+					continue;
+				}
+				if (section == ModuleSection::MemoryModel && !linkedSection.code.empty())
+				{
+					continue;
+				}
+
+				const size_t begin = linkedSection.code.size();
+				const size_t idWordsBegin = linkedSection.idWords.size();
+				appendInstruction(linkedSection, instruction, offset, types);
+				if (section == ModuleSection::Types && isUniqueType(instruction.opcode))
+				{
+					deduplicateType(begin, idWordsBegin);
+				}
+			}
+		}
+
+		uint32_t getBound() const
+		{
+			return m_bound;
+		}
+
+		// Replaces the ids of dropped types in one pass over the id operands, then stitches the sections together
+		std::vector<uint32_t> link(uint32_t version = spv::Version)
+		{
+			size_t size = HEADER_SIZE + m_functions.code.size();
+			for (auto&& section : m_sections)
+			{
+				size += section.code.size();
+			}
+
+			TGenerator module{VectorSink{size}};
+			module.writeHeader(version);
+			auto writeSection = [&](LinkedSection& section) {
+				remapIdWords(section.code, section.idWords, m_remap);
+				module.writeCode(section.code);
+			};
+			for (auto&& section : m_sections)
+			{
+				writeSection(section);
+			}
+			writeSection(m_functions);
+			module.updateBound(m_bound);
+
+			return module.getSink().releaseCode();
+		}
+	};
+
+	// Renumbers the ids of a module densely, keeping their relative order, and writes the new bound which is also returned.
+	// Throws std::invalid_argument before changing code when an id is out of bounds or an extended instruction set mixes
+	// literals into its operands, see hasOnlyIdOperands().
+	inline uint32_t compactIds(std::span<uint32_t> code)
+	{
+		const ModuleReader reader{code};
+		const uint32_t bound = reader.getBound();
+
+		// Marks the ids in use first, then turns the marks into the new ids
+		std::vector<uint32_t> remap(bound, 0);
+		std::vector<uint32_t> idWords;
+		ValueTypes types{bound};
+		ExtInstSets extInstSets;
+		for (auto&& instruction : reader)
+		{
+			types.add(instruction);
+			extInstSets.add(instruction);
+			extInstSets.checkOperands(instruction);
+			forEachOperand(
+				instruction,
+				[&](OperandKind kind, std::span<const uint32_t> operand) {
+					if (getOperandCategory(kind) != OperandCategory::Id)
+					{
+						return;
+					}
+					if (operand[0] >= bound)
+					{
+						throw std::invalid_argument("dynspv: id is not below the module bound");
+					}
+
+					remap[operand[0]] = 1;
+					idWords.push_back(static_cast<uint32_t>(operand.data() - code.data()));
+				},
+				types.getSwitchLiteralWords(instruction));
+		}
+
+		uint32_t nextId = 1;
+		for (uint32_t id = 1; id < bound; id++)
+		{
+			if (remap[id] != 0)
+			{
+				remap[id] = nextId++;
+			}
+		}
+
+		remapIdWords(code, idWords, remap);
+		code[BOUND_INDEX] = nextId;
+		return nextId;
+	}
+} // namespace dynspv
\ No newline at end of file
@@ -0,0 +1,197 @@
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <dynspv.hpp>
+#include <spirv-tools/libspirv.hpp>
+
+namespace dynspv
+{
+	constexpr size_t DEFAULT_VALIDATION_BACKLOG = 64;
+
+	struct ValidationFailure
+	{
+		// Value passed to submit(), identifies the module to the caller
+		uint64_t tag = 0;
+		std::vector<uint32_t> code;
+		std::string message;
+	};
+
+	// Validates modules with SPIRV-Tools on a pool of worker threads.
+	// Modules are dropped instead of blocking the caller when the backlog is full.
+	class ValidationQueue
+	{
+	  public:
+		using FailureCallback = std::function<void(const ValidationFailure&)>;
+
+	  protected:
+		struct Job
+		{
+			uint64_t tag;
+			std::vector<uint32_t> code;
+		};
+
+		spv_target_env m_targetEnv;
+		FailureCallback m_onFailure;
+		size_t m_maxBacklog;
+		uint32_t m_samplePeriod;
+
+		std::mutex m_mutex;
+		std::condition_variable m_jobAvailable;
+		std::condition_variable m_idle;
+		std::deque<Job> m_jobs;
+		size_t m_activeJobs = 0;
+		bool m_stopping = false;
+
+		std::atomic<uint64_t> m_submittedCount = 0;
+		std::atomic<uint64_t> m_droppedCount = 0;
+		std::atomic<uint64_t> m_validatedCount = 0;
+
+		std::vector<std::thread> m_workers;
+
+		void runWorker()
+		{
+			spvtools::SpirvTools spvTools{m_targetEnv};
+			std::string message;
+			spvTools.SetMessageConsumer(
+				[&message](spv_message_level_t, const char*, const spv_position_t&, const char* text) {
+					message += text;
+					message += '\n';
+				});
+
+			while (true)
+			{
+				Job job;
+				{
+					std::unique_lock lock{m_mutex};
+					m_jobAvailable.wait(lock, [this]() { return m_stopping || !m_jobs.empty(); });
+					if (m_jobs.empty())
+					{
+						return;
+					}
+					job = std::move(m_jobs.front());
+					m_jobs.pop_front();
+					m_activeJobs++;
+				}
+
+				message.clear();
+				if (!spvTools.Validate(job.code.data(), job.code.size()))
+				{
+					m_onFailure({job.tag, std::move(job.code), std::move(message)});
+				}
+				m_validatedCount++;
+
+				{
+					std::lock_guard lock{m_mutex};
+					m_activeJobs--;
+					if (m_jobs.empty() && m_activeJobs == 0)
+					{
+						m_idle.notify_all();
+					}
+				}
+			}
+		}
+
+		bool isSampled()
+		{
+			return m_submittedCount++ % m_samplePeriod == 0;
+		}
+
+		bool enqueue(Job&& job)
+		{
+			{
+				std::lock_guard lock{m_mutex};
+				if (m_jobs.size() >= m_maxBacklog)
+				{
+					m_droppedCount++;
+					return false;
+				}
+				m_jobs.push_back(std::move(job));
+			}
+			m_jobAvailable.notify_one();
+			return true;
+		}
+
+	  public:
+		// onFailure is called from a worker thread, samplePeriod N validates every Nth submitted module
+		explicit ValidationQueue(
+			FailureCallback onFailure,
+			spv_target_env targetEnv = SPV_ENV_UNIVERSAL_1_6,
+			size_t workerCount = 1,
+			size_t maxBacklog = DEFAULT_VALIDATION_BACKLOG,
+			uint32_t samplePeriod = 1)
+			: m_targetEnv(targetEnv), m_onFailure(std::move(onFailure)), m_maxBacklog(maxBacklog), m_samplePeriod(std::max<uint32_t>(samplePeriod, 1))
+		{
+			for (size_t i = 0; i < std::max<size_t>(workerCount, 1); i++)
+			{
+				m_workers.emplace_back([this]() { runWorker(); });
+			}
+		}
+
+		ValidationQueue(const ValidationQueue&) = delete;
+		ValidationQueue& operator=(const ValidationQueue&) = delete;
+
+		// Modules already queued are still validated
+		~ValidationQueue()
+		{
+			{
+				std::lock_guard lock{m_mutex};
+				m_stopping = true;
+			}
+			m_jobAvailable.notify_all();
+			for (auto&& worker : m_workers)
+			{
+				worker.join();
+			}
+		}
+
+		// Returns false when the module is skipped by sampling or dropped because the backlog is full
+		bool submit(std::span<const uint32_t> code, uint64_t tag = 0)
+		{
+			if (!isSampled())
+			{
+				return false;
+			}
+			return enqueue({tag, {code.begin(), code.end()}});
+		}
+
+		bool submit(std::vector<uint32_t>&& code, uint64_t tag = 0)
+		{
+			if (!isSampled())
+			{
+				return false;
+			}
+			return enqueue({tag, std::move(code)});
+		}
+
+		// Blocks until every queued module has been validated
+		void wait()
+		{
+			std::unique_lock lock{m_mutex};
+			m_idle.wait(lock, [this]() { return m_jobs.empty() && m_activeJobs == 0; });
+		}
+
+		uint64_t getDroppedCount() const
+		{
+			return m_droppedCount;
+		}
+
+		uint64_t getValidatedCount() const
+		{
+			return m_validatedCount;
+		}
+	};
+} // namespace dynspv
@@ -2,8 +2,20 @@
 
 #include <spirv-tools/libspirv.hpp>
 #include <dynspv.hpp>
+#include <dynspv_archive.hpp>
+#include <dynspv_batch.hpp>
+#include <dynspv_validation.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdio>
+#include <filesystem>
 #include <format>
+#include <mutex>
+#include <numeric>
+#include <span>
 #include <sstream>
+#include <thread>
 
 TEST(GeneratorTests, GenerateValidBasicShader)
 {
@@ -38,12 +50,1212 @@ TEST(GeneratorTests, GenerateValidBasicShader)
 	std::stringstream errors;
 	spvTools.SetMessageConsumer(
 		[&errors](
-			spv_message_level_t level,
+			spv_message_level_t,
 			const char* source,
-			const spv_position_t& position,
+			const spv_position_t&,
 			const char* message) {
 			errors << std::format("Source: {}; Message: {}\n", source, message);
 		});
 	bool isValid = spvTools.Validate(generator.getCode());
 	ASSERT_TRUE(isValid) << errors.str();
 }
+
+TEST(GeneratorTests, SpanSinkWritesIntoCallerStorage)
+{
+	std::array<uint32_t, 8> storage{};
+	dynspv::BasicModuleGenerator<dynspv::SpanSink> generator{dynspv::SpanSink{storage}};
+	generator.writeHeader(0x010000);
+	generator.OpCapability(spv::Capability::CapabilityShader);
+	generator.updateBound(generator.getBound());
+
+	auto code = generator.getCode();
+	ASSERT_EQ(code.data(), storage.data());
+	ASSERT_EQ(code.size(), 7);
+	EXPECT_EQ(storage[0], spv::MagicNumber);
+	EXPECT_EQ(storage[dynspv::BOUND_INDEX], 1);
+	EXPECT_EQ(storage[5], (2u << 16) | spv::Op::OpCapability);
+	EXPECT_EQ(storage[6], spv::Capability::CapabilityShader);
+
+	EXPECT_THROW(generator.OpCapability(spv::Capability::CapabilityShader), std::length_error);
+}
+
+TEST(GeneratorTests, ResetReusesAllocation)
+{
+	dynspv::ModuleGenerator generator{};
+	auto emitModule = [&generator]() {
+		generator.writeHeader(0x010000);
+		generator.OpCapability(spv::Capability::CapabilityShader);
+		generator.OpMemoryModel(spv::AddressingModel::AddressingModelLogical, spv::MemoryModel::MemoryModelGLSL450);
+		generator.updateBound(generator.getBound());
+	};
+
+	emitModule();
+	std::vector<uint32_t> first{generator.view().begin(), generator.view().end()};
+	const uint32_t* data = generator.view().data();
+
+	generator.reset();
+	ASSERT_TRUE(generator.view().empty());
+	emitModule();
+
+	EXPECT_EQ(generator.view().data(), data);
+	EXPECT_TRUE(std::ranges::equal(generator.view(), first));
+	EXPECT_EQ(generator.getCode(), first);
+}
+
+TEST(GeneratorTests, BuildModuleAllocatesExactSize)
+{
+	auto builder = [](auto& generator) {
+		generator.writeHeader(0x010000);
+		generator.OpCapability(spv::Capability::CapabilityShader);
+		generator.OpExtInstImport(generator.nextId(), "GLSL.std.450");
+		generator.OpMemoryModel(spv::AddressingModel::AddressingModelLogical, spv::MemoryModel::MemoryModelGLSL450);
+		generator.updateBound(generator.getBound());
+	};
+
+	dynspv::ModuleGenerator reference{};
+	builder(reference);
+
+	ASSERT_EQ(dynspv::measureModule(builder), reference.view().size());
+	std::vector<uint32_t> code = dynspv::buildModule(builder);
+	EXPECT_EQ(code.capacity(), code.size());
+	EXPECT_EQ(code, reference.getCode());
+}
+
+TEST(GeneratorTests, OperandListAcceptsContiguousRanges)
+{
+	const std::vector<dynspv::IdRef> vector{4, 5, 6};
+	const std::array<dynspv::IdRef, 3> array{4, 5, 6};
+	const std::string name = "constituents";
+
+	dynspv::ModuleGenerator fromVector{};
+	fromVector.OpCompositeConstruct(1, 2, vector);
+	fromVector.OpName(2, name);
+
+	dynspv::ModuleGenerator fromArray{};
+	fromArray.OpCompositeConstruct(1, 2, std::span{array});
+	fromArray.OpName(2, std::string_view{name});
+
+	dynspv::ModuleGenerator fromList{};
+	fromList.OpCompositeConstruct(1, 2, {4, 5, 6});
+	fromList.OpName(2, "constituents");
+
+	ASSERT_EQ(fromVector.view().size(), 6 + 6);
+	EXPECT_EQ(fromVector.view()[0], (6u << 16) | spv::Op::OpCompositeConstruct);
+	EXPECT_EQ(fromVector.getCode(), fromArray.getCode());
+	EXPECT_EQ(fromVector.getCode(), fromList.getCode());
+}
+
+TEST(GeneratorTests, ModuleBuilderStitchesSectionsInLayoutOrder)
+{
+	using dynspv::ModuleSection;
+
+	dynspv::ModuleBuilder builder{};
+	auto glslId = builder.nextId();
+	auto mainId = builder.nextId();
+	auto voidTypeId = builder.nextId();
+	auto voidFunctionTypeId = builder.nextId();
+	auto labelId = builder.nextId();
+
+	std::thread functionThread{[&, &function = builder.addFunction()]() {
+		function.OpFunction(voidTypeId, mainId, spv::FunctionControlMask::FunctionControlMaskNone, voidFunctionTypeId);
+		function.OpLabel(labelId);
+		function.OpReturn();
+		function.OpFunctionEnd();
+	}};
+
+	builder.section(ModuleSection::Types).OpTypeVoid(voidTypeId);
+	builder.section(ModuleSection::Types).OpTypeFunction(voidFunctionTypeId, voidTypeId);
+	builder.section(ModuleSection::DebugNames).OpName(mainId, "main");
+	builder.section(ModuleSection::DebugStrings).OpSource(spv::SourceLanguage::SourceLanguageGLSL, 450);
+	builder.section(ModuleSection::EntryPoints).OpEntryPoint(spv::ExecutionModel::ExecutionModelVertex, mainId, "main");
+	builder.section(ModuleSection::MemoryModel).OpMemoryModel(spv::AddressingModel::AddressingModelLogical, spv::MemoryModel::MemoryModelGLSL450);
+	builder.section(ModuleSection::ExtInstImports).OpExtInstImport(glslId, "GLSL.std.450");
+	builder.section(ModuleSection::Capabilities).OpCapability(spv::Capability::CapabilityShader);
+	functionThread.join();
+
+	dynspv::ModuleGenerator linear{};
+	linear.writeHeader(0x010000);
+	linear.OpCapability(spv::Capability::CapabilityShader);
+	linear.OpExtInstImport(glslId, "GLSL.std.450");
+	linear.OpMemoryModel(spv::AddressingModel::AddressingModelLogical, spv::MemoryModel::MemoryModelGLSL450);
+	linear.OpEntryPoint(spv::ExecutionModel::ExecutionModelVertex, mainId, "main");
+	linear.OpSource(spv::SourceLanguage::SourceLanguageGLSL, 450);
+	linear.OpName(mainId, "main");
+	linear.OpTypeVoid(voidTypeId);
+	linear.OpTypeFunction(voidFunctionTypeId, voidTypeId);
+	linear.OpFunction(voidTypeId, mainId, spv::FunctionControlMask::FunctionControlMaskNone, voidFunctionTypeId);
+	linear.OpLabel(labelId);
+	linear.OpReturn();
+	linear.OpFunctionEnd();
+	linear.updateBound(builder.getBound());
+
+	EXPECT_EQ(builder.finish(0x010000), linear.getCode());
+}
+
+TEST(GeneratorTests, ModuleBuilderSectionsInternWithBuilderIds)
+{
+	dynspv::ModuleBuilder<dynspv::InterningGenerator<>> builder{};
+	auto& types = builder.section(dynspv::ModuleSection::Types);
+	const uint32_t first = builder.nextId();
+	const uint32_t second = types.nextId();
+	const auto intType = types.internType(spv::Op::OpTypeInt, 32, 1);
+	const auto arrayType = types.nextId();
+	const auto compositeId = dynspv::writeConstantComposite(types, arrayType, intType, std::vector<int32_t>{1, 2});
+	EXPECT_EQ(types.internType(spv::Op::OpTypeInt, 32, 1), intType);
+
+	std::vector<uint32_t> ids{first, second, intType, arrayType, compositeId};
+	const auto code = builder.finish(0x010000);
+	for (auto&& instruction : dynspv::ModuleReader{code})
+	{
+		if (instruction.opcode == spv::Op::OpConstant)
+		{
+			ids.push_back(instruction.getResultId());
+		}
+	}
+	ASSERT_EQ(ids.size(), 7);
+	std::sort(ids.begin(), ids.end());
+	EXPECT_EQ(std::adjacent_find(ids.begin(), ids.end()), ids.end());
+	EXPECT_LT(ids.back(), builder.getBound());
+}
+
+TEST(GeneratorTests, InterningGeneratorDeduplicatesTypesAndConstants)
+{
+	dynspv::InterningGenerator<> generator{};
+	auto intType = generator.internType(spv::Op::OpTypeInt, 32, 1);
+	auto uintType = generator.internType(spv::Op::OpTypeInt, 32, 0);
+	auto vectorType = generator.internType(spv::Op::OpTypeVector, intType, 4);
+	auto one = generator.internConstant(spv::Op::OpConstant, intType, 1);
+	auto two = generator.internConstant(spv::Op::OpConstant, intType, 2);
+	auto unsignedOne = generator.internConstant(spv::Op::OpConstant, uintType, 1);
+	const size_t size = generator.view().size();
+
+	EXPECT_EQ(generator.internType(spv::Op::OpTypeInt, 32, 1), intType);
+	EXPECT_EQ(generator.internType(spv::Op::OpTypeVector, intType, 4), vectorType);
+	EXPECT_EQ(generator.internConstant(spv::Op::OpConstant, intType, 1), one);
+	EXPECT_EQ(generator.internConstant(spv::Op::OpConstant, intType, 2), two);
+	EXPECT_EQ(generator.internConstant(spv::Op::OpConstant, uintType, 1), unsignedOne);
+	EXPECT_EQ(generator.view().size(), size);
+	EXPECT_EQ(generator.getCache().size(), 6);
+	EXPECT_EQ(generator.getBound(), 7);
+
+	dynspv::ModuleGenerator reference{};
+	reference.OpTypeInt(intType, 32, 1);
+	reference.OpTypeInt(uintType, 32, 0);
+	reference.OpTypeVector(vectorType, intType, 4);
+	reference.OpConstant(intType, one, 1);
+	reference.OpConstant(intType, two, 2);
+	reference.OpConstant(uintType, unsignedOne, 1);
+	EXPECT_EQ(generator.getCode(), reference.getCode());
+
+	// Types interned after a snapshot are forgotten when it is restored
+	const auto snapshot = generator.snapshot();
+	const auto floatType = generator.internType(spv::Op::OpTypeFloat, 32);
+	generator.restore(snapshot);
+	EXPECT_EQ(generator.view().size(), size);
+	EXPECT_EQ(generator.internType(spv::Op::OpTypeInt, 32, 1), intType);
+	EXPECT_EQ(generator.internType(spv::Op::OpTypeFloat, 32), floatType);
+	EXPECT_EQ(generator.view().size(), size + 3);
+
+	const dynspv::ModuleSnapshot moduleSnapshot = generator.snapshot();
+	generator.restore(moduleSnapshot);
+	EXPECT_EQ(generator.getCache().size(), 0);
+}
+
+TEST(GeneratorTests, IdBlocksHandOutUniqueIdsAcrossThreads)
+{
+	constexpr size_t threadCount = 4;
+	constexpr size_t idsPerThread = 1000;
+
+	dynspv::IdAllocator allocator{};
+	std::vector<std::vector<uint32_t>> ids(threadCount);
+	std::vector<std::thread> threads;
+	for (auto&& threadIds : ids)
+	{
+		threads.emplace_back([&allocator, &threadIds]() {
+			dynspv::IdBlock block{allocator, 64};
+			for (size_t i = 0; i < idsPerThread; i++)
+			{
+				threadIds.push_back(block.nextId());
+			}
+		});
+	}
+	for (auto&& thread : threads)
+	{
+		thread.join();
+	}
+
+	std::vector<uint32_t> allIds;
+	for (auto&& threadIds : ids)
+	{
+		allIds.insert(allIds.end(), threadIds.begin(), threadIds.end());
+	}
+	std::sort(allIds.begin(), allIds.end());
+	EXPECT_EQ(std::adjacent_find(allIds.begin(), allIds.end()), allIds.end());
+	EXPECT_GE(allIds.front(), 1);
+	EXPECT_LT(allIds.back(), allocator.getBound());
+
+	dynspv::IdAllocator tailAllocator{};
+	dynspv::IdBlock block{tailAllocator};
+	block.nextId();
+	block.nextId();
+	block.release();
+	EXPECT_EQ(tailAllocator.getBound(), 3);
+}
+
+TEST(GeneratorTests, BuildModuleAtCompileTime)
+{
+	constexpr auto builder = [](auto& generator) {
+		generator.writeHeader(0x010000);
+		generator.OpCapability(spv::Capability::CapabilityShader);
+		generator.OpExtInstImport(generator.nextId(), "GLSL.std.450");
+		generator.OpMemoryModel(spv::AddressingModel::AddressingModelLogical, spv::MemoryModel::MemoryModelGLSL450);
+		auto mainId = generator.nextId();
+		generator.OpEntryPoint(spv::ExecutionModel::ExecutionModelVertex, mainId, "main");
+		generator.OpName(mainId, "vs_fullscreen");
+		auto intTypeId = generator.nextId();
+		generator.OpTypeInt(intTypeId, 32, 1);
+		generator.OpConstant(intTypeId, generator.nextId(), -3);
+		generator.OpConstant(intTypeId, generator.nextId(), static_cast<int16_t>(-3));
+		generator.OpConstant(intTypeId, generator.nextId(), 0.5f);
+		generator.OpConstant(intTypeId, generator.nextId(), 0.25);
+		generator.updateBound(generator.getBound());
+	};
+
+	static constexpr auto code = dynspv::buildModule<dynspv::measureModule(builder)>(builder);
+
+	dynspv::ModuleGenerator reference{};
+	builder(reference);
+	EXPECT_TRUE(std::ranges::equal(code, reference.view()));
+}
+
+TEST(GeneratorTests, StreamSinkFlushesChunksAndPatchesBound)
+{
+	std::vector<uint32_t> streamed;
+	size_t largestWrite = 0;
+	auto write = [&](size_t offset, std::span<const uint32_t> words) {
+		streamed.resize(std::max(streamed.size(), offset + words.size()));
+		std::copy(words.begin(), words.end(), streamed.begin() + offset);
+		largestWrite = std::max(largestWrite, words.size());
+	};
+
+	auto builder = [](auto& generator) {
+		generator.writeHeader(0x010000);
+		generator.OpCapability(spv::Capability::CapabilityShader);
+		generator.OpMemoryModel(spv::AddressingModel::AddressingModelLogical, spv::MemoryModel::MemoryModelGLSL450);
+		for (uint32_t i = 0; i < 100; i++)
+		{
+			generator.OpName(generator.nextId(), "name");
+		}
+		generator.updateBound(generator.getBound());
+	};
+
+	dynspv::BasicModuleGenerator<dynspv::StreamSink> generator{dynspv::StreamSink{write, 16}};
+	builder(generator);
+	generator.getSink().flush();
+
+	dynspv::ModuleGenerator reference{};
+	builder(reference);
+	EXPECT_LE(largestWrite, 16);
+	EXPECT_EQ(streamed, reference.getCode());
+}
+
+TEST(GeneratorTests, StreamSinkWritesToFile)
+{
+	std::FILE* file = std::tmpfile();
+	ASSERT_NE(file, nullptr);
+
+	dynspv::BasicModuleGenerator<dynspv::StreamSink> generator{dynspv::StreamSink{dynspv::makeFileWriter(file), 8}};
+	generator.writeHeader(0x010000);
+	generator.OpCapability(spv::Capability::CapabilityShader);
+	generator.OpExtInstImport(generator.nextId(), "GLSL.std.450");
+	generator.updateBound(generator.getBound());
+	generator.getSink().flush();
+
+	std::vector<uint32_t> code(generator.getSink().size());
+	std::rewind(file);
+	ASSERT_EQ(std::fread(code.data(), sizeof(uint32_t), code.size(), file), code.size());
+	std::fclose(file);
+
+	EXPECT_EQ(code[0], spv::MagicNumber);
+	EXPECT_EQ(code[dynspv::BOUND_INDEX], 2);
+	EXPECT_EQ(code[5], (2u << 16) | spv::Op::OpCapability);
+	EXPECT_EQ(code[7], (6u << 16) | spv::Op::OpExtInstImport);
+}
+
+TEST(GeneratorTests, BuildVariantsFromSharedPrefix)
+{
+	auto prefix = [](auto& generator) {
+		generator.writeHeader(0x010000);
+		generator.OpCapability(spv::Capability::CapabilityShader);
+		generator.OpMemoryModel(spv::AddressingModel::AddressingModelLogical, spv::MemoryModel::MemoryModelGLSL450);
+		generator.OpTypeInt(generator.nextId(), 32, 1);
+	};
+	auto variant = [](auto& generator, size_t index) {
+		generator.OpConstant(1, generator.nextId(), static_cast<int32_t>(index));
+		generator.updateBound(generator.getBound());
+	};
+
+	auto modules = dynspv::buildVariants(prefix, 3, variant);
+	ASSERT_EQ(modules.size(), 3);
+	for (size_t i = 0; i < modules.size(); i++)
+	{
+		dynspv::ModuleGenerator reference{};
+		prefix(reference);
+		variant(reference, i);
+		EXPECT_EQ(modules[i], reference.getCode());
+	}
+}
+
+TEST(GeneratorTests, RelocationsPatchSpecializationConstants)
+{
+	dynspv::ModuleGenerator generator{};
+	generator.writeHeader(0x010000);
+	auto floatTypeId = generator.nextId();
+	generator.OpTypeFloat(floatTypeId, 32);
+	auto constantId = generator.nextId();
+	generator.writeInstruction(spv::Op::OpDecorate, 4, constantId, spv::Decoration::DecorationSpecId, 7u);
+	auto specId = generator.relocateLastInstruction(3);
+	generator.OpSpecConstant(floatTypeId, constantId, 1.0f);
+	auto value = generator.relocateLastInstruction(3);
+
+	generator.patch(specId, 9u);
+	generator.patch(value, 2.0f);
+	EXPECT_THROW(generator.patch(value, 2.0), std::invalid_argument);
+
+	std::vector<uint32_t> code = generator.getSink().releaseCode();
+	EXPECT_EQ(code[specId.wordIndex], 9);
+	EXPECT_EQ(code[value.wordIndex], std::bit_cast<uint32_t>(2.0f));
+
+	dynspv::patchRelocation(code, value, 0.5f);
+	EXPECT_EQ(code[value.wordIndex], std::bit_cast<uint32_t>(0.5f));
+	EXPECT_EQ(code[value.wordIndex - 3], (4u << 16) | spv::Op::OpSpecConstant);
+}
+
+TEST(GeneratorTests, ModuleEditorReplacesFunctions)
+{
+	auto emitFunction = [](auto& generator, uint32_t functionId, uint32_t returnCount) {
+		generator.OpFunction(1, functionId, spv::FunctionControlMask::FunctionControlMaskNone, 2);
+		for (uint32_t i = 0; i < returnCount; i++)
+		{
+			generator.OpLabel(generator.nextId());
+			generator.OpReturn();
+		}
+		generator.OpFunctionEnd();
+	};
+
+	dynspv::ModuleGenerator generator{};
+	generator.writeHeader(0x010000);
+	generator.OpTypeVoid(generator.nextId());
+	generator.OpTypeFunction(generator.nextId(), 1);
+	auto firstId = generator.nextId();
+	auto secondId = generator.nextId();
+	emitFunction(generator, firstId, 1);
+	emitFunction(generator, secondId, 1);
+	generator.updateBound(generator.getBound());
+
+	dynspv::ModuleEditor editor{generator.getSink().releaseCode()};
+	auto first = editor.findFunction(firstId);
+	auto second = editor.findFunction(secondId);
+	ASSERT_TRUE(first.has_value() && second.has_value());
+	EXPECT_EQ(first->end, second->begin);
+
+	auto sameSize = editor.beginFunction();
+	emitFunction(sameSize, secondId, 1);
+	editor.replaceFunction(secondId, sameSize);
+	ASSERT_EQ(editor.getDirtyRanges().size(), 2);
+	EXPECT_EQ(editor.getDirtyRanges()[0].begin, second->begin);
+	EXPECT_EQ(editor.getDirtyRanges()[0].end, second->end);
+	EXPECT_EQ(editor.getBound(), 8);
+	editor.clearDirtyRanges();
+
+	auto larger = editor.beginFunction();
+	emitFunction(larger, firstId, 2);
+	editor.replaceFunction(firstId, larger);
+	ASSERT_EQ(editor.getDirtyRanges().size(), 2);
+	EXPECT_EQ(editor.getDirtyRanges()[0].begin, first->begin);
+	EXPECT_EQ(editor.getDirtyRanges()[0].end, editor.view().size());
+	EXPECT_EQ(editor.findFunction(secondId)->begin, first->end + 3);
+	EXPECT_EQ(editor.findFunction(secondId)->end, editor.view().size());
+	EXPECT_EQ(editor.getBound(), 10);
+
+	// Shrinking a function after an edit further down drops the dirty range it moved out of the module
+	editor.clearDirtyRanges();
+	auto sameSizeAgain = editor.beginFunction();
+	emitFunction(sameSizeAgain, secondId, 1);
+	editor.replaceFunction(secondId, sameSizeAgain);
+	auto smaller = editor.beginFunction();
+	emitFunction(smaller, firstId, 1);
+	editor.replaceFunction(firstId, smaller);
+	auto dirtyRanges = editor.getDirtyRanges();
+	std::sort(dirtyRanges.begin(), dirtyRanges.end(), [](auto&& a, auto&& b) { return a.begin < b.begin; });
+	ASSERT_EQ(dirtyRanges.size(), 2);
+	EXPECT_EQ(dirtyRanges[0].begin, dynspv::BOUND_INDEX);
+	EXPECT_EQ(dirtyRanges[0].end, dynspv::BOUND_INDEX + 1);
+	EXPECT_EQ(dirtyRanges[1].begin, first->begin);
+	EXPECT_EQ(dirtyRanges[1].end, editor.view().size());
+
+	const std::vector<uint32_t> header{spv::MagicNumber, 0x010000, 0, 1, 0};
+	auto withInstruction = [&header](std::vector<uint32_t> words) {
+		words.insert(words.begin(), header.begin(), header.end());
+		return words;
+	};
+	EXPECT_THROW(dynspv::ModuleEditor{withInstruction({0})}, std::invalid_argument);
+	EXPECT_THROW(dynspv::ModuleEditor{withInstruction({dynspv::makeInstructionHeader(spv::Op::OpReturn, 3)})}, std::invalid_argument);
+	EXPECT_THROW(dynspv::ModuleEditor{withInstruction({dynspv::makeInstructionHeader(spv::Op::OpFunction, 2), 1})}, std::invalid_argument);
+	EXPECT_THROW(dynspv::ModuleEditor{std::vector<uint32_t>{spv::MagicNumber}}, std::invalid_argument);
+}
+
+TEST(GeneratorTests, ModuleReaderDecodesOperands)
+{
+	dynspv::ModuleGenerator generator{};
+	generator.writeHeader(0x010000);
+	auto mainId = generator.nextId();
+	generator.OpEntryPoint(spv::ExecutionModel::ExecutionModelGLCompute, mainId, "main_function", {7, 8});
+	// Enumerant parameters are not part of the generated signatures
+	generator.writeInstruction(spv::Op::OpDecorate, 4, 9u, spv::Decoration::DecorationSpecId, 3u);
+	generator.writeInstruction(spv::Op::OpLoad, 6, 10u, 11u, 12u, spv::MemoryAccessMask::MemoryAccessAlignedMask, 16u);
+	generator.writeInstruction(spv::Op::OpSpecConstantOp, 6, 10u, 13u, static_cast<uint32_t>(spv::Op::OpIAdd), 14u, 15u);
+	generator.updateBound(generator.getBound());
+
+	using Kind = dynspv::OperandKind;
+	struct Operand
+	{
+		Kind kind;
+		size_t wordCount;
+	};
+	std::vector<std::vector<Operand>> instructions;
+	std::vector<uint32_t> resultIds;
+	dynspv::ModuleReader reader{generator.view()};
+	ASSERT_EQ(reader.getBound(), generator.getBound());
+	for (auto&& instruction : reader)
+	{
+		auto& operands = instructions.emplace_back();
+		dynspv::forEachOperand(instruction, [&operands](Kind kind, std::span<const uint32_t> words) { operands.push_back({kind, words.size()}); });
+		resultIds.push_back(instruction.getResultId());
+	}
+
+	auto expectOperands = [](const std::vector<Operand>& operands, std::vector<Operand> expected) {
+		ASSERT_EQ(operands.size(), expected.size());
+		for (size_t i = 0; i < operands.size(); i++)
+		{
+			EXPECT_EQ(operands[i].kind, expected[i].kind) << i;
+			EXPECT_EQ(operands[i].wordCount, expected[i].wordCount) << i;
+		}
+	};
+	ASSERT_EQ(instructions.size(), 4);
+	expectOperands(instructions[0], {{Kind::ExecutionModel, 1}, {Kind::IdRef, 1}, {Kind::LiteralString, 4}, {Kind::IdRef, 1}, {Kind::IdRef, 1}});
+	expectOperands(instructions[1], {{Kind::IdRef, 1}, {Kind::Decoration, 1}, {Kind::LiteralInteger, 1}});
+	expectOperands(instructions[2], {{Kind::IdResultType, 1}, {Kind::IdResult, 1}, {Kind::IdRef, 1}, {Kind::MemoryAccess, 1}, {Kind::LiteralInteger, 1}});
+	expectOperands(instructions[3], {{Kind::IdResultType, 1}, {Kind::IdResult, 1}, {Kind::LiteralSpecConstantOpInteger, 1}, {Kind::IdRef, 1}, {Kind::IdRef, 1}});
+	EXPECT_EQ(resultIds, (std::vector<uint32_t>{0, 0, 11, 13}));
+
+	// A zero word count ends the iteration
+	std::vector<uint32_t> code{generator.view().begin(), generator.view().end()};
+	code[dynspv::HEADER_SIZE] &= 0xffff;
+	dynspv::ModuleReader malformedReader{code};
+	EXPECT_EQ(malformedReader.begin(), malformedReader.end());
+}
+
+TEST(GeneratorTests, ValidationQueueReportsSampledFailures)
+{
+	std::mutex mutex;
+	std::vector<uint64_t> failedTags;
+	dynspv::ValidationQueue queue{
+		[&](const dynspv::ValidationFailure& failure) {
+			std::lock_guard lock{mutex};
+			failedTags.push_back(failure.tag);
+		},
+		SPV_ENV_UNIVERSAL_1_6,
+		2,
+		dynspv::DEFAULT_VALIDATION_BACKLOG,
+		2};
+
+	dynspv::ModuleGenerator generator{};
+	generator.writeHeader(0x010000);
+	generator.OpCapability(spv::Capability::CapabilityShader);
+	generator.updateBound(generator.getBound());
+	std::vector<uint32_t> invalidCode{generator.view().begin(), generator.view().end()};
+	invalidCode[0] = 0;
+
+	EXPECT_TRUE(queue.submit(generator.view(), 0));
+	EXPECT_FALSE(queue.submit(generator.view(), 1));
+	EXPECT_TRUE(queue.submit(invalidCode, 2));
+	EXPECT_FALSE(queue.submit(invalidCode, 3));
+	EXPECT_TRUE(queue.submit(std::move(invalidCode), 4));
+	queue.wait();
+
+	std::sort(failedTags.begin(), failedTags.end());
+	EXPECT_EQ(failedTags, (std::vector<uint64_t>{2, 4}));
+	EXPECT_EQ(queue.getValidatedCount(), 3);
+	EXPECT_EQ(queue.getDroppedCount(), 0);
+}
+
+TEST(GeneratorTests, StripDebugInfoSkipsDebugInstructions)
+{
+	auto emitModule = [](dynspv::ModuleGenerator& generator) {
+		generator.writeHeader(0x010000);
+		generator.OpCapability(spv::Capability::CapabilityShader);
+		auto debugInfoId = generator.nextId();
+		generator.OpExtInstImport(debugInfoId, "NonSemantic.Shader.DebugInfo.100");
+		auto glslId = generator.nextId();
+		generator.OpExtInstImport(glslId, "GLSL.std.450");
+		auto openClDebugInfoId = generator.nextId();
+		generator.OpExtInstImport(openClDebugInfoId, "OpenCL.DebugInfo.100");
+		auto legacyDebugInfoId = generator.nextId();
+		generator.OpExtInstImport(legacyDebugInfoId, "DebugInfo");
+		auto fileId = generator.nextId();
+		generator.OpString(fileId, "shader.comp");
+		generator.OpSource(spv::SourceLanguage::SourceLanguageGLSL, 450, fileId, "void main() {}");
+		generator.OpName(fileId, "name");
+		auto voidTypeId = generator.nextId();
+		generator.OpTypeVoid(voidTypeId);
+		generator.OpExtInst(voidTypeId, generator.nextId(), debugInfoId, 35, {fileId});
+		generator.OpExtInst(voidTypeId, generator.nextId(), openClDebugInfoId, 35, {fileId});
+		generator.OpExtInst(voidTypeId, generator.nextId(), legacyDebugInfoId, 35, {fileId});
+		generator.OpExtInst(voidTypeId, generator.nextId(), glslId, 1, {fileId});
+		generator.OpLine(fileId, 1, 1);
+	};
+
+	dynspv::ModuleGenerator generator{};
+	emitModule(generator);
+	const size_t fullSize = generator.view().size();
+	const uint32_t fullBound = generator.getBound();
+
+	generator.reset();
+	generator.setStripDebugInfo(true);
+	emitModule(generator);
+
+	std::vector<spv::Op> opcodes;
+	for (auto&& instruction : dynspv::ModuleReader{generator.view()})
+	{
+		opcodes.push_back(instruction.opcode);
+	}
+	EXPECT_EQ(opcodes, (std::vector<spv::Op>{spv::Op::OpCapability, spv::Op::OpExtInstImport, spv::Op::OpTypeVoid, spv::Op::OpExtInst}));
+	EXPECT_LT(generator.view().size(), fullSize);
+	// Ids are still allocated so both modes number the same
+	EXPECT_EQ(generator.getBound(), fullBound);
+
+	// Restoring forgets the imports stripped after the snapshot, so their ids can be reused by other sets
+	generator.reset();
+	generator.writeHeader(0x010000);
+	const auto snapshot = generator.snapshot();
+	generator.OpExtInstImport(1, "NonSemantic.Shader.DebugInfo.100");
+	generator.restore(snapshot);
+	generator.OpExtInstImport(1, "GLSL.std.450");
+	generator.OpExtInst(2, 3, 1, 1, {4});
+	opcodes.clear();
+	for (auto&& instruction : dynspv::ModuleReader{generator.view()})
+	{
+		opcodes.push_back(instruction.opcode);
+	}
+	EXPECT_EQ(opcodes, (std::vector<spv::Op>{spv::Op::OpExtInstImport, spv::Op::OpExtInst}));
+}
+
+TEST(GeneratorTests, StringsArePackedWithZeroPadding)
+{
+	const std::string_view text = "abcdefghi";
+	for (size_t size = 0; size <= text.size(); size++)
+	{
+		const std::string_view string = text.substr(0, size);
+		dynspv::ModuleGenerator generator{};
+		generator.writeWord(string);
+
+		auto code = generator.view();
+		ASSERT_EQ(code.size(), size / 4 + 1);
+		for (size_t i = 0; i < code.size(); i++)
+		{
+			EXPECT_EQ(code[i], dynspv::packStringWord(string, i * 4)) << size;
+		}
+	}
+
+	dynspv::ModuleGenerator generator{};
+	const char* name = "main";
+	generator.writeWord(name);
+	generator.OpName(1, name);
+	EXPECT_EQ(generator.view()[0], 0x6e69616d);
+	EXPECT_EQ(generator.view()[1], 0);
+	EXPECT_EQ(generator.view()[5], 0);
+}
+
+TEST(GeneratorTests, ModuleLinkerRebasesIdsAndMergesSections)
+{
+	auto emitFragment = [](bool withEntryPoint) {
+		dynspv::ModuleGenerator generator{};
+		generator.writeHeader(0x010000);
+		generator.OpCapability(spv::Capability::CapabilityShader);
+		generator.OpMemoryModel(spv::AddressingModel::AddressingModelLogical, spv::MemoryModel::MemoryModelGLSL450);
+		auto functionId = generator.nextId();
+		if (withEntryPoint)
+		{
+			generator.OpEntryPoint(spv::ExecutionModel::ExecutionModelGLCompute, functionId, "main");
+		}
+		generator.OpName(functionId, "function");
+		auto voidTypeId = generator.nextId();
+		generator.OpTypeVoid(voidTypeId);
+		auto functionTypeId = generator.nextId();
+		generator.OpTypeFunction(functionTypeId, voidTypeId);
+		generator.OpFunction(voidTypeId, functionId, spv::FunctionControlMask::FunctionControlMaskNone, functionTypeId);
+		generator.OpLabel(generator.nextId());
+		generator.OpReturn();
+		generator.OpFunctionEnd();
+		generator.updateBound(generator.getBound());
+		return generator.getSink().releaseCode();
+	};
+
+	dynspv::ModuleLinker linker{};
+	linker.addModule(emitFragment(true));
+	linker.addModule(emitFragment(false));
+	auto code = linker.link(0x010000);
+	EXPECT_EQ(code[dynspv::BOUND_INDEX], 9);
+
+	std::vector<dynspv::Instruction> instructions{};
+	for (auto&& instruction : dynspv::ModuleReader{code})
+	{
+		instructions.push_back(instruction);
+	}
+	auto count = [&instructions](spv::Op opcode) {
+		return std::count_if(instructions.begin(), instructions.end(), [opcode](auto&& instruction) { return instruction.opcode == opcode; });
+	};
+	EXPECT_EQ(count(spv::Op::OpCapability), 1);
+	EXPECT_EQ(count(spv::Op::OpMemoryModel), 1);
+	EXPECT_EQ(count(spv::Op::OpTypeVoid), 1);
+	EXPECT_EQ(count(spv::Op::OpTypeFunction), 1);
+	ASSERT_EQ(count(spv::Op::OpFunction), 2);
+	ASSERT_EQ(count(spv::Op::OpName), 2);
+
+	// Both functions use the types of the first fragment, the second one keeps its rebased result id
+	std::vector<std::array<uint32_t, 4>> functions;
+	for (auto&& instruction : instructions)
+	{
+		if (instruction.opcode == spv::Op::OpFunction)
+		{
+			functions.push_back({instruction.words[1], instruction.words[2], instruction.words[3], instruction.words[4]});
+		}
+	}
+	EXPECT_EQ(functions[0], (std::array<uint32_t, 4>{2, 1, 0, 3}));
+	EXPECT_EQ(functions[1], (std::array<uint32_t, 4>{2, 5, 0, 3}));
+	EXPECT_EQ(instructions[2].opcode, spv::Op::OpEntryPoint);
+	EXPECT_EQ(instructions[3].words[1], 1);
+	EXPECT_EQ(instructions[4].words[1], 5);
+
+	// A module whose ids reach past its bound is rejected before the linker changes
+	auto outOfBound = emitFragment(false);
+	outOfBound[dynspv::BOUND_INDEX] = 3;
+	EXPECT_THROW(linker.addModule(outOfBound), std::invalid_argument);
+	EXPECT_EQ(linker.getBound(), 9);
+	EXPECT_EQ(linker.link(0x010000), code);
+}
+
+TEST(GeneratorTests, CompactIdsRenumbersDensely)
+{
+	dynspv::ModuleGenerator generator{};
+	generator.writeHeader(0x010000);
+	generator.OpCapability(spv::Capability::CapabilityShader);
+	generator.OpMemoryModel(spv::AddressingModel::AddressingModelLogical, spv::MemoryModel::MemoryModelGLSL450);
+	std::vector<uint32_t> typeIds;
+	for (uint32_t i = 0; i < 20; i++)
+	{
+		// Every other id is left unused
+		generator.nextId();
+		auto typeId = generator.nextId();
+		generator.OpTypeInt(typeId, 8 + i, 0);
+		typeIds.push_back(typeId);
+	}
+	auto structTypeId = generator.nextId();
+	generator.nextId();
+	generator.OpTypeStruct(structTypeId, typeIds);
+	generator.updateBound(generator.getBound());
+
+	auto code = generator.getSink().releaseCode();
+	EXPECT_EQ(dynspv::compactIds(code), 22);
+	EXPECT_EQ(code[dynspv::BOUND_INDEX], 22);
+
+	std::vector<uint32_t> resultIds;
+	std::vector<uint32_t> members;
+	for (auto&& instruction : dynspv::ModuleReader{code})
+	{
+		if (instruction.getResultId() != 0)
+		{
+			resultIds.push_back(instruction.getResultId());
+		}
+		if (instruction.opcode == spv::Op::OpTypeStruct)
+		{
+			members.assign(instruction.words.begin() + 2, instruction.words.end());
+		}
+	}
+	std::vector<uint32_t> expectedIds(21);
+	std::iota(expectedIds.begin(), expectedIds.end(), 1);
+	EXPECT_EQ(resultIds, expectedIds);
+	expectedIds.pop_back();
+	EXPECT_EQ(members, expectedIds);
+}
+
+TEST(GeneratorTests, ExtInstOperandsAreOnlyRemappedForIdOnlySets)
+{
+	auto emit = [](std::string_view set) {
+		// Ids 1 and 2 are unused so compaction renumbers every id
+		dynspv::ModuleGenerator generator{};
+		generator.writeHeader(0x010000);
+		generator.OpExtInstImport(3, set);
+		generator.OpTypeFloat(4, 32);
+		generator.OpUndef(4, 5);
+		generator.OpExtInst(4, 6, 3, 1, {5});
+		generator.updateBound(7);
+		return generator.getSink().releaseCode();
+	};
+
+	auto code = emit("GLSL.std.450");
+	EXPECT_EQ(dynspv::compactIds(code), 5);
+	EXPECT_TRUE(std::ranges::equal(std::span{code}.last(6), std::vector<uint32_t>{code[code.size() - 6], 2, 4, 1, 1, 3}));
+
+	for (std::string_view set : {"OpenCL.std", "OpenCL.DebugInfo.100"})
+	{
+		code = emit(set);
+		const auto original = code;
+		EXPECT_THROW(dynspv::compactIds(code), std::invalid_argument);
+		EXPECT_EQ(code, original);
+
+		dynspv::ModuleLinker linker{};
+		EXPECT_THROW(linker.addModule(code), std::invalid_argument);
+		EXPECT_EQ(linker.getBound(), 1);
+	}
+}
+
+TEST(GeneratorTests, SwitchLiteralsFollowSelectorWidth)
+{
+	// Ids 1 to 3 are unused so compaction renumbers every label
+	dynspv::ModuleGenerator generator{};
+	generator.writeHeader(0x010000);
+	generator.OpTypeInt(4, 64, 0);
+	generator.OpTypeInt(5, 32, 0);
+	generator.OpUndef(4, 6);
+	generator.OpUndef(5, 7);
+	generator.writeInstruction(spv::Op::OpSwitch, 9, 6u, 8u, uint64_t{5}, 9u, uint64_t{0x100000006}, 10u);
+	generator.OpSwitch(7, 8, {{{1, 9}, {2, 10}, {3, 11}}});
+	generator.updateBound(12);
+
+	auto code = generator.getSink().releaseCode();
+	EXPECT_EQ(dynspv::compactIds(code), 9);
+
+	std::vector<std::vector<uint32_t>> switches;
+	for (auto&& instruction : dynspv::ModuleReader{code})
+	{
+		if (instruction.opcode == spv::Op::OpSwitch)
+		{
+			switches.emplace_back(instruction.words.begin() + 1, instruction.words.end());
+		}
+	}
+	ASSERT_EQ(switches.size(), 2);
+	EXPECT_EQ(switches[0], (std::vector<uint32_t>{3, 5, 5, 0, 6, 6, 1, 7}));
+	EXPECT_EQ(switches[1], (std::vector<uint32_t>{4, 5, 1, 6, 2, 7, 3, 8}));
+
+	// Without the selector type a layout fitting both widths is rejected
+	dynspv::Instruction narrowSwitch{};
+	for (auto&& instruction : dynspv::ModuleReader{code})
+	{
+		if (instruction.opcode == spv::Op::OpSwitch)
+		{
+			narrowSwitch = instruction;
+		}
+	}
+	size_t literalCount = 0;
+	auto countLiterals = [&literalCount](dynspv::OperandKind kind, std::span<const uint32_t>) { literalCount += kind == dynspv::OperandKind::LiteralInteger; };
+	EXPECT_THROW(dynspv::forEachOperand(narrowSwitch, countLiterals), std::invalid_argument);
+	literalCount = 0;
+	dynspv::forEachOperand(narrowSwitch, countLiterals, 1);
+	EXPECT_EQ(literalCount, 3);
+}
+
+TEST(GeneratorTests, InstrumentationCountsInstructionsAndWords)
+{
+	dynspv::Instrumentation instrumentation{};
+	dynspv::ModuleGenerator generator{};
+	generator.writeHeader(0x010000);
+	for (uint32_t i = 0; i < 3; i++)
+	{
+		const dynspv::InstrumentationScope scope{instrumentation, generator.getSink(), dynspv::getInstructionIndex(spv::Op::OpName)};
+		generator.OpName(i, "name");
+	}
+	{
+		const dynspv::InstrumentationScope scope{instrumentation, generator.getSink(), dynspv::getInstructionIndex(spv::Op::OpCapability)};
+		generator.OpCapability(spv::Capability::CapabilityShader);
+	}
+
+	auto stats = instrumentation.snapshot();
+	ASSERT_EQ(stats.size(), 2);
+	EXPECT_EQ(stats[0].opcode, spv::Op::OpName);
+	EXPECT_EQ(stats[0].count, 3);
+	EXPECT_EQ(stats[0].words, 3 * 4);
+	EXPECT_EQ(stats[1].opcode, spv::Op::OpCapability);
+	EXPECT_EQ(stats[1].count, 1);
+	EXPECT_EQ(stats[1].words, 2);
+
+	auto histogram = instrumentation.getCycleHistogram();
+	EXPECT_EQ(std::accumulate(histogram.begin(), histogram.end(), uint64_t{0}), 4);
+	EXPECT_EQ(dynspv::getInstructionIndex(static_cast<spv::Op>(0xffff)), dynspv::INSTRUCTION_COUNT);
+
+#if defined(DYNSPV_ENABLE_INSTRUMENTATION)
+	// The generated instruction functions and builders record into the generator itself
+	dynspv::ModuleGenerator instrumented{};
+	instrumented.OpName(1, "name");
+	instrumented.OpCapability(spv::Capability::CapabilityShader);
+	instrumented.beginOpConstantComposite(5, 6).add(7).end();
+	auto generatedStats = instrumented.getInstrumentation().snapshot();
+	ASSERT_EQ(generatedStats.size(), 3);
+	EXPECT_EQ(generatedStats[0].opcode, spv::Op::OpName);
+	EXPECT_EQ(generatedStats[0].words, 4);
+	EXPECT_EQ(generatedStats[1].opcode, spv::Op::OpCapability);
+	EXPECT_EQ(generatedStats[1].words, 2);
+	EXPECT_EQ(generatedStats[2].opcode, spv::Op::OpConstantComposite);
+	EXPECT_EQ(generatedStats[2].words, 4);
+	auto generatedHistogram = instrumented.getInstrumentation().getCycleHistogram();
+	EXPECT_EQ(std::accumulate(generatedHistogram.begin(), generatedHistogram.end(), uint64_t{0}), 3);
+
+	const uint64_t cycles = generatedStats[0].cycles + generatedStats[1].cycles;
+#if defined(DYNSPV_INSTRUMENT_CYCLES)
+	EXPECT_GT(cycles, 0);
+#else
+	EXPECT_EQ(cycles, 0);
+#endif
+#endif
+}
+
+TEST(GeneratorTests, PooledSinksRecycleBuffers)
+{
+	const uint32_t* firstBuffer = nullptr;
+	{
+		dynspv::BasicModuleGenerator<dynspv::PooledSink> generator{};
+		generator.writeHeader(0x010000);
+		firstBuffer = generator.view().data();
+	}
+	{
+		dynspv::BasicModuleGenerator<dynspv::PooledSink> generator{};
+		generator.writeHeader(0x010000);
+		EXPECT_EQ(generator.view().data(), firstBuffer);
+		EXPECT_EQ(generator.view()[0], spv::MagicNumber);
+	}
+
+	// Larger requests come from their own size class
+	auto& pool = dynspv::getThreadBufferPool();
+	auto buffer = pool.acquire(dynspv::DEFAULT_MAX_CODE_SIZE * 3);
+	EXPECT_EQ(buffer.capacity(), dynspv::DEFAULT_MAX_CODE_SIZE * 4);
+	const uint32_t* largeBuffer = buffer.data();
+	pool.release(std::move(buffer));
+	EXPECT_EQ(pool.acquire(dynspv::DEFAULT_MAX_CODE_SIZE * 4).data(), largeBuffer);
+	EXPECT_EQ(pool.acquire().data(), firstBuffer);
+}
+
+TEST(GeneratorTests, PmrVectorSinkUsesMemoryResource)
+{
+	std::array<std::byte, 4096> storage{};
+	std::pmr::monotonic_buffer_resource resource{storage.data(), storage.size(), std::pmr::null_memory_resource()};
+	dynspv::BasicModuleGenerator<dynspv::PmrVectorSink> generator{dynspv::PmrVectorSink{64, &resource}};
+	generator.writeHeader(0x010000);
+	generator.OpCapability(spv::Capability::CapabilityShader);
+
+	auto* data = reinterpret_cast<const std::byte*>(generator.view().data());
+	EXPECT_TRUE(data >= storage.data() && data < storage.data() + storage.size());
+	EXPECT_EQ(generator.view().size(), 7);
+}
+
+TEST(GeneratorTests, FingerprintIsUpdatedDuringEmission)
+{
+	auto fingerprint = [](dynspv::FingerprintMode mode, bool withNames, uint32_t width) {
+		dynspv::ModuleGenerator generator{};
+		generator.setFingerprintMode(mode);
+		generator.writeHeader(0x010000);
+		generator.OpCapability(spv::Capability::CapabilityShader);
+		auto intTypeId = generator.nextId();
+		if (withNames)
+		{
+			generator.OpName(intTypeId, "int");
+		}
+		generator.OpTypeInt(intTypeId, width, 1);
+		generator.OpConstant(intTypeId, generator.nextId(), 7);
+
+		// Emitting the same words as one block hashes the same
+		dynspv::ModuleGenerator copy{};
+		copy.setFingerprintMode(mode);
+		copy.writeHeader(0x010000);
+		copy.writeCode(generator.view().subspan(dynspv::HEADER_SIZE));
+		EXPECT_EQ(copy.getFingerprint(), generator.getFingerprint());
+		return generator.getFingerprint();
+	};
+
+	using Mode = dynspv::FingerprintMode;
+	EXPECT_EQ(fingerprint(Mode::ExcludeDebugInfo, true, 32), fingerprint(Mode::ExcludeDebugInfo, false, 32));
+	EXPECT_NE(fingerprint(Mode::AllInstructions, true, 32), fingerprint(Mode::AllInstructions, false, 32));
+	EXPECT_NE(fingerprint(Mode::AllInstructions, false, 32), fingerprint(Mode::AllInstructions, false, 16));
+	EXPECT_EQ(fingerprint(Mode::Disabled, false, 32), fingerprint(Mode::Disabled, false, 16));
+
+	dynspv::ModuleGenerator generator{};
+	generator.setFingerprintMode(Mode::AllInstructions);
+	generator.writeHeader(0x010000);
+	generator.OpCapability(spv::Capability::CapabilityShader);
+	auto snapshot = generator.snapshot();
+	generator.OpTypeVoid(generator.nextId());
+	const uint64_t expected = generator.getFingerprint();
+	EXPECT_NE(generator.getFingerprint(true), expected);
+
+	generator.restore(snapshot);
+	generator.OpTypeVoid(generator.nextId());
+	EXPECT_EQ(generator.getFingerprint(), expected);
+}
+
+TEST(GeneratorTests, BuildBatchMatchesSerialEmission)
+{
+	auto emitVariant = [](dynspv::ModuleGenerator& generator, size_t index) {
+		generator.writeHeader(0x010000);
+		generator.OpCapability(spv::Capability::CapabilityShader);
+		auto intTypeId = generator.nextId();
+		generator.OpTypeInt(intTypeId, 32, 0);
+		// Uneven sizes so workers run out of work at different times
+		for (uint32_t i = 0; i < index % 17; i++)
+		{
+			generator.OpConstant(intTypeId, generator.nextId(), static_cast<uint32_t>(index));
+		}
+		generator.updateBound(generator.getBound());
+	};
+
+	constexpr size_t MODULE_COUNT = 500;
+	auto batch = dynspv::buildBatch(MODULE_COUNT, emitVariant, 4);
+	ASSERT_EQ(batch.size(), MODULE_COUNT);
+	EXPECT_EQ(batch.offsets.back(), batch.code.size());
+	for (size_t i = 0; i < MODULE_COUNT; i++)
+	{
+		dynspv::ModuleGenerator generator{};
+		emitVariant(generator, i);
+		auto module = batch.getModule(i);
+		ASSERT_TRUE(std::ranges::equal(module, generator.view())) << i;
+	}
+
+	auto failingBuilder = [](dynspv::ModuleGenerator& generator, size_t index) {
+		if (index == 42)
+		{
+			throw std::runtime_error("variant failed");
+		}
+		generator.writeHeader(0x010000);
+	};
+	EXPECT_THROW(dynspv::buildBatch(MODULE_COUNT, failingBuilder, 4), std::runtime_error);
+}
+
+TEST(GeneratorTests, MappedArchiveServesModuleViews)
+{
+	auto batch = dynspv::buildBatch(16, [](dynspv::ModuleGenerator& generator, size_t index) {
+		generator.writeHeader(0x010000);
+		for (size_t i = 0; i <= index; i++)
+		{
+			generator.OpCapability(spv::Capability::CapabilityShader);
+		}
+		generator.updateBound(generator.getBound());
+	});
+	std::vector<uint64_t> keys;
+	for (uint64_t i = 0; i < batch.size(); i++)
+	{
+		keys.push_back((15 - i) * 1000);
+	}
+
+	const auto path = std::filesystem::temp_directory_path() / "dynspv_archive_test.bin";
+	{
+		std::FILE* file = std::fopen(path.string().c_str(), "wb");
+		ASSERT_NE(file, nullptr);
+		dynspv::ArchiveWriter writer{};
+		writer.addBatch(batch, keys);
+		writer.write(file);
+		std::fclose(file);
+	}
+
+	{
+		dynspv::MappedArchive archive{path};
+		ASSERT_EQ(archive.getView().size(), batch.size());
+		for (size_t i = 0; i < batch.size(); i++)
+		{
+			auto module = archive.find(keys[i]);
+			ASSERT_TRUE(module.has_value());
+			EXPECT_TRUE(std::ranges::equal(*module, batch.getModule(i)));
+			EXPECT_EQ(reinterpret_cast<uintptr_t>(module->data()) % alignof(uint32_t), 0);
+		}
+		EXPECT_FALSE(archive.find(1).has_value());
+		EXPECT_EQ(archive.getView().getEntry(0).keyHash, 0);
+		EXPECT_EQ(archive.getView().getEntry(0).bound, 1);
+	}
+	std::filesystem::remove(path);
+
+	std::vector<uint32_t> truncated{dynspv::ARCHIVE_MAGIC_NUMBER, dynspv::ARCHIVE_VERSION, 1, 0};
+	EXPECT_THROW(dynspv::ArchiveView{truncated}, std::invalid_argument);
+}
+
+TEST(GeneratorTests, InstructionSetsSelectVendorInstructions)
+{
+	using CoreGenerator = dynspv::BasicModuleGenerator<dynspv::VectorSink, dynspv::InstructionSets<>>;
+	using KhrGenerator = dynspv::BasicModuleGenerator<dynspv::VectorSink, dynspv::InstructionSets<dynspv::KhrInstructions>>;
+	constexpr auto hasKhrInstructions = []<typename TGenerator>() { return requires(TGenerator generator) { generator.OpAssumeTrueKHR(1); }; };
+	constexpr auto hasIntelInstructions = []<typename TGenerator>() { return requires(TGenerator generator) { generator.OpAbsISubINTEL(1, 2, 3, 4); }; };
+	static_assert(!hasKhrInstructions.operator()<CoreGenerator>());
+	static_assert(hasKhrInstructions.operator()<KhrGenerator>());
+	static_assert(!hasIntelInstructions.operator()<KhrGenerator>());
+	static_assert(hasIntelInstructions.operator()<dynspv::ModuleGenerator>());
+	static_assert(std::is_same_v<decltype(dynspv::ModuleGenerator{}), dynspv::BasicModuleGenerator<dynspv::VectorSink, dynspv::DefaultInstructionSets>>);
+
+	auto emit = [](auto& generator) {
+		generator.setStripDebugInfo(true);
+		generator.writeHeader(0x010000);
+		auto setId = generator.nextId();
+		generator.OpExtInstImport(setId, "NonSemantic.Shader.DebugInfo.100");
+		generator.OpExtInstWithForwardRefsKHR(1, generator.nextId(), setId, 2);
+		generator.OpAssumeTrueKHR(3);
+	};
+
+	KhrGenerator khrGenerator{};
+	emit(khrGenerator);
+	dynspv::ModuleGenerator generator{};
+	emit(generator);
+	EXPECT_TRUE(std::ranges::equal(khrGenerator.view(), generator.view()));
+	EXPECT_EQ(khrGenerator.view().size(), dynspv::HEADER_SIZE + 2);
+
+	// Helpers built on a generator take the selected sets from it
+	dynspv::ModuleBuilder<KhrGenerator> builder{};
+	builder.addFunction().OpAssumeTrueKHR(3);
+	const auto code = builder.finish(0x010000);
+	ASSERT_EQ(code.size(), dynspv::HEADER_SIZE + 2);
+	EXPECT_TRUE(std::equal(code.begin() + dynspv::HEADER_SIZE, code.end(), khrGenerator.view().begin() + dynspv::HEADER_SIZE));
+}
+
+TEST(GeneratorTests, InstructionBuildersPatchWordCount)
+{
+	dynspv::ModuleGenerator expected{};
+	expected.setFingerprintMode(dynspv::FingerprintMode::AllInstructions);
+	expected.OpSwitch(1, 2, {{{10, 3}, {20, 4}}});
+	expected.OpConstantComposite(5, 6, {{7, 8, 9}});
+	expected.OpPhi(5, 10, {});
+
+	dynspv::ModuleGenerator generator{};
+	generator.setFingerprintMode(dynspv::FingerprintMode::AllInstructions);
+	auto sw = generator.beginOpSwitch(1, 2);
+	sw.add(10, 3).add(20, 4);
+	sw.end();
+	auto composite = generator.beginOpConstantComposite(5, 6);
+	for (uint32_t constituent = 7; constituent < 10; constituent++)
+	{
+		composite.add(constituent);
+	}
+	composite.end();
+	generator.beginOpPhi(5, 10).end();
+
+	EXPECT_TRUE(std::ranges::equal(generator.view(), expected.view()));
+	EXPECT_EQ(generator.getFingerprint(), expected.getFingerprint());
+	EXPECT_EQ(generator.relocateLastInstruction(0).wordIndex, expected.relocateLastInstruction(0).wordIndex);
+
+	// Sinks without data() fingerprint built instructions too, even once their start has been flushed
+	dynspv::BasicModuleGenerator<dynspv::StreamSink> streamed{dynspv::StreamSink{[](size_t, std::span<const uint32_t>) {}, 4}};
+	streamed.setFingerprintMode(dynspv::FingerprintMode::AllInstructions);
+	streamed.beginOpSwitch(1, 2).add(10, 3).add(20, 4).end();
+	auto streamedComposite = streamed.beginOpConstantComposite(5, 6);
+	for (uint32_t constituent = 7; constituent < 10; constituent++)
+	{
+		streamedComposite.add(constituent);
+	}
+	streamedComposite.end();
+	streamed.beginOpPhi(5, 10).end();
+	EXPECT_EQ(streamed.getFingerprint(), expected.getFingerprint());
+
+	// The oversized instruction is dropped again, the last instruction is still the one emitted before it
+	const size_t size = generator.view().size();
+	auto oversized = generator.beginOpConstantComposite(5, 11);
+	EXPECT_THROW(
+		{
+			for (uint32_t i = 0; i < 0x10000; i++)
+			{
+				oversized.add(i);
+			}
+		},
+		std::length_error);
+	EXPECT_EQ(generator.view().size(), size);
+	EXPECT_EQ(generator.relocateLastInstruction(0).wordIndex, expected.relocateLastInstruction(0).wordIndex);
+	EXPECT_EQ(generator.getFingerprint(), expected.getFingerprint());
+	generator.beginOpPhi(5, 10).end();
+	expected.OpPhi(5, 10, {});
+	EXPECT_TRUE(std::ranges::equal(generator.view(), expected.view()));
+}
+
+TEST(GeneratorTests, ConstantTablesMatchPerConstantEmission)
+{
+	std::vector<float> floats(37);
+	std::iota(floats.begin(), floats.end(), -3.5f);
+	const std::vector<int16_t> shorts{-1, 2, -3};
+	const std::vector<uint64_t> longs{1, 0x100000002};
+
+	dynspv::ModuleGenerator expected{};
+	expected.setFingerprintMode(dynspv::FingerprintMode::AllInstructions);
+	std::vector<dynspv::IdRef> constituents;
+	for (float value : floats)
+	{
+		constituents.push_back(expected.nextId());
+		expected.OpConstant(1, constituents.back(), value);
+	}
+	const auto expectedCompositeId = expected.nextId();
+	expected.OpConstantComposite(2, expectedCompositeId, constituents);
+	for (int16_t value : shorts)
+	{
+		expected.OpConstant(3, expected.nextId(), value);
+	}
+	for (uint64_t value : longs)
+	{
+		expected.OpConstant(4, expected.nextId(), value);
+	}
+
+	dynspv::ModuleGenerator generator{};
+	generator.setFingerprintMode(dynspv::FingerprintMode::AllInstructions);
+	EXPECT_EQ(dynspv::writeConstantComposite(generator, 2, 1, std::span{floats}), expectedCompositeId);
+	EXPECT_EQ(dynspv::writeConstants(generator, 3, std::span{shorts}), expectedCompositeId + 1);
+	EXPECT_EQ(dynspv::writeConstants(generator, 4, std::span{longs}), expectedCompositeId + 4);
+	EXPECT_EQ(generator.relocateLastInstruction(3, 2).wordIndex, expected.relocateLastInstruction(3, 2).wordIndex);
+
+	EXPECT_TRUE(std::ranges::equal(generator.view(), expected.view()));
+	EXPECT_EQ(generator.getBound(), expected.getBound());
+	EXPECT_EQ(generator.getFingerprint(), expected.getFingerprint());
+
+	const std::vector<uint32_t> oversized(0xffff - 2);
+	const size_t size = generator.view().size();
+	EXPECT_THROW(dynspv::writeConstantComposite(generator, 2, 1, std::span{oversized}), std::length_error);
+	EXPECT_EQ(generator.view().size(), size);
+
+	// Section generators draw the table ids from the shared allocator
+	dynspv::ModuleBuilder builder{4};
+	auto& types = builder.section(dynspv::ModuleSection::Types);
+	std::vector<uint32_t> ids{types.nextId()};
+	const auto firstId = dynspv::writeConstants(types, ids[0], std::span{shorts});
+	const auto compositeId = dynspv::writeConstantComposite(types, ids[0] + 1, ids[0], std::span{floats});
+	for (uint32_t i = 0; i < shorts.size(); i++)
+	{
+		ids.push_back(firstId + i);
+	}
+	ids.push_back(compositeId);
+	ids.push_back(types.nextId());
+	ids.push_back(builder.nextId());
+	std::sort(ids.begin(), ids.end());
+	EXPECT_EQ(std::adjacent_find(ids.begin(), ids.end()), ids.end());
+	EXPECT_LT(ids.back(), builder.getBound());
+}
+
+TEST(GeneratorTests, OversizedInstructionsThrowBeforeWriting)
+{
+	dynspv::ModuleGenerator generator{};
+	generator.writeHeader(0x010000);
+	const size_t size = generator.view().size();
+
+	EXPECT_THROW(generator.OpConstantComposite(1, 2, std::vector<dynspv::IdRef>(70000)), std::length_error);
+	EXPECT_THROW(generator.OpSource(spv::SourceLanguage::SourceLanguageGLSL, 450, 3, std::string(300000, 'x')), std::length_error);
+	EXPECT_EQ(generator.view().size(), size);
+
+	// The largest encodable instruction is still written
+	generator.OpConstantComposite(1, 2, std::vector<dynspv::IdRef>(dynspv::MAX_INSTRUCTION_WORD_COUNT - 3));
+	EXPECT_EQ(generator.view().size(), size + dynspv::MAX_INSTRUCTION_WORD_COUNT);
+	EXPECT_EQ(generator.view()[size] >> 16, dynspv::MAX_INSTRUCTION_WORD_COUNT);
+
+	dynspv::InterningGenerator<> interning{};
+	EXPECT_THROW(interning.internType(spv::Op::OpTypeStruct, std::vector<dynspv::IdRef>(70000)), std::length_error);
+	EXPECT_THROW(interning.internConstant(spv::Op::OpConstantComposite, 1, std::vector<dynspv::IdRef>(70000)), std::length_error);
+	EXPECT_EQ(interning.getCache().size(), 0);
+	EXPECT_EQ(interning.getSink().size(), 0);
+}